@@ -6,7 +6,9 @@
  *
  * @author      Manuel Caballero
  * @date        02/December/2021
- * @version     02/December/2021   The ORIGIN
+ * @version     18/October/2026    conf_Timers() returns 0 if PBCLK is out of range
+ *              18/October/2026    conf_CLK() replaced by sysclk_init() ( sysclk.h ), conf_Timers() takes PBCLK
+ *              02/December/2021   The ORIGIN
  * @pre         N/A
  * @warning     N/A
  */
@@ -23,9 +25,8 @@ extern "C" {
 
 /**@brief Function prototypes.
  */
-void conf_CLK       ( void );
 void conf_GPIO      ( void );
-void conf_Timers    ( void );
+uint8_t conf_Timers ( uint32_t f_pb );
 
 /**@brief Constants.
  */
@@ -7,7 +7,8 @@
  *
  * @author      Manuel Caballero
  * @date        02/December/2021
- * @version     02/December/2021   The ORIGIN
+ * @version     18/October/2026    Priority map ( intmap.h ): Timer1 at IPL7 with the shadow register set
+ *              02/December/2021   The ORIGIN
  * @pre         N/A
  * @warning     N/A
  */
@@ -17,6 +18,18 @@
 #ifndef INTERRUPTS_H_
 #define INTERRUPTS_H_
 
+
+/**@brief Priority map ( intmap.h ): ( vector, priority, sub-priority, context ).
+ *
+ *        Timer1 is the only vector of the example: It takes the shadow register set ( IPL7, FSRSSEL ).
+ */
+#define INTMAP_T1       ( _TIMER_1_VECTOR, 7, 1, SRS )
+
+#define INTMAP_TABLE( X )                               \
+    X( T1,    IPC1bits.T1IP,   IPC1bits.T1IS )
+
+#include "intmap.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
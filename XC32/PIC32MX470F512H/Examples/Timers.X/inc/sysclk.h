@@ -0,0 +1,136 @@
+/**
+ * @brief       sysclk.h
+ * @details     System clock and performance configuration header ( PIC32MX470 ).
+ *
+ *              sysclk_init() brings the core from the reset clock ( FRCDIV ) up to the PLL:
+ *
+ *                  SYSCLK = ( F_IN / SYSCLK_PLL_IDIV ) * SYSCLK_PLL_MUL / SYSCLK_PLL_ODIV
+ *                  PBCLK  = SYSCLK / SYSCLK_PB_DIV
+ *
+ *                  - F_IN:     FRC ( 8MHz ) or POSC ( SYSCLK_POSC_HZ ), SYSCLK_SOURCE.
+ *                  - IDIV:     Configuration bits only ( FPLLIDIV, variables.h ), it must match SYSCLK_PLL_IDIV.
+ *                  - MUL:      15, 16, 17, 18, 19, 20, 21 or 24. ODIV: 1, 2, 4, 8, 16, 32, 64 or 256.
+ *                  - PB_DIV:   1, 2, 4 or 8.
+ *
+ *              Performance, before the switch ( the wait states must be there before the clock goes up ):
+ *
+ *                  - Flash wait states:    CHECON.PFMWS = ceil( SYSCLK / SYSCLK_FLASH_HZ ) - 1.
+ *                  - Prefetch:             CHECON.PREFEN, cacheable and non-cacheable regions.
+ *                  - RAM:                  No data RAM wait state ( BMXCON.BMXWSDRM ).
+ *                  - KSEG0:                Cacheable ( CP0 Config.K0 = 3 ), served by the prefetch cache.
+ *
+ *              The clocks in use are read back from OSCCON ( and the configuration bits ) and published:
+ *              sysclk_sys_hz() and sysclk_pb_hz() feed the drivers ( e.g. conf_UART1(), baud rate ), they stay
+ *              right if the switch fails ( reset clock ) or after any other clock switch ( sysclk_update() ).
+ *
+ *              Examples, FRC ( 8MHz ), FPLLIDIV = DIV_2 ( PLL input: 4MHz ):
+ *
+ *                  - MUL 24, ODIV 1:   96MHz, 2 wait states.
+ *                  - MUL 20, ODIV 1:   80MHz, 1 wait state.
+ *                  - MUL 20, ODIV 2:   40MHz, 0 wait states.
+ *
+ *              The build fails if a divider is not valid, the PLL input is out of range or SYSCLK exceeds
+ *              SYSCLK_MAX_HZ.
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero (aqueronteblog@gmail.com)
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         Clock switching enabled ( FCKSM = CSECMD ), FPLLIDIV = SYSCLK_PLL_IDIV ( variables.h ).
+ * @warning     The peripherals which depend on PBCLK must be configured after sysclk_init().
+ */
+#ifndef SYSCLK_H_
+#define SYSCLK_H_
+
+#include <stdint.h>
+#include "board.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**@brief Constants.
+ */
+#define SYSCLK_FRC          0U                  /*!<   Internal Fast RC, 8MHz                       */
+#define SYSCLK_POSC         1U                  /*!<   Primary oscillator ( POSCMOD = HS or XT )    */
+
+#define SYSCLK_FRC_HZ       8000000UL           /*!<   FRC, nominal                                 */
+
+#ifndef SYSCLK_SOURCE
+#define SYSCLK_SOURCE       SYSCLK_FRC          /*!<   PLL input source                             */
+#endif
+
+#ifndef SYSCLK_POSC_HZ
+#define SYSCLK_POSC_HZ      20000000UL          /*!<   Crystal, only if SYSCLK_SOURCE = SYSCLK_POSC */
+#endif
+
+#ifndef SYSCLK_PLL_IDIV
+#define SYSCLK_PLL_IDIV     2UL                 /*!<   FPLLIDIV ( configuration bits )              */
+#endif
+
+#ifndef SYSCLK_PLL_MUL
+#define SYSCLK_PLL_MUL      24UL                /*!<   PLL multiplier ( OSCCON.PLLMULT )            */
+#endif
+
+#ifndef SYSCLK_PLL_ODIV
+#define SYSCLK_PLL_ODIV     1UL                 /*!<   PLL output divider ( OSCCON.PLLODIV )        */
+#endif
+
+#ifndef SYSCLK_PB_DIV
+#define SYSCLK_PB_DIV       8UL                 /*!<   PBCLK divider ( OSCCON.PBDIV ), Timer1 1s    */
+#endif
+
+#ifndef SYSCLK_MAX_HZ
+#define SYSCLK_MAX_HZ       120000000UL         /*!<   Rated SYSCLK ( PIC32MX470F512H )             */
+#endif
+
+#ifndef SYSCLK_FLASH_HZ
+#define SYSCLK_FLASH_HZ     40000000UL          /*!<   SYSCLK per flash wait state, datasheet       */
+#endif
+
+#ifndef SYSCLK_TIMEOUT
+#define SYSCLK_TIMEOUT      100000UL            /*!<   Polls of the switch and of the PLL lock      */
+#endif
+
+#if ( SYSCLK_SOURCE == SYSCLK_POSC )
+#define SYSCLK_IN_HZ        SYSCLK_POSC_HZ
+#else
+#define SYSCLK_IN_HZ        SYSCLK_FRC_HZ
+#endif
+
+#define SYSCLK_PLL_IN_HZ    ( SYSCLK_IN_HZ / SYSCLK_PLL_IDIV )
+#define SYSCLK_HZ           ( ( SYSCLK_PLL_IN_HZ * SYSCLK_PLL_MUL ) / SYSCLK_PLL_ODIV )   /*!<   Target SYSCLK   */
+#define SYSCLK_PB_HZ        ( SYSCLK_HZ / SYSCLK_PB_DIV )                               /*!<   Target PBCLK    */
+#define SYSCLK_FLASH_WS     ( ( SYSCLK_HZ - 1UL ) / SYSCLK_FLASH_HZ )                   /*!<   Wait states     */
+
+
+/**@brief Build-time checks.
+ */
+typedef char sysclk_mul[ ( ( ( SYSCLK_PLL_MUL >= 15UL ) && ( SYSCLK_PLL_MUL <= 21UL ) ) || ( SYSCLK_PLL_MUL == 24UL ) ) ? 1 : -1 ];
+typedef char sysclk_odiv[ ( ( SYSCLK_PLL_ODIV & ( SYSCLK_PLL_ODIV - 1UL ) ) == 0UL ) && ( SYSCLK_PLL_ODIV <= 256UL ) && ( SYSCLK_PLL_ODIV != 128UL ) ? 1 : -1 ];
+typedef char sysclk_pbdiv[ ( ( SYSCLK_PB_DIV & ( SYSCLK_PB_DIV - 1UL ) ) == 0UL ) && ( SYSCLK_PB_DIV <= 8UL ) ? 1 : -1 ];
+typedef char sysclk_pll_in[ ( ( SYSCLK_PLL_IN_HZ >= 4000000UL ) && ( SYSCLK_PLL_IN_HZ <= 5000000UL ) ) ? 1 : -1 ];
+typedef char sysclk_max[ ( SYSCLK_HZ <= SYSCLK_MAX_HZ ) ? 1 : -1 ];
+typedef char sysclk_ws[ ( SYSCLK_FLASH_WS <= 7UL ) ? 1 : -1 ];
+
+
+/**@brief Function prototypes.
+ */
+uint8_t  sysclk_init        ( void );
+void     sysclk_update      ( void );
+uint32_t sysclk_sys_hz      ( void );
+uint32_t sysclk_pb_hz       ( void );
+
+
+/**@brief Variables.
+ */
+
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SYSCLK_H_ */
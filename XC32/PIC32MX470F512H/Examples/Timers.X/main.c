@@ -8,7 +8,10 @@
  *
  * @author      Manuel Caballero (aqueronteblog@gmail.com)
  * @date        02/December/2021
- * @version     02/December/2021    The ORIGIN
+ * @version     18/October/2026     All the LEDs on if PBCLK is out of range for Timer1
+ *              18/October/2026     SYSCLK from the PLL ( sysclk.h ), Timer1 takes the PBCLK in use
+ *              18/October/2026     Interrupt priority map ( intmap_init() )
+ *              02/December/2021    The ORIGIN
  * @pre         This firmware was tested on the PIC32MX470 Curiosity Development Board with MPLAB X IDE v5.50.
  * @warning     N/A.
  * @pre         This code belongs to AqueronteBlog. 
@@ -23,6 +26,7 @@
 #include "inc/variables.h"
 #include "inc/functions.h"
 #include "inc/interrupts.h"
+#include "inc/sysclk.h"
 
 
 /**@brief Constants.
@@ -42,9 +46,15 @@ void main ( void )
     uint32_t    i   =   0UL;
     
     /* Configure the peripherals*/
-    conf_CLK    ();
+    (void)sysclk_init ();
     conf_GPIO   ();
-    conf_Timers ();    
+    if ( conf_Timers ( sysclk_pb_hz () ) == 0U )
+    {
+        /* PBCLK out of range for a 1s period ( PR1 is 16-bit ): All the LEDs on, Timer1 off  */
+        PORTECLR   =   ( LED1 | LED2 | LED3 );
+        while ( 1 );
+    }
+    intmap_init ();
     
     /* All interrupts are enabled     */
     __builtin_enable_interrupts();
@@ -57,17 +57,17 @@ OBJECTDIR=build/${CND_CONF}/${IMAGE_TYPE}
 DISTDIR=dist/${CND_CONF}/${IMAGE_TYPE}
 
 # Source Files Quoted if spaced
-SOURCEFILES_QUOTED_IF_SPACED=src/functions.c src/interrupts.c main.c
+SOURCEFILES_QUOTED_IF_SPACED=src/functions.c src/interrupts.c main.c src/intmap.c src/sysclk.c
 
 # Object Files Quoted if spaced
-OBJECTFILES_QUOTED_IF_SPACED=${OBJECTDIR}/src/functions.o ${OBJECTDIR}/src/interrupts.o ${OBJECTDIR}/main.o
-POSSIBLE_DEPFILES=${OBJECTDIR}/src/functions.o.d ${OBJECTDIR}/src/interrupts.o.d ${OBJECTDIR}/main.o.d
+OBJECTFILES_QUOTED_IF_SPACED=${OBJECTDIR}/src/functions.o ${OBJECTDIR}/src/interrupts.o ${OBJECTDIR}/main.o ${OBJECTDIR}/src/intmap.o ${OBJECTDIR}/src/sysclk.o
+POSSIBLE_DEPFILES=${OBJECTDIR}/src/functions.o.d ${OBJECTDIR}/src/interrupts.o.d ${OBJECTDIR}/main.o.d ${OBJECTDIR}/src/intmap.o.d ${OBJECTDIR}/src/sysclk.o.d
 
 # Object Files
-OBJECTFILES=${OBJECTDIR}/src/functions.o ${OBJECTDIR}/src/interrupts.o ${OBJECTDIR}/main.o
+OBJECTFILES=${OBJECTDIR}/src/functions.o ${OBJECTDIR}/src/interrupts.o ${OBJECTDIR}/main.o ${OBJECTDIR}/src/intmap.o ${OBJECTDIR}/src/sysclk.o
 
 # Source Files
-SOURCEFILES=src/functions.c src/interrupts.c main.c
+SOURCEFILES=src/functions.c src/interrupts.c main.c src/intmap.c src/sysclk.c
 
 
 
@@ -125,6 +125,18 @@ ${OBJECTDIR}/main.o: main.c  .generated_files/flags/default/9b155934d2a730756d4e
 	@${RM} ${OBJECTDIR}/main.o 
 	${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1  -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -fno-common -MP -MMD -MF "${OBJECTDIR}/main.o.d" -o ${OBJECTDIR}/main.o main.c    -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}"  
 	
+${OBJECTDIR}/src/intmap.o: src/intmap.c  .generated_files/flags/default/c9534b5589cb00704c26bd92b3a022272e6564ae .generated_files/flags/default/25cf332145e109ecc94cb8c88ed46e464b66686
+	@${MKDIR} "${OBJECTDIR}/src" 
+	@${RM} ${OBJECTDIR}/src/intmap.o.d 
+	@${RM} ${OBJECTDIR}/src/intmap.o 
+	${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1  -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -fno-common -MP -MMD -MF "${OBJECTDIR}/src/intmap.o.d" -o ${OBJECTDIR}/src/intmap.o src/intmap.c    -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}"  
+	
+${OBJECTDIR}/src/sysclk.o: src/sysclk.c  .generated_files/flags/default/f85b33a6d0b3b64a310128f0b408809d79fc5837 .generated_files/flags/default/25cf332145e109ecc94cb8c88ed46e464b66686
+	@${MKDIR} "${OBJECTDIR}/src" 
+	@${RM} ${OBJECTDIR}/src/sysclk.o.d 
+	@${RM} ${OBJECTDIR}/src/sysclk.o 
+	${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1  -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -fno-common -MP -MMD -MF "${OBJECTDIR}/src/sysclk.o.d" -o ${OBJECTDIR}/src/sysclk.o src/sysclk.c    -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}"  
+	
 else
 ${OBJECTDIR}/src/functions.o: src/functions.c  .generated_files/flags/default/1bc1c11829c73866839dd0f8e8a334a53051930d .generated_files/flags/default/25cf332145e109ecc94cb8c88ed46e464b66686
 	@${MKDIR} "${OBJECTDIR}/src" 
@@ -144,6 +156,18 @@ ${OBJECTDIR}/main.o: main.c  .generated_files/flags/default/70a713388b2e89006687
 	@${RM} ${OBJECTDIR}/main.o 
 	${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -fno-common -MP -MMD -MF "${OBJECTDIR}/main.o.d" -o ${OBJECTDIR}/main.o main.c    -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}"  
 	
+${OBJECTDIR}/src/intmap.o: src/intmap.c  .generated_files/flags/default/0dcce094749af8a736437db1bfb33fc2ae41c361 .generated_files/flags/default/25cf332145e109ecc94cb8c88ed46e464b66686
+	@${MKDIR} "${OBJECTDIR}/src" 
+	@${RM} ${OBJECTDIR}/src/intmap.o.d 
+	@${RM} ${OBJECTDIR}/src/intmap.o 
+	${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -fno-common -MP -MMD -MF "${OBJECTDIR}/src/intmap.o.d" -o ${OBJECTDIR}/src/intmap.o src/intmap.c    -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}"  
+	
+${OBJECTDIR}/src/sysclk.o: src/sysclk.c  .generated_files/flags/default/efb9fa66f6500fa186e271848261f36c234b1689 .generated_files/flags/default/25cf332145e109ecc94cb8c88ed46e464b66686
+	@${MKDIR} "${OBJECTDIR}/src" 
+	@${RM} ${OBJECTDIR}/src/sysclk.o.d 
+	@${RM} ${OBJECTDIR}/src/sysclk.o 
+	${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -fno-common -MP -MMD -MF "${OBJECTDIR}/src/sysclk.o.d" -o ${OBJECTDIR}/src/sysclk.o src/sysclk.c    -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}"  
+	
 endif
 
 # ------------------------------------------------------------------------------------
@@ -13,58 +13,6 @@
 #include "../inc/functions.h"
 
 
-/**
- * @brief       void conf_CLK  ( void )
- * @details     It configures the clocks for the system.
- * 
- *                  - SYSCLK ( F_SYS ) = FRC/1 = 8MHz
- * 
- *
- * @param[in]    N/A.
- *
- * @param[out]   N/A.
- *
- *
- * @return      N/A
- *
- * @author      Manuel Caballero
- * @date        30/November/2021
- * @version     30/November/2021      The ORIGIN
- * @pre         N/A
- * @warning     N/A
- */
-void conf_CLK  ( void )
-{
-    SYSKEY  =    0x00000000;    // Force lock
-    SYSKEY  =    0xAA996655;    // Unlock registers    
-    SYSKEY  =    0x556699AA;
-    
-    /* Internal Fast RC (FRC) Oscillator divided by 1 */
-    OSCCONbits.FRCDIV   =    0; // FRC divided by 1
-    OSCCONbits.NOSC     =    0; // Internal Fast RC (FRC) Oscillator divided by FRCDIV[2:0] bits (FRCDIV)
-    
-    /* Initiates an oscillator switch to a selection specified by the NOSC[2:0] bits     */
-    OSCCONbits.OSWEN    =    1;
-    
-    /* Wait until oscillator switch is complete  */
-    while ( OSCCONbits.OSWEN == 1 );    // [TODO]       Too dangerous!!! The uC may get stuck here
-                                        // [WORKAROUND] Insert a counter
-    
-    /* Wait until Peripheral Bus Clock (PBCLK) Divisor can be written   */
-    while ( OSCCONbits.PBDIVRDY == 0 ); // [TODO]       Too dangerous!!! The uC may get stuck here
-                                        // [WORKAROUND] Insert a counter
-    
-    /* PBCLK is SYSCLK divided by 1 */
-    OSCCONbits.PBDIV    =   0b00;
-    
-    /* Device will enter Idle mode when a WAIT instruction is executed */
-    OSCCONbits.SLPEN    =   0UL;    
-    
-    SYSKEY  =    0x33333333;    // Force lock
-}
-
-
-
 /**
  * @brief       void conf_GPIO  ( void )
  * @details     It configures GPIO to work with the LEDs.
@@ -99,33 +47,42 @@ void conf_GPIO  ( void )
 
 
 /**
- * @brief       void conf_Timers  ( void )
+ * @brief       uint8_t conf_Timers  ( uint32_t f_pb )
  * @details     It configures the Timers.
  *              
  *              Timer1:
- *                  - Prescaler: 256 (f_timer = 8MHz/256 = 31250Hz)
- *                  - Overflow: 1s ( 31250 * ( 1 / 31250Hz ) = 1s )
+ *                  - Prescaler: 256 (f_timer = f_pb/256, e.g. 12MHz/256 = 46875Hz)
+ *                  - Overflow: 1s ( PR1 + 1 = 46875 counts, 46875 * ( 1 / 46875Hz ) = 1s )
  *                  - Interrupt enabled
  *
- * @param[in]    N/A.
+ * @param[in]    f_pb:  PBCLK in use ( sysclk_pb_hz() ), 256Hz to 16.77MHz ( PR1 + 1 <= 65536 ).
  *
  * @param[out]   N/A.
  *
  *
- * @return      N/A
+ * @return      1: Timer1 running, 0: f_pb out of range, Timer1 is left off
  *
  * @author      Manuel Caballero
  * @date        02/December/2021
- * @version     08/December/2021      The Timer1 was set to overflow at 1s
+ * @version     18/October/2026       PR1 = period - 1, f_pb range checked
+ *              18/October/2026       Period from the PBCLK in use ( f_pb )
+ *              18/October/2026       Priority and multi-vector mode moved to intmap_init() ( INTMAP_T1 )
+ *              08/December/2021      The Timer1 was set to overflow at 1s
  *              02/December/2021      The ORIGIN
  * @pre         N/A
  * @warning     N/A
  */
-void conf_Timers  ( void )
+uint8_t conf_Timers  ( uint32_t f_pb )
 {
     /* Disable Timer 1  */
     T1CONbits.ON     =   0UL;
     
+    /* 1s in 1:256 counts must fit in PR1 ( the period is PR1 + 1 )   */
+    if ( ( ( f_pb / 256UL ) == 0UL ) || ( ( f_pb / 256UL ) > 65536UL ) )
+    {
+        return 0U;
+    }
+    
     /* Continue operation even in Idle mode */
     T1CONbits.SIDL   =   0UL;
     
@@ -147,14 +104,10 @@ void conf_Timers  ( void )
     /* Clear time register  */
     TMR1     =   0UL;
     
-    /* Load period register */
-    PR1  =   31250UL;
-    
-    /* Timer1: Interrupt priority is 3   */
-    IPC1bits.T1IP   =   0b011;
+    /* Load period register: The period is PR1 + 1 counts */
+    PR1  =   ( f_pb / 256UL ) - 1UL;
     
-    /* Timer1: Interrupt subpriority is 1   */
-    IPC1bits.T1IS   =   0b01;
+    /* Timer1: Interrupt priority and subpriority, intmap_init() ( INTMAP_T1, interrupts.h )   */
     
     /* Clear the Timer1 interrupt status flag ( T1IF )     */
     IFS0CLR  =   0x00000010;
@@ -162,9 +115,8 @@ void conf_Timers  ( void )
     /* Enable Timer1 interrupts ( T1IE )     */
     IEC0SET  =   0x00000010;
     
-    /* Interrupt controller configured for multivectored vectored mode     */
-    INTCONbits.MVEC =   1UL;
-    
     /* Enable Timer 1  */
     T1CONbits.ON     =   1UL;
+    
+    return 1U;
 }
\ No newline at end of file
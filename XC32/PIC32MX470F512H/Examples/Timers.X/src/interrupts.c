@@ -22,11 +22,12 @@
  *
  * @author      Manuel Caballero
  * @date        08/December/2021
- * @version     08/December/2021   The ORIGIN
+ * @version     18/October/2026    IPL7SRS: Priority and context from the map ( INTMAP_T1 )
+ *              08/December/2021   The ORIGIN
  * @pre         N/A.
  * @warning     N/A
  */
-void __attribute__ ( ( vector(_TIMER_1_VECTOR), interrupt(IPL3SOFT) ) ) T1Handler ( void )
+void INTMAP_ISR( T1 ) T1Handler ( void )
 {
     /* Execute new action    */
     changeLEDstate   =   1UL;
@@ -0,0 +1,50 @@
+/**
+ * @brief       intmap.c
+ * @details     Interrupt priority map and shadow register set ( SRS ) assignment sources ( PIC32MX ).
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero (aqueronteblog@gmail.com)
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+#include "../inc/interrupts.h"
+
+
+/**@brief Constants.
+ */
+#define INTMAP_X_INIT( name, ip, is )   \
+    (ip)    =   INTMAP_PRIO( name );    \
+    (is)    =   INTMAP_SUBPRIO( name );
+
+
+
+/**
+ * @brief       void intmap_init ( void )
+ * @details     It programs the priority and the sub-priority of every vector of INTMAP_TABLE( X ) and
+ *              configures the interrupt controller for the multi-vector mode.
+ *
+ *
+ * @param[in]    N/A.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         It must be called before the interrupts are enabled.
+ * @warning     N/A
+ */
+void intmap_init ( void )
+{
+    /* Priority and sub-priority of every vector    */
+    INTMAP_TABLE( INTMAP_X_INIT )
+
+    /* Interrupt controller configured for multivectored vectored mode     */
+    INTCONbits.MVEC =   1UL;
+}
@@ -0,0 +1,221 @@
+/**
+ * @brief       sysclk.c
+ * @details     System clock and performance configuration sources ( PIC32MX470 ).
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero (aqueronteblog@gmail.com)
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+#include "../inc/sysclk.h"
+
+
+/**@brief Constants.
+ */
+#define SYSCLK_LOG2( x )    ( ( (x) >= 256UL ) ? 7UL : ( (x) >= 64UL ) ? 6UL : ( (x) >= 32UL ) ? 5UL : ( (x) >= 16UL ) ? 4UL :  \
+                              ( (x) >= 8UL ) ? 3UL : ( (x) >= 4UL ) ? 2UL : ( (x) >= 2UL ) ? 1UL : 0UL )
+
+#define SYSCLK_MUL_CODE     ( ( SYSCLK_PLL_MUL == 24UL ) ? 7UL : ( SYSCLK_PLL_MUL - 15UL ) )
+#define SYSCLK_ODIV_CODE    SYSCLK_LOG2( SYSCLK_PLL_ODIV )
+#define SYSCLK_PBDIV_CODE   SYSCLK_LOG2( SYSCLK_PB_DIV )
+
+#if ( SYSCLK_SOURCE == SYSCLK_POSC )
+#define SYSCLK_NOSC         0b011               /*!<   Primary oscillator with PLL     */
+#else
+#define SYSCLK_NOSC         0b001               /*!<   FRC with PLL                    */
+#endif
+
+static const uint16_t   myDiv[8]    =   { 1U, 2U, 4U, 8U, 16U, 32U, 64U, 256U };       /*!<   PLLODIV, FRCDIV codes    */
+static const uint8_t    myMul[8]    =   { 15U, 16U, 17U, 18U, 19U, 20U, 21U, 24U };    /*!<   PLLMULT codes            */
+static const uint8_t    myIdiv[8]   =   { 1U, 2U, 3U, 4U, 5U, 6U, 10U, 12U };          /*!<   FPLLIDIV codes           */
+
+
+/**@brief Variables.
+ */
+static uint32_t     myF_sys =   SYSCLK_FRC_HZ / 2UL;    /*!<   SYSCLK in use ( reset: FRCDIV, FRC/2 )  */
+static uint32_t     myF_pb  =   SYSCLK_FRC_HZ / 2UL;    /*!<   PBCLK in use                            */
+
+
+
+/**
+ * @brief       uint8_t sysclk_init ( void )
+ * @details     It configures the flash wait states, the prefetch cache and the KSEG0 cache for SYSCLK_HZ, then
+ *              it switches the system clock to the PLL and sets the PBCLK divider.
+ *
+ *                  - SYSCLK = SYSCLK_HZ, PBCLK = SYSCLK_PB_HZ
+ *
+ *
+ * @param[in]    N/A.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      1: SYSCLK_HZ in use, 0: Timeout, the clock did not switch or the PLL did not lock
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         It is called once, from the reset clock ( FRCDIV ).
+ * @warning     Interrupts are disabled while the clock is switched. sysclk_sys_hz() and sysclk_pb_hz() give the
+ *              clocks in use either way.
+ */
+uint8_t sysclk_init ( void )
+{
+    uint32_t    s       =   0UL;
+    uint32_t    t       =   0UL;
+    uint8_t     done    =   0U;
+
+    s   =   __builtin_disable_interrupts ();
+
+    /* Flash wait states for the new SYSCLK, prefetch enabled for cacheable and non-cacheable regions   */
+    CHECONbits.PFMWS    =   SYSCLK_FLASH_WS;
+    CHECONbits.PREFEN   =   0b11;
+
+    /* Data RAM: No wait state   */
+    BMXCONbits.BMXWSDRM =   0UL;
+
+    /* KSEG0 cacheable ( K0 = 3 )    */
+    _CP0_SET_CONFIG ( ( _CP0_GET_CONFIG () & ~0x00000007UL ) | 0x00000003UL );
+
+    SYSKEY  =    0x00000000;    // Force lock
+    SYSKEY  =    0xAA996655;    // Unlock registers
+    SYSKEY  =    0x556699AA;
+
+    /* PBCLK divider, before SYSCLK goes up  */
+    for ( t = 0UL; ( OSCCONbits.PBDIVRDY == 0UL ) && ( t < SYSCLK_TIMEOUT ); t++ );
+    OSCCONbits.PBDIV    =   SYSCLK_PBDIV_CODE;
+
+    /* PLL: Multiplier, output divider and source    */
+    OSCCONbits.PLLMULT  =   SYSCLK_MUL_CODE;
+    OSCCONbits.PLLODIV  =   SYSCLK_ODIV_CODE;
+    OSCCONbits.NOSC     =   SYSCLK_NOSC;
+
+    /* Initiates an oscillator switch to a selection specified by the NOSC[2:0] bits     */
+    OSCCONbits.OSWEN    =   1UL;
+
+    /* Wait until oscillator switch is complete and the PLL is locked, bounded  */
+    for ( t = 0UL; ( OSCCONbits.OSWEN == 1UL ) && ( t < SYSCLK_TIMEOUT ); t++ );
+    for ( t = 0UL; ( OSCCONbits.SLOCK == 0UL ) && ( t < SYSCLK_TIMEOUT ); t++ );
+
+    /* Device will enter Idle mode when a WAIT instruction is executed */
+    OSCCONbits.SLPEN    =   0UL;
+
+    SYSKEY  =    0x33333333;    // Force lock
+
+    if ( ( OSCCONbits.COSC == SYSCLK_NOSC ) && ( OSCCONbits.SLOCK == 1UL ) )
+    {
+        done    =   1U;
+    }
+
+    /* Publish the clocks in use     */
+    sysclk_update ();
+
+    if ( ( s & 0x00000001UL ) != 0UL )
+    {
+        __builtin_enable_interrupts ();
+    }
+
+    return done;
+}
+
+
+/**
+ * @brief       void sysclk_update ( void )
+ * @details     It reads the clocks in use back from OSCCON and the configuration bits.
+ *
+ *
+ * @param[in]    N/A.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         It must be called after any clock switch which is not done by sysclk_init().
+ * @warning     FRC and POSC are taken as their nominal values ( SYSCLK_FRC_HZ, SYSCLK_POSC_HZ ).
+ */
+void sysclk_update ( void )
+{
+    uint32_t    f   =   0UL;
+
+    switch ( OSCCONbits.COSC )
+    {
+        case 0b001:
+            /* FRC with PLL  */
+            f   =   ( ( SYSCLK_FRC_HZ / myIdiv[DEVCFG2bits.FPLLIDIV] ) * myMul[OSCCONbits.PLLMULT] ) / myDiv[OSCCONbits.PLLODIV];
+            break;
+
+        case 0b010:
+            /* Primary oscillator    */
+            f   =   SYSCLK_POSC_HZ;
+            break;
+
+        case 0b011:
+            /* Primary oscillator with PLL   */
+            f   =   ( ( SYSCLK_POSC_HZ / myIdiv[DEVCFG2bits.FPLLIDIV] ) * myMul[OSCCONbits.PLLMULT] ) / myDiv[OSCCONbits.PLLODIV];
+            break;
+
+        case 0b100:
+            /* Secondary oscillator  */
+            f   =   32768UL;
+            break;
+
+        case 0b101:
+            /* Low-Power RC  */
+            f   =   31250UL;
+            break;
+
+        case 0b110:
+            /* FRC divided by 16     */
+            f   =   SYSCLK_FRC_HZ / 16UL;
+            break;
+
+        case 0b111:
+            /* FRC divided by FRCDIV     */
+            f   =   SYSCLK_FRC_HZ / myDiv[OSCCONbits.FRCDIV];
+            break;
+
+        default:
+            /* FRC   */
+            f   =   SYSCLK_FRC_HZ;
+            break;
+    }
+
+    myF_sys =   f;
+    myF_pb  =   f >> OSCCONbits.PBDIV;
+}
+
+
+/**
+ * @brief       uint32_t sysclk_sys_hz ( void ), uint32_t sysclk_pb_hz ( void )
+ * @details     SYSCLK and PBCLK in use, Hz.
+ *
+ *
+ * @param[in]    N/A.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      The clock in Hz
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+uint32_t sysclk_sys_hz ( void )
+{
+    return myF_sys;
+}
+
+uint32_t sysclk_pb_hz ( void )
+{
+    return myF_pb;
+}
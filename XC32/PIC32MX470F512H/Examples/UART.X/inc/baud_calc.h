@@ -0,0 +1,130 @@
+/**
+ * @brief       baud_calc.h
+ * @details     Baud rate generator solver header ( PIC32MX: UARTx ).
+ *
+ *              baud = PBCLK / ( m*( UxBRG + 1 ) ), candidates in order:
+ *
+ *                  - 0: BRGH = 0:   m = 16, Standard speed ( 16x baud clock )
+ *                  - 1: BRGH = 1:   m = 4,  High speed ( 4x baud clock )
+ *
+ *              Every candidate takes the UxBRG ( 16-bit ) with the lower error of PBCLK/( m*baud ) rounded down and
+ *              up ( the nearest one is not always the best, the error is relative to the divider ), the candidate
+ *              with the lowest error is kept, ties go to BRGH = 0: The receiver takes three samples per bit, it
+ *              copes better with noise. The error is given in 0.01% of the baud rate:
+ *
+ *                  error = | PBCLK - m*( UxBRG + 1 )*baud | / ( m*( UxBRG + 1 )*baud )
+ *
+ *                  - BAUD_CALC_UART_DEFINE( name, f_pb, baud ): Compile time. The search is unrolled into the
+ *                    enumerators of name ( name_BRGH, name_BRG, name_ERROR ), the build fails ( negative array
+ *                    size ) if the error is above BAUD_CALC_ERR_MAX.
+ *                  - baud_calc_uart(): The same search at run time, for the PBCLK in use ( sysclk_pb_hz() ).
+ *
+ *              BAUD_CALC_ERR_MAX: The receiver samples the middle of the bits, a 10-bit frame ( 8N1 ) drifts half
+ *              a bit at 5%, shared by both ends: 2.5% each by default.
+ *
+ *              Example: 115200 baud at PBCLK = 48MHz
+ *
+ *                  BAUD_CALC_UART_DEFINE( myBaud, 48000000UL, 115200UL );
+ *
+ *                  U1MODEbits.BRGH     =   myBaud_BRGH;
+ *                  U1BRG               =   myBaud_BRG;
+ *
+ *              Result: BRGH = 0, U1BRG = 25 ( 115385 baud, error 16: 0.16%, BRGH = 1 is not better ).
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero (aqueronteblog@gmail.com)
+ * @date        18/October/2026
+ * @version     18/October/2026    UxBRG rounded down or up, the one with the lower error
+ *              18/October/2026    The ORIGIN
+ * @pre         baud >= 25 and PBCLK <= 100MHz ( 32-bit arithmetic ).
+ * @warning     N/A
+ */
+#ifndef BAUD_CALC_H_
+#define BAUD_CALC_H_
+
+#include <stdint.h>
+#include "board.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**@brief Constants.
+ */
+#ifndef BAUD_CALC_ERR_MAX
+#define BAUD_CALC_ERR_MAX   250U        /*!<   Max. error, 0.01%: 2.50%                                 */
+#endif
+
+#define BAUD_CALC_NONE      0x7FFF      /*!<   Error of a candidate which is 25% off or more            */
+
+/**@brief UxBRG + 1 for a divider m, rounded down and up, 1 to max.
+ */
+#define BAUD_CALC_CLAMP( n, max )           ( ( (n) == 0UL ) ? 1UL : ( (n) > (uint32_t)(max) ) ? (uint32_t)(max) : (n) )
+#define BAUD_CALC_N_LO( f, baud, m, max )   BAUD_CALC_CLAMP( ( (uint32_t)(f) / ( (uint32_t)(m) * (uint32_t)(baud) ) ), max )
+#define BAUD_CALC_N_HI( f, baud, m, max )   BAUD_CALC_CLAMP( ( (uint32_t)(f) / ( (uint32_t)(m) * (uint32_t)(baud) ) + 1UL ), max )
+
+/**@brief Error in 0.01% of the clock a divider needs ( mnb = m*( UxBRG + 1 )*baud ): Its distance to f over mnb.
+ */
+#define BAUD_CALC_DIFF( f, mnb )            ( ( (uint32_t)(f) > (uint32_t)(mnb) ) ? ( (uint32_t)(f) - (uint32_t)(mnb) ) : ( (uint32_t)(mnb) - (uint32_t)(f) ) )
+#define BAUD_CALC_ERR_MNB( f, mnb )         ( ( ( BAUD_CALC_DIFF( f, mnb ) * 4UL ) >= (uint32_t)(mnb) ) ? BAUD_CALC_NONE : \
+                                              (int)( ( BAUD_CALC_DIFF( f, mnb ) * 100UL ) / ( (uint32_t)(mnb) / 100UL ) ) )
+
+/**@brief UxBRG + 1 for a divider m: The lower error of both, ties go to the one rounded down. Its error.
+ */
+#define BAUD_CALC_N( f, baud, m, max )      ( ( BAUD_CALC_ERR_MNB( f, (uint32_t)(m) * BAUD_CALC_N_HI( f, baud, m, max ) * (uint32_t)(baud) ) < \
+                                                BAUD_CALC_ERR_MNB( f, (uint32_t)(m) * BAUD_CALC_N_LO( f, baud, m, max ) * (uint32_t)(baud) ) ) ? \
+                                              BAUD_CALC_N_HI( f, baud, m, max ) : BAUD_CALC_N_LO( f, baud, m, max ) )
+#define BAUD_CALC_ERR( f, baud, m, max )    BAUD_CALC_ERR_MNB( f, (uint32_t)(m) * BAUD_CALC_N( f, baud, m, max ) * (uint32_t)(baud) )
+
+/**@brief Search step k: error of the candidate, lowest error and best candidate so far.
+ */
+#define BAUD_CALC_FIRST( name, err )            name##_e0 = (err), name##_m0 = name##_e0, name##_c0 = 0
+#define BAUD_CALC_STEP( name, k, prev, err )    name##_e##k = (err), \
+                                                name##_m##k = ( name##_e##k < name##_m##prev ) ? name##_e##k : name##_m##prev, \
+                                                name##_c##k = ( name##_e##k < name##_m##prev ) ? k : name##_c##prev
+
+/**@brief Divider of candidate k, UxBRG + 1 max.
+ */
+#define BAUD_CALC_M( k )        ( ( (k) == 0 ) ? 16UL : 4UL )
+#define BAUD_CALC_MAX           65536UL
+
+
+/**@brief UARTx: name_BRGH ( UxMODE ), name_BRG ( UxBRG ) and name_ERROR ( 0.01% ).
+ */
+#define BAUD_CALC_UART_DEFINE( name, f_pb, baud )    \
+    enum{ \
+        BAUD_CALC_FIRST( name, BAUD_CALC_ERR( f_pb, baud, 16UL, BAUD_CALC_MAX ) ), \
+        BAUD_CALC_STEP( name, 1, 0, BAUD_CALC_ERR( f_pb, baud, 4UL, BAUD_CALC_MAX ) ), \
+        name##_BRGH     = name##_c1, \
+        name##_BRG      = (int)( BAUD_CALC_N( f_pb, baud, BAUD_CALC_M( name##_c1 ), BAUD_CALC_MAX ) - 1UL ), \
+        name##_ERROR    = name##_m1 \
+    }; \
+    typedef char name##_baud_error[ ( name##_m1 <= (int)BAUD_CALC_ERR_MAX ) ? 1 : -1 ]
+
+
+/**@brief Settings worked out at run time.
+ */
+typedef struct{
+  uint8_t   brgh;           /*!<   UxMODE.BRGH                  */
+  uint16_t  brg;            /*!<   UxBRG                        */
+  uint16_t  error;          /*!<   Error, 0.01%                 */
+} baud_calc_uart_t;
+
+
+/**@brief Function prototypes.
+ */
+uint8_t baud_calc_uart      ( uint32_t f_pb, uint32_t baud, baud_calc_uart_t* cfg );
+
+
+/**@brief Variables.
+ */
+
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BAUD_CALC_H_ */
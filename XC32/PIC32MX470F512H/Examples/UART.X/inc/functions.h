@@ -6,11 +6,17 @@
  *
  * @author      Manuel Caballero
  * @date        27/February/2022
- * @version     27/February/2022   The ORIGIN
+ * @version     18/October/2026    conf_UART1() solves the baud rate ( baud_calc.h ) and reports the error
+ *              18/October/2026    uart1_write() moved to the FIFO driver ( uart1.h )
+ *              18/October/2026    conf_CLK() replaced by sysclk_init() ( sysclk.h )
+ *              18/October/2026    uart1_write()
+ *              27/February/2022   The ORIGIN
  * @pre         N/A
  * @warning     N/A
  */
 #include "board.h"
+#include "uart1.h"
+#include "baud_calc.h"
  
 
 #ifndef FUNCTION_H_
@@ -23,9 +29,8 @@ extern "C" {
 
 /**@brief Function prototypes.
  */
-void conf_CLK   ( void );
-void conf_GPIO  ( void );
-void conf_UART1 ( uint32_t f_pb, uint32_t baudrate );
+void    conf_GPIO  ( void );
+uint8_t conf_UART1 ( uint32_t f_pb, uint32_t baudrate );
 
 /**@brief Constants.
  */
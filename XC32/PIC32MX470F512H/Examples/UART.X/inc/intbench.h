@@ -0,0 +1,105 @@
+/**
+ * @brief       intbench.h
+ * @details     Interrupt entry microbenchmark header: SOFT vs SRS vs AUTO context ( intmap.h ).
+ *
+ *              Three vectors with no pin in use by the board ( INT0, INT1 and INT2 ) are triggered by software,
+ *              one per context:
+ *
+ *                  - INT0: IPL6SOFT
+ *                  - INT1: IPL7SRS  ( INTMAP_SRS_IPL )
+ *                  - INT2: IPL7AUTO ( shadow set in use: AUTO - SRS = cost of the SRSCtl check )
+ *
+ *              Each run reads the CP0 Count register, sets the flag ( IFS0SET ) and the handler reads Count as
+ *              its first statement: the result is the time from the flag write to the first instruction of the
+ *              handler body, prologue included. Every handler calls a function, so the SOFT prologue saves the
+ *              caller-saved registers the same way a real handler does ( e.g. U1Handler ).
+ *
+ *              Count runs at SYSCLK/2: the results are in SYSCLK cycles, 2 cycles resolution. The first run of
+ *              each vector warms up the prefetch cache and is not counted, min and max of INTBENCH_RUNS runs.
+ *
+ *              Opt-in: With INTBENCH_ENABLE = 0 ( default ) the vectors are not in the map and intbench.c is empty.
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero (aqueronteblog@gmail.com)
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         FSRSSEL = PRIORITY_7 ( variables.h ).
+ * @warning     An edge on the INT0 pin ( or INT1/INT2 if they are mapped ) during the benchmark spoils the max.
+ */
+#ifndef INTBENCH_H_
+#define INTBENCH_H_
+
+#include <stdint.h>
+#include "board.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**@brief Constants.
+ */
+#ifndef INTBENCH_ENABLE
+#define INTBENCH_ENABLE     0U          /*!<   1: Benchmark compiled in    */
+#endif
+
+#ifndef INTBENCH_RUNS
+#define INTBENCH_RUNS       16U         /*!<   Runs per context    */
+#endif
+
+typedef enum{
+  INTBENCH_SOFT     = 0U,               /*!<   INT0, IPL6SOFT   */
+  INTBENCH_SRS      = 1U,               /*!<   INT1, IPL7SRS    */
+  INTBENCH_AUTO     = 2U,               /*!<   INT2, IPL7AUTO   */
+  INTBENCH_MODES    = 3U
+} intbench_mode_t;
+
+
+/**@brief Vectors of the benchmark: INTMAP_name and INTBENCH_TABLE( X ), appended to INTMAP_TABLE( X ).
+ */
+#if ( INTBENCH_ENABLE == 1U )
+#define INTMAP_BSOFT    ( _EXTERNAL_0_VECTOR, 6, 0, SOFT )
+#define INTMAP_BSRS     ( _EXTERNAL_1_VECTOR, 7, 0, SRS  )
+#define INTMAP_BAUTO    ( _EXTERNAL_2_VECTOR, 7, 0, AUTO )
+
+#define INTBENCH_TABLE( X )                             \
+    X( BSOFT, IPC0bits.INT0IP, IPC0bits.INT0IS )        \
+    X( BSRS,  IPC1bits.INT1IP, IPC1bits.INT1IS )        \
+    X( BAUTO, IPC2bits.INT2IP, IPC2bits.INT2IS )
+#else
+#define INTBENCH_TABLE( X )
+#endif
+
+
+/**@brief Results, SYSCLK cycles.
+ */
+typedef struct{
+  uint32_t  min[INTBENCH_MODES];
+  uint32_t  max[INTBENCH_MODES];
+} intbench_result_t;
+
+
+/**@brief Write function of the report, e.g. uart1_write(). It returns how many bytes were taken.
+ */
+typedef uint8_t ( *intbench_write_t )( const uint8_t* data, uint8_t length );
+
+
+/**@brief Function prototypes.
+ */
+#if ( INTBENCH_ENABLE == 1U )
+void intbench_run       ( intbench_result_t* result );
+void intbench_report    ( const intbench_result_t* result, intbench_write_t write );
+#endif
+
+
+/**@brief Variables.
+ */
+
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INTBENCH_H_ */
@@ -7,16 +7,41 @@
  *
  * @author      Manuel Caballero
  * @date        27/February/2022
- * @version     27/February/2022   The ORIGIN
+ * @version     18/October/2026    DMA back end vectors ( UART1_DMA_TABLE, UART1_MODE_DMA )
+ *              18/October/2026    UART1 FIFO driver: EVT_RX per burst, myPtr removed
+ *              18/October/2026    Priority map ( intmap.h ): UART1 at IPL7 with the shadow register set
+ *              18/October/2026    ISR latency instrumentation ( ilat.h, ILAT_ENABLE )
+ *              18/October/2026    Rx bytes posted to the event queue
+ *              27/February/2022   The ORIGIN
  * @pre         N/A
  * @warning     N/A
  */
 
 #include "board.h"
+#include "evq.h"
+#include "uart1.h"
+#include "ilat.h"
+#include "intbench.h"
 
 #ifndef INTERRUPTS_H_
 #define INTERRUPTS_H_
 
+
+/**@brief Priority map ( intmap.h ): ( vector, priority, sub-priority, context ).
+ *
+ *        UART1 is the only vector of the example: It takes the shadow register set ( IPL7, FSRSSEL ), every Rx
+ *        and Tx interrupt enters without any context saving. The DMA channels of the UART1 are added with
+ *        UART1_MODE_DMA ( uart1.h ), the benchmark vectors if INTBENCH_ENABLE is 1.
+ */
+#define INTMAP_U1       ( _UART_1_VECTOR, 7, 1, SRS )
+
+#define INTMAP_TABLE( X )                               \
+    X( U1,    IPC7bits.U1IP,   IPC7bits.U1IS )          \
+    UART1_DMA_TABLE( X )                                \
+    INTBENCH_TABLE( X )
+
+#include "intmap.h"
+
 #ifdef __cplusplus
 extern "C" {
 #endif
@@ -24,18 +49,26 @@ extern "C" {
 
 /**@brief Subroutine prototypes.
  */
+void uart1_rx_event ( uint32_t count );
 
 
 
 /**@brief Constants.
  */
+typedef enum{
+  EVT_RX    = 1U        /*!<   Bytes received ( uart1_read() ), data: how many    */
+} my_evt_t;
+
+typedef enum{
+  ILAT_U1RX = 0U,       /*!<   ilat.h source: U1Handler, Rx    */
+  ILAT_U1TX = 1U        /*!<   ilat.h source: U1Handler, Tx    */
+} my_ilat_t;
 
 
 
 /**@brief Variables.
  */
-extern volatile uint32_t myState;
-extern volatile uint8_t  *myPtr;
+extern evq_t             myEvents;
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,132 @@
+/**
+ * @brief       intmap.h
+ * @details     Interrupt priority map and shadow register set ( SRS ) assignment header ( PIC32MX ).
+ *
+ *              Every vector of the example is described once ( interrupts.h ): INTMAP_name gives its vector,
+ *              priority, sub-priority and how its context is saved, INTMAP_TABLE( X ) lists the vectors with their
+ *              IPCx fields:
+ *
+ *                  - SOFT: The compiler saves the registers the handler uses on the stack ( and every
+ *                          caller-saved register if the handler calls a function ).
+ *                  - SRS:  The core switches to the shadow register set, nothing is saved. The PIC32MX470 has
+ *                          one shadow set, given to a single priority level by the FSRSSEL configuration bits
+ *                          ( variables.h ): only the vectors at INTMAP_SRS_IPL may use it.
+ *                  - AUTO: The prologue reads SRSCtl and saves the registers only if the shadow set is not in
+ *                          use, for handlers whose level is not known at build time.
+ *
+ *              The hottest vectors go to INTMAP_SRS_IPL with SRS, the others get SOFT at a lower level.
+ *
+ *              INTMAP_name: ( vector, priority, sub-priority, context )
+ *
+ *                  - priority:     1 to 7, a plain digit ( it is pasted into IPLn<context> ).
+ *                  - sub-priority: 0 to 3, order of the vectors of the same priority pending together.
+ *                  - context:      SOFT, SRS or AUTO.
+ *
+ *              The handlers are declared with INTMAP_ISR( name ). intmap_init() programs every priority and
+ *              sub-priority and selects the multi-vector mode. The build fails if a priority or a sub-priority
+ *              is out of range or SRS is used at another level.
+ *
+ *              Example ( interrupts.h ):
+ *
+ *                  #define INTMAP_U1   ( _UART_1_VECTOR,  7, 1, SRS  )
+ *                  #define INTMAP_T1   ( _TIMER_1_VECTOR, 3, 1, SOFT )
+ *
+ *                  #define INTMAP_TABLE( X ) \
+ *                      X( U1, IPC7bits.U1IP, IPC7bits.U1IS )   \
+ *                      X( T1, IPC1bits.T1IP, IPC1bits.T1IS )
+ *
+ *                  #include "intmap.h"
+ *
+ *              interrupts.c:
+ *
+ *                  void INTMAP_ISR( U1 ) U1Handler ( void ) { ... }
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero (aqueronteblog@gmail.com)
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         INTMAP_TABLE( X ) must be defined before this header is included.
+ * @warning     INTMAP_SRS_IPL must match the FSRSSEL configuration bits.
+ */
+#ifndef INTMAP_H_
+#define INTMAP_H_
+
+#include "board.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**@brief Constants.
+ */
+#ifndef INTMAP_TABLE
+#error "INTMAP_TABLE( X ) must be defined before intmap.h is included"
+#endif
+
+#ifndef INTMAP_SRS_IPL
+#define INTMAP_SRS_IPL  7               /*!<   Priority of the shadow register set ( FSRSSEL = PRIORITY_7 )     */
+#endif
+
+#define INTMAP_CTX_SOFT 0               /*!<   Context codes, build-time checks only    */
+#define INTMAP_CTX_SRS  1
+#define INTMAP_CTX_AUTO 2
+
+
+/**@brief Fields of INTMAP_name.
+ */
+#define INTMAP_APPLY( m, args )                 m args
+#define INTMAP_GET_IPL_( vector, ipl, isl, ctx )    ( ipl )
+#define INTMAP_GET_ISL_( vector, ipl, isl, ctx )    ( isl )
+#define INTMAP_GET_CTX_( vector, ipl, isl, ctx )    INTMAP_CTX_##ctx
+
+#define INTMAP_PRIO( name )     INTMAP_APPLY( INTMAP_GET_IPL_, INTMAP_##name )
+#define INTMAP_SUBPRIO( name )  INTMAP_APPLY( INTMAP_GET_ISL_, INTMAP_##name )
+#define INTMAP_CTX( name )      INTMAP_APPLY( INTMAP_GET_CTX_, INTMAP_##name )
+
+
+/**@brief Vector indices: INTMAP_ID_name, INTMAP_COUNT vectors.
+ */
+#define INTMAP_X_ID( name, ip, is )     INTMAP_ID_##name,
+
+enum{
+  INTMAP_TABLE( INTMAP_X_ID )
+  INTMAP_COUNT
+};
+
+
+/**@brief Build-time checks.
+ */
+#define INTMAP_X_ASSERT( name, ip, is )                                                                         \
+    typedef char intmap_ipl_##name[ ( ( INTMAP_PRIO( name ) >= 1 ) && ( INTMAP_PRIO( name ) <= 7 ) ) ? 1 : -1 ];  \
+    typedef char intmap_isl_##name[ ( INTMAP_SUBPRIO( name ) <= 3 ) ? 1 : -1 ];                                 \
+    typedef char intmap_srs_##name[ ( ( INTMAP_CTX( name ) != INTMAP_CTX_SRS ) || ( INTMAP_PRIO( name ) == INTMAP_SRS_IPL ) ) ? 1 : -1 ];
+
+INTMAP_TABLE( INTMAP_X_ASSERT )
+
+
+/**@brief Handler attribute: vector and IPLn<context> of INTMAP_name.
+ */
+#define INTMAP_IPL__( ipl, ctx )    IPL##ipl##ctx
+#define INTMAP_IPL_( ipl, ctx )     INTMAP_IPL__( ipl, ctx )
+#define INTMAP_ATTR_( vec, ipl, isl, ctx )  __attribute__ ( ( vector( vec ), interrupt( INTMAP_IPL_( ipl, ctx ) ) ) )
+
+#define INTMAP_ISR( name )      INTMAP_APPLY( INTMAP_ATTR_, INTMAP_##name )
+
+
+/**@brief Function prototypes.
+ */
+void intmap_init    ( void );
+
+
+/**@brief Variables.
+ */
+
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* INTMAP_H_ */
@@ -0,0 +1,204 @@
+/**
+ * @brief       uart1.h
+ * @details     UART1 FIFO driver header ( PIC32MX ). Interrupt-driven transmission and reception through ring
+ *              buffers, the 8-deep hardware FIFOs are moved in bursts.
+ *
+ *                  - Tx: uart1_write() copies into the Tx ring buffer. The Tx interrupt refills the hardware FIFO
+ *                        while it has room ( UTXBF = 0 ): With UART1_TXISEL = 0b10 there is one interrupt every
+ *                        8 characters instead of one per character.
+ *                  - Rx: The Rx interrupt drains the hardware FIFO while there is data ( URXDA = 1 ) into the Rx
+ *                        ring buffer and calls the notify function ( optional ) once, with how many bytes came in.
+ *                        uart1_read() takes them out.
+ *
+ *              Interrupt thresholds ( U1STA ):
+ *
+ *                  - UART1_TXISEL: 0b00 At least one free space, 0b01 All characters sent ( shift register
+ *                                  included ), 0b10 Tx FIFO empty ( default ).
+ *                  - UART1_RXISEL: 0b00 Not empty ( default ), 0b01 Half full ( 4 ), 0b10 3/4 full ( 6 ).
+ *
+ *              With UART1_RXISEL 0b01 or 0b10 the last bytes of a burst stay in the hardware FIFO below the
+ *              threshold: uart1_read() drains it too, so it must be polled ( e.g. from a periodic timer event ).
+ *              A console which waits in Idle mode for every command ( main.c ) keeps 0b00.
+ *
+ *              An overrun ( OERR ) discards the hardware FIFO and is counted, so is every byte which did not fit
+ *              into the Rx ring buffer.
+ *
+ *              UART1_MODE selects the back end, same API:
+ *
+ *                  - UART1_MODE_ISR ( default, uart1.c ): The CPU moves every byte ( U1Handler ).
+ *                  - UART1_MODE_DMA ( uart1dma.c ): The DMA moves every byte, the CPU gets one interrupt per block.
+ *                        Tx: DMA channel 0 sends the Tx ring buffer and the descriptors of uart1_tx_submit()
+ *                            straight from the caller buffers ( zero-copy, RAM or flash ), in the order they were
+ *                            queued. Rx: DMA channel 1 fills a circular buffer ( UART1_DMA_RX_SIZE ) and its
+ *                            interrupt moves every block into the Rx ring buffer:
+ *
+ *                            - UART1_DMA_RX_PATTERN = a character: A block ends with it ( e.g. '\r', one
+ *                              interrupt per line ) or when the buffer is full.
+ *                            - UART1_DMA_RX_PATTERN = UART1_DMA_NO_PATTERN: Half and full buffer interrupts, for
+ *                              continuous streams. The bytes of an incomplete half are held back until it fills.
+ *
+ *                        The thresholds are fixed: UART1_TXISEL and UART1_RXISEL 0b00, one DMA cell per character.
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero (aqueronteblog@gmail.com)
+ * @date        18/October/2026
+ * @version     18/October/2026    DMA back end ( UART1_MODE_DMA, uart1dma.c ), zero-copy Tx descriptors
+ *              18/October/2026    The ORIGIN
+ * @pre         conf_UART1() configures the peripheral, uart1_init() is called before.
+ * @warning     N/A
+ */
+#ifndef UART1_H_
+#define UART1_H_
+
+#include <stdint.h>
+#include <stddef.h>
+#include "board.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**@brief Constants.
+ */
+#define UART1_MODE_ISR          0U                              /*!<   Bytes moved by U1Handler ( uart1.c )     */
+#define UART1_MODE_DMA          1U                              /*!<   Bytes moved by the DMA ( uart1dma.c )    */
+
+#define UART1_DMA_NO_PATTERN    0xFFFFU                         /*!<   Rx DMA: Half and full buffer interrupts  */
+
+#ifndef UART1_MODE
+#define UART1_MODE              UART1_MODE_ISR                  /*!<   Back end                                 */
+#endif
+
+#ifndef UART1_TX_BUFF_SIZE
+#define UART1_TX_BUFF_SIZE      256UL                           /*!<   Tx ring buffer size, it must be a power of two    */
+#endif
+
+#if ( UART1_MODE == UART1_MODE_DMA )
+#ifndef UART1_RX_BUFF_SIZE
+#define UART1_RX_BUFF_SIZE      256UL                           /*!<   Rx ring buffer size, it must be a power of two    */
+#endif
+
+#ifndef UART1_DMA_RX_SIZE
+#define UART1_DMA_RX_SIZE       64UL                            /*!<   Rx DMA circular buffer size ( even )     */
+#endif
+
+#ifndef UART1_DMA_RX_PATTERN
+#define UART1_DMA_RX_PATTERN    '\r'                            /*!<   Rx DMA: End of block, one per line       */
+#endif
+
+#ifndef UART1_TXISEL
+#define UART1_TXISEL            0b00                            /*!<   Tx DMA cell: One free space      */
+#endif
+
+#ifndef UART1_RXISEL
+#define UART1_RXISEL            0b00                            /*!<   Rx DMA cell: Rx FIFO not empty   */
+#endif
+#else
+#ifndef UART1_RX_BUFF_SIZE
+#define UART1_RX_BUFF_SIZE      64UL                            /*!<   Rx ring buffer size, it must be a power of two    */
+#endif
+
+#ifndef UART1_TXISEL
+#define UART1_TXISEL            0b10                            /*!<   Tx interrupt: Tx FIFO empty      */
+#endif
+
+#ifndef UART1_RXISEL
+#define UART1_RXISEL            0b00                            /*!<   Rx interrupt: Rx FIFO not empty  */
+#endif
+#endif
+
+#define UART1_TX_BUFF_MASK      ( UART1_TX_BUFF_SIZE - 1UL )
+#define UART1_RX_BUFF_MASK      ( UART1_RX_BUFF_SIZE - 1UL )
+
+#define UART1_EIF               0x00000040UL                    /*!<   IFS1/IEC1: U1EIF, U1EIE          */
+#define UART1_RXIF              0x00000080UL                    /*!<   IFS1/IEC1: U1RXIF, U1RXIE        */
+#define UART1_TXIF              0x00000100UL                    /*!<   IFS1/IEC1: U1TXIF, U1TXIE        */
+
+#if ( ( UART1_TX_BUFF_SIZE & UART1_TX_BUFF_MASK ) != 0UL ) || ( ( UART1_RX_BUFF_SIZE & UART1_RX_BUFF_MASK ) != 0UL )
+#error "UART1_TX_BUFF_SIZE and UART1_RX_BUFF_SIZE must be a power of two"
+#endif
+
+#if ( UART1_TXISEL > 0b10 ) || ( UART1_RXISEL > 0b10 )
+#error "UART1_TXISEL and UART1_RXISEL: 0b00, 0b01 or 0b10"
+#endif
+
+#if ( UART1_MODE == UART1_MODE_DMA )
+#if ( UART1_TXISEL != 0b00 ) || ( UART1_RXISEL != 0b00 )
+#error "UART1_MODE_DMA: One DMA cell per character, UART1_TXISEL and UART1_RXISEL must be 0b00"
+#endif
+
+#if ( ( UART1_DMA_RX_SIZE & 1UL ) != 0UL ) || ( UART1_DMA_RX_SIZE < 2UL ) || ( UART1_DMA_RX_SIZE > 65535UL )
+#error "UART1_DMA_RX_SIZE: Even, from 2 to 65534 ( DCH1DSIZ )"
+#endif
+
+#if ( UART1_RX_BUFF_SIZE <= UART1_DMA_RX_SIZE )
+#error "UART1_RX_BUFF_SIZE must be larger than UART1_DMA_RX_SIZE: A whole block is moved at once"
+#endif
+#endif
+
+
+/**@brief Vectors of the DMA back end: INTMAP_name and UART1_DMA_TABLE( X ), appended to INTMAP_TABLE( X ).
+ *
+ *        The Rx block is copied out of the circular buffer while the DMA fills it again from the start: it takes
+ *        the highest priority ( IPL7, shadow register set ), so does the Tx block, which restarts the transmitter.
+ */
+#if ( UART1_MODE == UART1_MODE_DMA )
+#define INTMAP_U1TXDMA  ( _DMA_0_VECTOR, 7, 0, SRS )
+#define INTMAP_U1RXDMA  ( _DMA_1_VECTOR, 7, 2, SRS )
+
+#define UART1_DMA_TABLE( X )                            \
+    X( U1TXDMA, IPC10bits.DMA0IP, IPC10bits.DMA0IS )    \
+    X( U1RXDMA, IPC10bits.DMA1IP, IPC10bits.DMA1IS )
+#else
+#define UART1_DMA_TABLE( X )
+#endif
+
+
+/**@brief Rx notify function. It is called from the ISR with how many bytes were received.
+ */
+typedef void ( *uart1_rx_notify_t ) ( uint32_t count );
+
+
+/**@brief Tx descriptor ( UART1_MODE_DMA ): The data is sent from where it is, it must not change until done is 1.
+ */
+typedef struct uart1_desc_s{
+  const uint8_t*        data;           /*!<   Data to be transmitted, RAM or flash                 */
+  uint16_t              length;         /*!<   How many bytes                                       */
+  volatile uint8_t      done;           /*!<   0: Queued or being transmitted, 1: Sent              */
+  uint32_t              mark;           /*!<   Private: Tx ring buffer head when it was queued      */
+  struct uart1_desc_s*  next;           /*!<   Private: Next queued descriptor                      */
+} uart1_desc_t;
+
+
+/**@brief Function prototypes.
+ */
+void     uart1_init         ( uart1_rx_notify_t notify );
+uint8_t  uart1_write        ( const uint8_t* data, uint8_t length );
+uint8_t  uart1_read         ( uint8_t* data, uint8_t length );
+uint32_t uart1_rx_count     ( void );
+uint32_t uart1_rx_dropped   ( void );
+uint32_t uart1_tx_free      ( void );
+uint8_t  uart1_tx_busy      ( void );
+#if ( UART1_MODE == UART1_MODE_DMA )
+void     uart1_tx_submit    ( uart1_desc_t* desc );
+void     uart1_dma_tx_isr   ( void );
+void     uart1_dma_rx_isr   ( void );
+void     uart1_dma_err_isr  ( void );
+#else
+void     uart1_rx_isr       ( void );
+void     uart1_tx_isr       ( void );
+#endif
+
+
+/**@brief Variables.
+ */
+
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* UART1_H_ */
@@ -7,7 +7,8 @@
  *
  * @author      Manuel Caballero
  * @date        27/February/2022
- * @version     27/February/2022   The ORIGIN
+ * @version     18/October/2026    PLL input divider 2 and clock switching enabled ( sysclk.h )
+ *              27/February/2022   The ORIGIN
  * @pre         N/A
  * @warning     N/A
  */
@@ -42,7 +43,7 @@ extern "C" {
 #pragma config FVBUSONIO = ON           // USB VBUS ON Selection (Controlled by USB Module)
 
 // DEVCFG2
-#pragma config FPLLIDIV = DIV_12        // PLL Input Divider (12x Divider)
+#pragma config FPLLIDIV = DIV_2         // PLL Input Divider (2x Divider), SYSCLK_PLL_IDIV ( sysclk.h )
 #pragma config FPLLMUL = MUL_24         // PLL Multiplier (24x Multiplier)
 #pragma config UPLLIDIV = DIV_12        // USB PLL Input Divider (12x Divider)
 #pragma config UPLLEN = OFF             // USB PLL Enable (Disabled and Bypassed)
@@ -55,7 +56,7 @@ extern "C" {
 #pragma config POSCMOD = OFF            // Primary Oscillator Configuration (Primary osc disabled)
 #pragma config OSCIOFNC = OFF           // CLKO Output Signal Active on the OSCO Pin (Disabled)
 #pragma config FPBDIV = DIV_1           // Peripheral Clock Divisor (Pb_Clk is Sys_Clk/1)
-#pragma config FCKSM = CSDCMD           // Clock Switching and Monitor Selection (Clock Switch Disable, FSCM Disabled)
+#pragma config FCKSM = CSECMD           // Clock Switching and Monitor Selection (Clock Switch Enable, FSCM Disabled)
 #pragma config WDTPS = PS1024           // Watchdog Timer Postscaler (1:1024)
 #pragma config WINDIS = OFF             // Watchdog Timer Window Enable (Watchdog Timer is in Non-Window Mode)
 #pragma config FWDTEN = OFF             // Watchdog Timer Enable (WDT Disabled (SWDTEN Bit Controls))
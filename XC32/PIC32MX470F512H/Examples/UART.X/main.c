@@ -5,14 +5,33 @@
  *                  1 --> LED1 changes its status.
  *                  2 --> LED2 changes its status.
  *                  3 --> LED3 changes its status.
+ *                  S     --> ISR latency and duration statistics ( binary dump, tools/ilat_decode.py ), only
+ *                                if it is built with ILAT_ENABLE = 1
+ *                  B     --> Interrupt entry benchmark, SOFT vs SRS vs AUTO ( text, SYSCLK cycles ), only if it
+ *                                is built with INTBENCH_ENABLE = 1
+ *                  CR/LF --> Ignored ( line end )
  *                  Other --> All lEDs are off
  *
+ *              The UART1 driver ( uart1.h ) moves the hardware FIFOs in bursts. Every Rx interrupt posts an event
+ *              to an event queue, the main loop reads the commands in order and queues the answers in the Tx ring
+ *              buffer, so the commands sent back to back are not lost.
+ *
+ *              Built with UART1_MODE = UART1_MODE_DMA ( uart1.h ) the DMA moves the bytes instead: The commands
+ *              are taken when the line ends ( CR, UART1_DMA_RX_PATTERN ), one interrupt per line.
+ *
  *
  * @return      N/A
  *
  * @author      Manuel Caballero (aqueronteblog@gmail.com)
  * @date        27/February/2022
- * @version     27/February/2022    The ORIGIN
+ * @version     18/October/2026     UART1 baud rate solved for the PBCLK, the build fails if the error is too high
+ *              18/October/2026     CR and LF ignored, UART1 DMA back end supported ( UART1_MODE_DMA )
+ *              18/October/2026     UART1 FIFO driver, answers queued in the Tx ring buffer ( uart1.h )
+ *              18/October/2026     SYSCLK from the PLL ( sysclk.h ), the UART1 takes the PBCLK in use
+ *              18/October/2026     Interrupt priority map ( intmap_init() ), entry benchmark on 'B' ( INTBENCH_ENABLE )
+ *              18/October/2026     ISR statistics dumped on 'S' ( ILAT_ENABLE )
+ *              18/October/2026     Rx bytes through an SPSC event queue, myState removed
+ *              27/February/2022    The ORIGIN
  * @pre         This firmware was tested on the PIC32MX470 Curiosity Development Board with MPLAB X IDE v5.50.
  * @warning     N/A.
  * @pre         This code belongs to AqueronteBlog. 
@@ -27,22 +46,29 @@
 #include "inc/variables.h"
 #include "inc/functions.h"
 #include "inc/interrupts.h"
+#include "inc/evq.h"
+#include "inc/ilat.h"
+#include "inc/intbench.h"
+#include "inc/sysclk.h"
+#include "inc/uart1.h"
+#include "inc/baud_calc.h"
 
 
 /**@brief Constants.
  */
 #define TX_BUFF_SIZE    64                    /*!<   UART buffer size                                       */
-
-#define SYSCLK          8000000
-#define PBCLK           SYSCLK
+#define MESSAGE_LENGTH  12U                   /*!<   "LED x TOGGLE\n"                                       */
 
 #define UART1_BAUDRATE  115200
 
+/**@brief UART1 baud rate error at the target PBCLK ( SYSCLK_PB_HZ ): The build fails above BAUD_CALC_ERR_MAX.
+ */
+BAUD_CALC_UART_DEFINE( myBaud, SYSCLK_PB_HZ, UART1_BAUDRATE );
+
 
 /**@brief Variables.
  */
-volatile uint32_t  myState	 =	 0U;		/*!<   State that indicates when to perform the next action   */
-volatile uint8_t  *myPtr;                   /*!<   Pointer to point out myMessage                         */
+evq_t              myEvents;                /*!<   Events posted by the interrupts                        */
 
 
 /**@brief Function for application main entry.
@@ -50,6 +76,12 @@ volatile uint8_t  *myPtr;                   /*!<   Pointer to point out myMessag
 void main ( void ) 
 {
     uint8_t  myMessage[ TX_BUFF_SIZE ];
+    evq_event_t myEvt;
+    uint8_t  myCmd;
+    uint8_t  n;
+#if ( INTBENCH_ENABLE == 1U )
+    intbench_result_t myBench;
+#endif
     
     /* Initialized the message	 */
 	myMessage[ 0 ]   =  'L';
@@ -61,75 +93,109 @@ void main ( void )
     
     
     /* Configure the peripherals*/
-    conf_CLK    ();
+    evq_init    ( &myEvents );
+    uart1_init  ( uart1_rx_event );
+    (void)sysclk_init ();
     conf_GPIO   ();
-    conf_UART1  ( PBCLK, UART1_BAUDRATE );    
+    (void)conf_UART1  ( sysclk_pb_hz (), UART1_BAUDRATE );    
+    intmap_init ();
+#if ( ILAT_ENABLE == 1U )
+    ilat_init   ();
+#endif
     
      /* All interrupts are enabled     */
     __builtin_enable_interrupts();
     
     while ( 1 )
     {
-        /* Perform a dummy instruction before WAIT instruction*/
-        asm volatile ( "NOP" );
-        
-        /* uC in low power mode: Idle Mode     */
-        asm volatile ( "WAIT" );
+        /* Nothing to do: No event ( the Rx interrupt wakes the uC up )   */
+        if ( evq_count ( &myEvents ) == 0U )
+        {
+            /* Perform a dummy instruction before WAIT instruction*/
+            asm volatile ( "NOP" );
+            
+            /* uC in low power mode: Idle Mode     */
+            asm volatile ( "WAIT" );
+        }
         
-        if ( myState != 0U )
+        /* Bytes received: Every command is answered in order, the answers queue up in the Tx ring buffer  */
+        while ( evq_get ( &myEvents, &myEvt ) == 1U )
 		{
-			/* Initialized the message	 */
-			myMessage[ 5 ]   =  'T';
-			myMessage[ 6 ]   =  'O';
-			myMessage[ 7 ]   =  'G';
-			myMessage[ 8 ]   =  'G';
-			myMessage[ 9 ]   =  'L';
-			myMessage[ 10 ]  =  'E';
-
-			switch ( myState )
-			{
-				case '1':
-					/* Toggle LED1	 */
-					PORTEINV   = LED1;
-					myMessage [ 3 ]	 =	 '1';
-					break;
-
-				case '2':
-					/* Toggle LED2	 */
-					PORTEINV   = LED2;
-					myMessage [ 3 ]	 =   '2';
-					break;
-
-				case '3':
-					/* Toggle LED3	 */
-					PORTEINV   = LED3;
-					myMessage [ 3 ]	 =   '3';
-					break;
-
-				default:
-					/* All LEDs off	 */
-					PORTECLR   |=   ( LED1 | LED2 | LED3 );  
-
-					/* Initialized the message	 */
-					myMessage[ 3 ]   =  ' ';
-					myMessage[ 5 ]   =  'E';
-					myMessage[ 6 ]   =  'R';
-					myMessage[ 7 ]   =  'R';
-					myMessage[ 8 ]   =  'O';
-					myMessage[ 9 ]   =  'R';
-					myMessage[ 10 ]  =  '!';
-					break;
-			}
-            
-            /* Transmit data back	 */
-			myPtr    =   &myMessage[0];
-			U1TXREG	 =	 *myPtr;
-
-			/* Transmit Buffer Empty Interrupt: Enabled	 */
-			U1STAbits.UTXEN = 1UL;
-
-			/* Reset variables	 */
-			myState	 =	 0U;
+            while ( uart1_read ( &myCmd, 1U ) == 1U )
+            {
+                /* Line end: Not a command  */
+                if ( ( myCmd == '\r' ) || ( myCmd == '\n' ) )
+                {
+                    continue;
+                }
+                
+#if ( ILAT_ENABLE == 1U )
+                /* ISR statistics, then reset    */
+                if ( myCmd == 'S' )
+                {
+                    ilat_dump ( uart1_write, 1U );
+                    continue;
+                }
+#endif
+#if ( INTBENCH_ENABLE == 1U )
+                /* Interrupt entry benchmark    */
+                if ( myCmd == 'B' )
+                {
+                    intbench_run    ( &myBench );
+                    intbench_report ( &myBench, uart1_write );
+                    continue;
+                }
+#endif
+                
+                /* Initialized the message	 */
+                myMessage[ 5 ]   =  'T';
+                myMessage[ 6 ]   =  'O';
+                myMessage[ 7 ]   =  'G';
+                myMessage[ 8 ]   =  'G';
+                myMessage[ 9 ]   =  'L';
+                myMessage[ 10 ]  =  'E';
+
+                switch ( myCmd )
+                {
+                    case '1':
+                        /* Toggle LED1	 */
+                        PORTEINV   = LED1;
+                        myMessage [ 3 ]	 =	 '1';
+                        break;
+
+                    case '2':
+                        /* Toggle LED2	 */
+                        PORTEINV   = LED2;
+                        myMessage [ 3 ]	 =   '2';
+                        break;
+
+                    case '3':
+                        /* Toggle LED3	 */
+                        PORTEINV   = LED3;
+                        myMessage [ 3 ]	 =   '3';
+                        break;
+
+                    default:
+                        /* All LEDs off	 */
+                        PORTECLR   |=   ( LED1 | LED2 | LED3 );  
+
+                        /* Initialized the message	 */
+                        myMessage[ 3 ]   =  ' ';
+                        myMessage[ 5 ]   =  'E';
+                        myMessage[ 6 ]   =  'R';
+                        myMessage[ 7 ]   =  'R';
+                        myMessage[ 8 ]   =  'O';
+                        myMessage[ 9 ]   =  'R';
+                        myMessage[ 10 ]  =  '!';
+                        break;
+                }
+                
+                /* Transmit data back, it only waits if the Tx ring buffer is full	 */
+                for ( n = 0U; n < MESSAGE_LENGTH; )
+                {
+                    n  +=   uart1_write ( &myMessage[n], (uint8_t)( MESSAGE_LENGTH - n ) );
+                }
+            }
         }
     }
 }
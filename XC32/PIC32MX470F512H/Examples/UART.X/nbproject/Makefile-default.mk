@@ -57,17 +57,17 @@ OBJECTDIR=build/${CND_CONF}/${IMAGE_TYPE}
 DISTDIR=dist/${CND_CONF}/${IMAGE_TYPE}
 
 # Source Files Quoted if spaced
-SOURCEFILES_QUOTED_IF_SPACED=main.c src/functions.c src/interrupts.c
+SOURCEFILES_QUOTED_IF_SPACED=main.c src/functions.c src/interrupts.c src/evq.c src/ilat.c src/intmap.c src/intbench.c src/sysclk.c src/uart1.c src/uart1dma.c src/baud_calc.c
 
 # Object Files Quoted if spaced
-OBJECTFILES_QUOTED_IF_SPACED=${OBJECTDIR}/main.o ${OBJECTDIR}/src/functions.o ${OBJECTDIR}/src/interrupts.o
-POSSIBLE_DEPFILES=${OBJECTDIR}/main.o.d ${OBJECTDIR}/src/functions.o.d ${OBJECTDIR}/src/interrupts.o.d
+OBJECTFILES_QUOTED_IF_SPACED=${OBJECTDIR}/main.o ${OBJECTDIR}/src/functions.o ${OBJECTDIR}/src/interrupts.o ${OBJECTDIR}/src/evq.o ${OBJECTDIR}/src/ilat.o ${OBJECTDIR}/src/intmap.o ${OBJECTDIR}/src/intbench.o ${OBJECTDIR}/src/sysclk.o ${OBJECTDIR}/src/uart1.o ${OBJECTDIR}/src/uart1dma.o ${OBJECTDIR}/src/baud_calc.o
+POSSIBLE_DEPFILES=${OBJECTDIR}/main.o.d ${OBJECTDIR}/src/functions.o.d ${OBJECTDIR}/src/interrupts.o.d ${OBJECTDIR}/src/evq.o.d ${OBJECTDIR}/src/ilat.o.d ${OBJECTDIR}/src/intmap.o.d ${OBJECTDIR}/src/intbench.o.d ${OBJECTDIR}/src/sysclk.o.d ${OBJECTDIR}/src/uart1.o.d ${OBJECTDIR}/src/uart1dma.o.d ${OBJECTDIR}/src/baud_calc.o.d
 
 # Object Files
-OBJECTFILES=${OBJECTDIR}/main.o ${OBJECTDIR}/src/functions.o ${OBJECTDIR}/src/interrupts.o
+OBJECTFILES=${OBJECTDIR}/main.o ${OBJECTDIR}/src/functions.o ${OBJECTDIR}/src/interrupts.o ${OBJECTDIR}/src/evq.o ${OBJECTDIR}/src/ilat.o ${OBJECTDIR}/src/intmap.o ${OBJECTDIR}/src/intbench.o ${OBJECTDIR}/src/sysclk.o ${OBJECTDIR}/src/uart1.o ${OBJECTDIR}/src/uart1dma.o ${OBJECTDIR}/src/baud_calc.o
 
 # Source Files
-SOURCEFILES=main.c src/functions.c src/interrupts.c
+SOURCEFILES=main.c src/functions.c src/interrupts.c src/evq.c src/ilat.c src/intmap.c src/intbench.c src/sysclk.c src/uart1.c src/uart1dma.c src/baud_calc.c
 
 
 
@@ -125,6 +125,54 @@ ${OBJECTDIR}/src/interrupts.o: src/interrupts.c  .generated_files/flags/default/
 	@${RM} ${OBJECTDIR}/src/interrupts.o 
 	${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1  -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -fno-common -MP -MMD -MF "${OBJECTDIR}/src/interrupts.o.d" -o ${OBJECTDIR}/src/interrupts.o src/interrupts.c    -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}"  
 	
+${OBJECTDIR}/src/evq.o: src/evq.c  .generated_files/flags/default/f4f6c61c946974b77bacbf9a6ae31ba590073ef7 .generated_files/flags/default/25cf332145e109ecc94cb8c88ed46e464b66686
+	@${MKDIR} "${OBJECTDIR}/src" 
+	@${RM} ${OBJECTDIR}/src/evq.o.d 
+	@${RM} ${OBJECTDIR}/src/evq.o 
+	${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1  -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -fno-common -MP -MMD -MF "${OBJECTDIR}/src/evq.o.d" -o ${OBJECTDIR}/src/evq.o src/evq.c    -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}"  
+	
+${OBJECTDIR}/src/ilat.o: src/ilat.c  .generated_files/flags/default/cf00ee6fb47ed072b5750b366c3f431b5317276e .generated_files/flags/default/25cf332145e109ecc94cb8c88ed46e464b66686
+	@${MKDIR} "${OBJECTDIR}/src" 
+	@${RM} ${OBJECTDIR}/src/ilat.o.d 
+	@${RM} ${OBJECTDIR}/src/ilat.o 
+	${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1  -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -fno-common -MP -MMD -MF "${OBJECTDIR}/src/ilat.o.d" -o ${OBJECTDIR}/src/ilat.o src/ilat.c    -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}"  
+	
+${OBJECTDIR}/src/intmap.o: src/intmap.c  .generated_files/flags/default/c9534b5589cb00704c26bd92b3a022272e6564ae .generated_files/flags/default/25cf332145e109ecc94cb8c88ed46e464b66686
+	@${MKDIR} "${OBJECTDIR}/src" 
+	@${RM} ${OBJECTDIR}/src/intmap.o.d 
+	@${RM} ${OBJECTDIR}/src/intmap.o 
+	${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1  -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -fno-common -MP -MMD -MF "${OBJECTDIR}/src/intmap.o.d" -o ${OBJECTDIR}/src/intmap.o src/intmap.c    -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}"  
+	
+${OBJECTDIR}/src/intbench.o: src/intbench.c  .generated_files/flags/default/0104d6ad19b269e87fa3b227f75da364cf636137 .generated_files/flags/default/25cf332145e109ecc94cb8c88ed46e464b66686
+	@${MKDIR} "${OBJECTDIR}/src" 
+	@${RM} ${OBJECTDIR}/src/intbench.o.d 
+	@${RM} ${OBJECTDIR}/src/intbench.o 
+	${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1  -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -fno-common -MP -MMD -MF "${OBJECTDIR}/src/intbench.o.d" -o ${OBJECTDIR}/src/intbench.o src/intbench.c    -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}"  
+	
+${OBJECTDIR}/src/sysclk.o: src/sysclk.c  .generated_files/flags/default/f85b33a6d0b3b64a310128f0b408809d79fc5837 .generated_files/flags/default/25cf332145e109ecc94cb8c88ed46e464b66686
+	@${MKDIR} "${OBJECTDIR}/src" 
+	@${RM} ${OBJECTDIR}/src/sysclk.o.d 
+	@${RM} ${OBJECTDIR}/src/sysclk.o 
+	${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1  -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -fno-common -MP -MMD -MF "${OBJECTDIR}/src/sysclk.o.d" -o ${OBJECTDIR}/src/sysclk.o src/sysclk.c    -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}"  
+	
+${OBJECTDIR}/src/uart1.o: src/uart1.c  .generated_files/flags/default/38f0341de1626b70904260ba0fac6c5182d20166 .generated_files/flags/default/25cf332145e109ecc94cb8c88ed46e464b66686
+	@${MKDIR} "${OBJECTDIR}/src" 
+	@${RM} ${OBJECTDIR}/src/uart1.o.d 
+	@${RM} ${OBJECTDIR}/src/uart1.o 
+	${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1  -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -fno-common -MP -MMD -MF "${OBJECTDIR}/src/uart1.o.d" -o ${OBJECTDIR}/src/uart1.o src/uart1.c    -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}"  
+	
+${OBJECTDIR}/src/uart1dma.o: src/uart1dma.c  .generated_files/flags/default/988dd647b904bc66d3513c3a03fc1a1d2c7c3c16 .generated_files/flags/default/25cf332145e109ecc94cb8c88ed46e464b66686
+	@${MKDIR} "${OBJECTDIR}/src" 
+	@${RM} ${OBJECTDIR}/src/uart1dma.o.d 
+	@${RM} ${OBJECTDIR}/src/uart1dma.o 
+	${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1  -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -fno-common -MP -MMD -MF "${OBJECTDIR}/src/uart1dma.o.d" -o ${OBJECTDIR}/src/uart1dma.o src/uart1dma.c    -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}"  
+	
+${OBJECTDIR}/src/baud_calc.o: src/baud_calc.c  .generated_files/flags/default/34c468673224e55f1313fe36a9f2824bd141f8d6 .generated_files/flags/default/25cf332145e109ecc94cb8c88ed46e464b66686
+	@${MKDIR} "${OBJECTDIR}/src" 
+	@${RM} ${OBJECTDIR}/src/baud_calc.o.d 
+	@${RM} ${OBJECTDIR}/src/baud_calc.o 
+	${MP_CC}  $(MP_EXTRA_CC_PRE) -g -D__DEBUG -D__MPLAB_DEBUGGER_PK3=1  -fframe-base-loclist  -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -fno-common -MP -MMD -MF "${OBJECTDIR}/src/baud_calc.o.d" -o ${OBJECTDIR}/src/baud_calc.o src/baud_calc.c    -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}"  
+	
 else
 ${OBJECTDIR}/main.o: main.c  .generated_files/flags/default/1e7b6aa0aa6332f461698c73428b792c9c7d1992 .generated_files/flags/default/25cf332145e109ecc94cb8c88ed46e464b66686
 	@${MKDIR} "${OBJECTDIR}" 
@@ -144,6 +192,54 @@ ${OBJECTDIR}/src/interrupts.o: src/interrupts.c  .generated_files/flags/default/
 	@${RM} ${OBJECTDIR}/src/interrupts.o 
 	${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -fno-common -MP -MMD -MF "${OBJECTDIR}/src/interrupts.o.d" -o ${OBJECTDIR}/src/interrupts.o src/interrupts.c    -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}"  
 	
+${OBJECTDIR}/src/evq.o: src/evq.c  .generated_files/flags/default/fae64c89a310c86167e1f15d4aeccec37a2e2646 .generated_files/flags/default/25cf332145e109ecc94cb8c88ed46e464b66686
+	@${MKDIR} "${OBJECTDIR}/src" 
+	@${RM} ${OBJECTDIR}/src/evq.o.d 
+	@${RM} ${OBJECTDIR}/src/evq.o 
+	${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -fno-common -MP -MMD -MF "${OBJECTDIR}/src/evq.o.d" -o ${OBJECTDIR}/src/evq.o src/evq.c    -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}"  
+	
+${OBJECTDIR}/src/ilat.o: src/ilat.c  .generated_files/flags/default/606db55d3bfce7f10b4950f261b63011febc0f79 .generated_files/flags/default/25cf332145e109ecc94cb8c88ed46e464b66686
+	@${MKDIR} "${OBJECTDIR}/src" 
+	@${RM} ${OBJECTDIR}/src/ilat.o.d 
+	@${RM} ${OBJECTDIR}/src/ilat.o 
+	${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -fno-common -MP -MMD -MF "${OBJECTDIR}/src/ilat.o.d" -o ${OBJECTDIR}/src/ilat.o src/ilat.c    -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}"  
+	
+${OBJECTDIR}/src/intmap.o: src/intmap.c  .generated_files/flags/default/0dcce094749af8a736437db1bfb33fc2ae41c361 .generated_files/flags/default/25cf332145e109ecc94cb8c88ed46e464b66686
+	@${MKDIR} "${OBJECTDIR}/src" 
+	@${RM} ${OBJECTDIR}/src/intmap.o.d 
+	@${RM} ${OBJECTDIR}/src/intmap.o 
+	${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -fno-common -MP -MMD -MF "${OBJECTDIR}/src/intmap.o.d" -o ${OBJECTDIR}/src/intmap.o src/intmap.c    -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}"  
+	
+${OBJECTDIR}/src/intbench.o: src/intbench.c  .generated_files/flags/default/2e29d4868d63babb380b2291858ab75b74c9e08e .generated_files/flags/default/25cf332145e109ecc94cb8c88ed46e464b66686
+	@${MKDIR} "${OBJECTDIR}/src" 
+	@${RM} ${OBJECTDIR}/src/intbench.o.d 
+	@${RM} ${OBJECTDIR}/src/intbench.o 
+	${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -fno-common -MP -MMD -MF "${OBJECTDIR}/src/intbench.o.d" -o ${OBJECTDIR}/src/intbench.o src/intbench.c    -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}"  
+	
+${OBJECTDIR}/src/sysclk.o: src/sysclk.c  .generated_files/flags/default/efb9fa66f6500fa186e271848261f36c234b1689 .generated_files/flags/default/25cf332145e109ecc94cb8c88ed46e464b66686
+	@${MKDIR} "${OBJECTDIR}/src" 
+	@${RM} ${OBJECTDIR}/src/sysclk.o.d 
+	@${RM} ${OBJECTDIR}/src/sysclk.o 
+	${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -fno-common -MP -MMD -MF "${OBJECTDIR}/src/sysclk.o.d" -o ${OBJECTDIR}/src/sysclk.o src/sysclk.c    -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}"  
+	
+${OBJECTDIR}/src/uart1.o: src/uart1.c  .generated_files/flags/default/004b66504097d81d1cbc1f179e691c28e7f49f8f .generated_files/flags/default/25cf332145e109ecc94cb8c88ed46e464b66686
+	@${MKDIR} "${OBJECTDIR}/src" 
+	@${RM} ${OBJECTDIR}/src/uart1.o.d 
+	@${RM} ${OBJECTDIR}/src/uart1.o 
+	${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -fno-common -MP -MMD -MF "${OBJECTDIR}/src/uart1.o.d" -o ${OBJECTDIR}/src/uart1.o src/uart1.c    -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}"  
+	
+${OBJECTDIR}/src/uart1dma.o: src/uart1dma.c  .generated_files/flags/default/335d85559fe22bdfa58cd75a53bf6e242dab1108 .generated_files/flags/default/25cf332145e109ecc94cb8c88ed46e464b66686
+	@${MKDIR} "${OBJECTDIR}/src" 
+	@${RM} ${OBJECTDIR}/src/uart1dma.o.d 
+	@${RM} ${OBJECTDIR}/src/uart1dma.o 
+	${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -fno-common -MP -MMD -MF "${OBJECTDIR}/src/uart1dma.o.d" -o ${OBJECTDIR}/src/uart1dma.o src/uart1dma.c    -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}"  
+	
+${OBJECTDIR}/src/baud_calc.o: src/baud_calc.c  .generated_files/flags/default/77b56e9f371a66292b2f5087ec3fc0b15e044501 .generated_files/flags/default/25cf332145e109ecc94cb8c88ed46e464b66686
+	@${MKDIR} "${OBJECTDIR}/src" 
+	@${RM} ${OBJECTDIR}/src/baud_calc.o.d 
+	@${RM} ${OBJECTDIR}/src/baud_calc.o 
+	${MP_CC}  $(MP_EXTRA_CC_PRE)  -g -x c -c -mprocessor=$(MP_PROCESSOR_OPTION)  -fno-common -MP -MMD -MF "${OBJECTDIR}/src/baud_calc.o.d" -o ${OBJECTDIR}/src/baud_calc.o src/baud_calc.c    -DXPRJ_default=$(CND_CONF)  -legacy-libc  $(COMPARISON_BUILD)  -mdfp="${DFP_DIR}"  
+	
 endif
 
 # ------------------------------------------------------------------------------------
@@ -0,0 +1,162 @@
+/**
+ * @brief       baud_calc.c
+ * @details     Baud rate generator solver sources ( PIC32MX: UARTx ).
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero (aqueronteblog@gmail.com)
+ * @date        18/October/2026
+ * @version     18/October/2026    UxBRG rounded down or up, the one with the lower error
+ *              18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+#include "../inc/baud_calc.h"
+
+
+/**@brief Constants.
+ */
+#define BAUD_CALC_CANDIDATES    2U      /*!<   BRGH = 0, 1   */
+
+
+/**@brief Function prototypes.
+ */
+static uint16_t baud_calc_try   ( uint32_t f, uint32_t baud, uint32_t m, uint32_t* n );
+static uint16_t baud_calc_err   ( uint32_t f, uint32_t mnb );
+
+
+
+/**
+ * @brief       uint8_t baud_calc_uart ( uint32_t , uint32_t , baud_calc_uart_t* )
+ * @details     It works out the UARTx settings with the lowest error for a baud rate ( BAUD_CALC_UART_DEFINE() at
+ *              run time ).
+ *
+ *
+ * @param[in]    f_pb:      PBCLK in use, Hz.
+ * @param[in]    baud:      Baud rate.
+ *
+ * @param[out]   cfg:       BRGH, UxBRG and the error ( 0.01% ).
+ *
+ *
+ * @return      1: Error within BAUD_CALC_ERR_MAX, 0: Above it ( cfg is the best there is anyway )
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         baud >= 25.
+ * @warning     N/A
+ */
+uint8_t baud_calc_uart ( uint32_t f_pb, uint32_t baud, baud_calc_uart_t* cfg )
+{
+    uint8_t     k       =   0U;
+    uint16_t    e       =   0U;
+    uint32_t    n       =   0UL;
+
+    cfg->error  =   BAUD_CALC_NONE;
+
+    for ( k = 0U; k < BAUD_CALC_CANDIDATES; k++ )
+    {
+        e   =   baud_calc_try ( f_pb, baud, BAUD_CALC_M( k ), &n );
+
+        /* Lowest error, ties go to BRGH = 0  */
+        if ( e < cfg->error )
+        {
+            cfg->error  =   e;
+            cfg->brgh   =   k;
+            cfg->brg    =   (uint16_t)( n - 1UL );
+        }
+    }
+
+    if ( cfg->error == BAUD_CALC_NONE )
+    {
+        /* Nothing within 25%: The fastest setting   */
+        cfg->brgh   =   1U;
+        cfg->brg    =   0U;
+    }
+
+    return ( cfg->error <= BAUD_CALC_ERR_MAX ) ? 1U : 0U;
+}
+
+
+/**
+ * @brief       uint16_t baud_calc_try ( uint32_t , uint32_t , uint32_t , uint32_t* )
+ * @details     Candidate of divider m: UxBRG + 1 rounded down or up ( 1 to BAUD_CALC_MAX ), the one with the lower
+ *              error, ties go to the one rounded down ( BAUD_CALC_N() ), and its error.
+ *
+ *
+ * @param[in]    f:         PBCLK, Hz.
+ * @param[in]    baud:      Baud rate.
+ * @param[in]    m:         Divider: 16 or 4.
+ *
+ * @param[out]   n:         UxBRG + 1.
+ *
+ *
+ * @return      Error in 0.01%, BAUD_CALC_NONE if it is 25% off or more
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+static uint16_t baud_calc_try ( uint32_t f, uint32_t baud, uint32_t m, uint32_t* n )
+{
+    uint32_t        mb      =   m * baud;
+    uint32_t        lo      =   f / mb;
+    uint32_t        hi      =   lo + 1UL;
+    uint16_t        e_lo    =   0U;
+    uint16_t        e_hi    =   0U;
+
+    /* UxBRG + 1 rounded down and up, 1 to BAUD_CALC_MAX  */
+    lo  =   ( lo == 0UL ) ? 1UL : ( lo > BAUD_CALC_MAX ) ? BAUD_CALC_MAX : lo;
+    hi  =   ( hi > BAUD_CALC_MAX ) ? BAUD_CALC_MAX : hi;
+
+    /* The nearest one is not always the best: The error is relative to m*( UxBRG + 1 )*baud   */
+    e_lo    =   baud_calc_err ( f, mb * lo );
+    e_hi    =   baud_calc_err ( f, mb * hi );
+
+    if ( e_hi < e_lo )
+    {
+        *n  =   hi;
+
+        return e_hi;
+    }
+    else
+    {
+        *n  =   lo;
+
+        return e_lo;
+    }
+}
+
+
+/**
+ * @brief       uint16_t baud_calc_err ( uint32_t , uint32_t )
+ * @details     Error of a setting ( BAUD_CALC_ERR_MNB() ).
+ *
+ *
+ * @param[in]    f:         PBCLK, Hz.
+ * @param[in]    mnb:       Clock the setting needs: m*( UxBRG + 1 )*baud.
+ *
+ *
+ * @return      Error in 0.01%, BAUD_CALC_NONE if it is 25% off or more
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+static uint16_t baud_calc_err ( uint32_t f, uint32_t mnb )
+{
+    uint32_t        diff    =   ( f > mnb ) ? ( f - mnb ) : ( mnb - f );
+
+    if ( ( diff * 4UL ) >= mnb )
+    {
+        return BAUD_CALC_NONE;
+    }
+    else
+    {
+        return (uint16_t)( ( diff * 100UL ) / ( mnb / 100UL ) );
+    }
+}
@@ -13,58 +13,6 @@
 #include "../inc/functions.h"
 
 
-/**
- * @brief       void conf_CLK  ( void )
- * @details     It configures the clocks for the system.
- * 
- *                  - SYSCLK ( F_SYS ) = FRC/1 = 8MHz
- * 
- *
- * @param[in]    N/A.
- *
- * @param[out]   N/A.
- *
- *
- * @return      N/A
- *
- * @author      Manuel Caballero
- * @date        27/February/2022
- * @version     27/February/2022      The ORIGIN
- * @pre         N/A
- * @warning     N/A
- */
-void conf_CLK  ( void )
-{
-    SYSKEY  =    0x00000000;    // Force lock
-    SYSKEY  =    0xAA996655;    // Unlock registers    
-    SYSKEY  =    0x556699AA;
-    
-    /* Internal Fast RC (FRC) Oscillator divided by 1 */
-    OSCCONbits.FRCDIV   =    0; // FRC divided by 1
-    OSCCONbits.NOSC     =    0; // Internal Fast RC (FRC) Oscillator divided by FRCDIV[2:0] bits (FRCDIV)
-    
-    /* Initiates an oscillator switch to a selection specified by the NOSC[2:0] bits     */
-    OSCCONbits.OSWEN    =    1;
-    
-    /* Wait until oscillator switch is complete  */
-    while ( OSCCONbits.OSWEN == 1 );    // [TODO]       Too dangerous!!! The uC may get stuck here
-                                        // [WORKAROUND] Insert a counter
-    
-    /* Wait until Peripheral Bus Clock (PBCLK) Divisor can be written   */
-    while ( OSCCONbits.PBDIVRDY == 0 ); // [TODO]       Too dangerous!!! The uC may get stuck here
-                                        // [WORKAROUND] Insert a counter
-    
-    /* PBCLK is SYSCLK divided by 1 */
-    OSCCONbits.PBDIV    =   0b00;
-    
-    /* Device will enter Idle mode when a WAIT instruction is executed */
-    OSCCONbits.SLPEN    =   0UL;    
-    
-    SYSKEY  =    0x33333333;    // Force lock
-}
-
-
-
 /**
  * @brief       void conf_GPIO  ( void )
  * @details     It configures GPIO to work with the LEDs.
@@ -118,7 +66,7 @@ void conf_GPIO  ( void )
 
 
 /**
- * @brief       void conf_UART1  ( uint32_t , uint32_t )
+ * @brief       uint8_t conf_UART1  ( uint32_t , uint32_t )
  * @details     It configures the UART1.
  *
  * @param[in]    f_pb:      UART clock.
@@ -127,16 +75,26 @@ void conf_GPIO  ( void )
  * @param[out]   N/A.
  *
  *
- * @return      N/A
+ * @return      1: Baud rate error within BAUD_CALC_ERR_MAX ( baud_calc.h ), 0: Above it
  *
  * @author      Manuel Caballero
  * @date        27/February/2022
- * @version     27/February/2022      The ORIGIN
- * @pre         N/A
+ * @version     18/October/2026       BRGH and U1BRG with the lowest error for f_pb ( baud_calc_uart() ), rounded
+ *              18/October/2026       UART1_MODE_DMA: The DMA takes the Rx and Tx events, only U1EIE is enabled
+ *              18/October/2026       FIFO interrupt thresholds ( uart1.h ), transmitter always enabled
+ *              18/October/2026       Priority and multi-vector mode moved to intmap_init() ( INTMAP_U1 )
+ *              27/February/2022      The ORIGIN
+ * @pre         It returns 0 if the error is above BAUD_CALC_ERR_MAX, the best setting is used anyway.
  * @warning     N/A
  */
-void conf_UART1  ( uint32_t f_pb, uint32_t baudrate )
+uint8_t conf_UART1  ( uint32_t f_pb, uint32_t baudrate )
 {
+    baud_calc_uart_t myBaud;
+    uint8_t          myBaudOk;
+    
+    /* BRGH and U1BRG with the lowest error for the PBCLK in use   */
+    myBaudOk    =   baud_calc_uart ( f_pb, baudrate, &myBaud );
+    
     /* UART disabled */
     U1MODEbits.ON   =   0UL;
     
@@ -161,8 +119,8 @@ void conf_UART1  ( uint32_t f_pb, uint32_t baudrate )
     /* U1RX Idle state is '1' */
     U1MODEbits.RXINV = 0UL;
     
-    /* High-Speed mode ? 4x baud clock enable */
-    U1MODEbits.BRGH = 1UL;
+    /* Standard ( 16x baud clock ) or High-Speed mode ( 4x baud clock ), baud_calc_uart() */
+    U1MODEbits.BRGH = myBaud.brgh;
     
     /* 8-bit data, no parity */
     U1MODEbits.PDSEL = 0b00;
@@ -173,8 +131,8 @@ void conf_UART1  ( uint32_t f_pb, uint32_t baudrate )
     /* Automatic Address Detect mode is disabled */
     U1STAbits.ADM_EN = 0UL;
     
-    /* Interrupt is generated and asserted when all characters have been transmitted */
-    U1STAbits.UTXISEL = 0b01;
+    /* Tx interrupt threshold ( uart1.h ): Tx FIFO empty by default */
+    U1STAbits.UTXISEL = UART1_TXISEL;
     
     /* U1TX Idle state is '1' */
     U1STAbits.UTXINV = 0UL;
@@ -185,41 +143,36 @@ void conf_UART1  ( uint32_t f_pb, uint32_t baudrate )
     /* Break transmission is disabled or completed */
     U1STAbits.UTXBRK = 0UL;
     
-    /* UART1 transmitter is disabled */
-    U1STAbits.UTXEN = 0UL;
+    /* UART1 transmitter is enabled, it idles until uart1_write() enables the Tx interrupt */
+    U1STAbits.UTXEN = 1UL;
     
-    /* Interrupt flag bit is asserted while receive buffer is not empty */
-    U1STAbits.URXISEL = 0b00;
+    /* Rx interrupt threshold ( uart1.h ): Receive buffer not empty by default */
+    U1STAbits.URXISEL = UART1_RXISEL;
     
     /* Address Detect mode is disabled */
     U1STAbits.ADDEN = 0UL;
     
-    /* Calculate the desired baud rate */
-    if ( U1MODEbits.BRGH == 0UL )
-    {
-        U1BRG = ( f_pb / ( 16UL * baudrate ) ) - 1UL;
-    }
-    else
-    {
-        U1BRG = ( f_pb / ( 4UL * baudrate ) ) - 1UL;
-    } 
-    
-    /* UART1: Interrupt priority is 3   */
-    IPC7bits.U1IP   =   0b011;
+    /* Desired baud rate, rounded: baudrate = f_pb/[m(U1BRG+1)], m = 16 or 4 ( BRGH ) */
+    U1BRG = myBaud.brg;
     
-    /* UART1: Interrupt subpriority is 1   */
-    IPC7bits.U1IS   =   0b01;
+    /* UART1: Interrupt priority and subpriority, intmap_init() ( INTMAP_U1, interrupts.h )   */
     
-    /* Clear the UART1 interrupt status flag ( U1IF )     */
-    IFS1CLR  =   0x00000180;
+    /* Clear the UART1 interrupt status flags ( U1EIF, U1RXIF, U1TXIF )     */
+    IFS1CLR  =   0x000001C0;
     
-    /* Enable UART1 interrupts ( U1IF )     */
+#if ( UART1_MODE == UART1_MODE_DMA )
+    /* The Rx and Tx events start the DMA channels ( uart1_init() ): Enable UART1 error interrupt ( U1EIE ) only     */
+    IEC1bits.U1RXIE = 0UL;
+    IEC1bits.U1TXIE = 0UL;
+    IEC1bits.U1EIE  = 1UL;
+#else
+    /* Enable UART1 Rx interrupt ( U1RXIE ), the Tx one is enabled by uart1_write()     */
     IEC1bits.U1RXIE = 1UL;
-    IEC1bits.U1TXIE = 1UL;
-    
-    /* Interrupt controller configured for multivectored vectored mode     */
-    INTCONbits.MVEC =   1UL;
+    IEC1bits.U1TXIE = 0UL;
+#endif
     
     /* UART enabled */
     U1MODEbits.ON   =   1UL;
+    
+    return myBaudOk;
 }
\ No newline at end of file
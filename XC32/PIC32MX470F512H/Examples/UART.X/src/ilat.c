@@ -0,0 +1,441 @@
+/**
+ * @brief       ilat.c
+ * @details     ISR latency and duration instrumentation sources.
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero (aqueronteblog@gmail.com)
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+#include "../inc/ilat.h"
+
+#if ( ILAT_ENABLE == 1U )
+
+
+/**@brief Constants.
+ */
+#if defined( __XC8 )
+#define ILAT_LOCK( s )      do{ (s) = INTCONbits.GIE; INTCONbits.GIE = 0U; }while( 0 )
+#define ILAT_UNLOCK( s )    do{ INTCONbits.GIE = (s); }while( 0 )
+#else
+#define ILAT_LOCK( s )      do{ (s) = __builtin_disable_interrupts (); }while( 0 )
+#define ILAT_UNLOCK( s )    do{ if ( ( (s) & 0x00000001UL ) != 0UL ) { __builtin_enable_interrupts (); } }while( 0 )
+#endif
+
+#define ILAT_FRAME_MAX      ( 1U + 4U + ( 4U * sizeof( ilat_time_t ) ) + 8U + ( 2U * ILAT_BINS ) )      /*!<   Bytes of a source    */
+
+
+/**@brief Variables.
+ */
+static ilat_stat_t  myStat[ILAT_SOURCES];       /*!<   Statistics ( ISR )              */
+static ilat_time_t  myBegin[ILAT_SOURCES];      /*!<   Start of each handler ( ISR )   */
+
+
+/**@brief Function prototypes.
+ */
+static uint8_t ilat_put     ( uint8_t* buff, uint8_t i, uint32_t value, uint8_t size );
+static uint8_t ilat_send    ( ilat_write_t write, uint8_t* buff, uint8_t length, uint8_t sum );
+
+
+
+/**
+ * @brief       void ilat_init ( void )
+ * @details     It starts the timestamp timer and resets the statistics.
+ *
+ *              PIC16: Timer1
+ *                  - Internal instruction cycle clock ( F_OSC/4 )
+ *                  - Prescaler 1:1
+ *                  - Free-running, no interrupt
+ *
+ *              PIC32: The CP0 Count register is always running, nothing to configure.
+ *
+ *
+ * @param[in]    N/A.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     PIC16: Timer1 must not be used by anything else ( e.g. adc_scan_trigger_start() ). It stops in
+ *              SLEEP ( F_OSC/4 ), the timestamps around SLEEP are invalid.
+ */
+void ilat_init ( void )
+{
+#if defined( __XC8 )
+    /* Stop Timer1 */
+    T1CONbits.TMR1ON    =   0U;
+
+    /* Timer1 interrupt disabled    */
+    PIE1bits.TMR1IE =   0U;
+
+    /* Internal instruction cycle clock ( F_OSC/4 ), 1:1 Prescale value   */
+    T1CONbits.TMR1CS    =   0b00;
+    T1CONbits.T1CKPS    =   0b00;
+    T1GCONbits.TMR1GE   =   0U;
+
+    TMR1H   =   0U;
+    TMR1L   =   0U;
+
+    /* Start Timer1 */
+    T1CONbits.TMR1ON    =   1U;
+#endif
+
+    ilat_reset ();
+}
+
+
+/**
+ * @brief       ilat_time_t ilat_now ( void )
+ * @details     It gets a timestamp.
+ *
+ *
+ * @param[in]    N/A.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      Timer1 ( PIC16 ), CP0 Count ( PIC32 )
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+ilat_time_t ilat_now ( void )
+{
+#if defined( __XC8 )
+    uint8_t tmr1h   =   0U;
+    uint8_t tmr1l   =   0U;
+
+    /* TMR1L may carry into TMR1H between both reads  */
+    do{
+        tmr1h   =   TMR1H;
+        tmr1l   =   TMR1L;
+    }while ( tmr1h != TMR1H );
+
+    return (ilat_time_t)( ( (uint16_t)tmr1h << 8U ) | tmr1l );
+#else
+    return (ilat_time_t)_CP0_GET_COUNT ();
+#endif
+}
+
+
+/**
+ * @brief       void ilat_begin ( uint8_t , ilat_time_t , ilat_time_t )
+ * @details     Start of a handler ( ILAT_BEGIN() ). The latency is updated.
+ *
+ *
+ * @param[in]    src:       Source, 0 to ILAT_SOURCES - 1.
+ * @param[in]    late:      Ticks elapsed before the ISR was entered, 0 if unknown.
+ * @param[in]    entry:     ISR entry timestamp ( ILAT_ISR_ENTER() ).
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         It must be called from the ISR.
+ * @warning     N/A
+ */
+void ilat_begin ( uint8_t src, ilat_time_t late, ilat_time_t entry )
+{
+    ilat_stat_t*    st      =   &myStat[src];
+    ilat_time_t     now     =   ilat_now ();
+    ilat_time_t     lat     =   (ilat_time_t)( late + (ilat_time_t)( now - entry ) );
+
+    myBegin[src]    =   now;
+
+    if ( lat < st->lat_min )
+    {
+        st->lat_min =   lat;
+    }
+    if ( lat > st->lat_max )
+    {
+        st->lat_max =   lat;
+    }
+    st->lat_sum +=  lat;
+}
+
+
+/**
+ * @brief       void ilat_end ( uint8_t )
+ * @details     End of a handler ( ILAT_END() ). The duration and its histogram are updated.
+ *
+ *
+ * @param[in]    src:       Source, 0 to ILAT_SOURCES - 1.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         It must be called from the ISR, after ilat_begin() of the same source.
+ * @warning     N/A
+ */
+void ilat_end ( uint8_t src )
+{
+    ilat_stat_t*    st      =   &myStat[src];
+    ilat_time_t     dur     =   (ilat_time_t)( ilat_now () - myBegin[src] );
+    ilat_time_t     d       =   (ilat_time_t)( dur >> ILAT_BIN_SHIFT );
+    uint8_t         bin     =   0U;
+
+    st->n++;
+
+    if ( dur < st->dur_min )
+    {
+        st->dur_min =   dur;
+    }
+    if ( dur > st->dur_max )
+    {
+        st->dur_max =   dur;
+    }
+    st->dur_sum +=  dur;
+
+    /* log2 bin   */
+    while ( ( d != 0U ) && ( bin < ( ILAT_BINS - 1U ) ) )
+    {
+        d   >>= 1U;
+        bin++;
+    }
+
+    if ( st->hist[bin] != 0xFFFFU )
+    {
+        st->hist[bin]++;
+    }
+}
+
+
+/**
+ * @brief       void ilat_get ( uint8_t , ilat_stat_t* )
+ * @details     It gets a copy of the statistics of a source.
+ *
+ *
+ * @param[in]    src:       Source, 0 to ILAT_SOURCES - 1.
+ *
+ * @param[out]   stat:      Statistics since the last reset.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     Interrupts are disabled during the copy.
+ */
+void ilat_get ( uint8_t src, ilat_stat_t* stat )
+{
+#if defined( __XC8 )
+    uint8_t     s   =   0U;
+#else
+    uint32_t    s   =   0UL;
+#endif
+
+    ILAT_LOCK ( s );
+    *stat   =   myStat[src];
+    ILAT_UNLOCK ( s );
+}
+
+
+/**
+ * @brief       void ilat_reset ( void )
+ * @details     It resets the statistics of every source.
+ *
+ *
+ * @param[in]    N/A.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     Interrupts are disabled while the statistics are reset.
+ */
+void ilat_reset ( void )
+{
+#if defined( __XC8 )
+    uint8_t     s   =   0U;
+#else
+    uint32_t    s   =   0UL;
+#endif
+    uint8_t     i   =   0U;
+
+    ILAT_LOCK ( s );
+    memset ( (void*)&myStat[0], 0, sizeof( myStat ) );
+    for ( i = 0U; i < ILAT_SOURCES; i++ )
+    {
+        myStat[i].lat_min   =   (ilat_time_t)~0UL;
+        myStat[i].dur_min   =   (ilat_time_t)~0UL;
+    }
+    ILAT_UNLOCK ( s );
+}
+
+
+/**
+ * @brief       void ilat_dump ( ilat_write_t , uint8_t )
+ * @details     It sends the statistics of every source ( binary frame, see ilat.h ). Each source is copied
+ *              with the interrupts disabled, then sent.
+ *
+ *
+ * @param[in]    write:     Write function, it is called until every byte is taken.
+ * @param[in]    reset:     1: The statistics are reset once sent.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         It must not be called from an ISR.
+ * @warning     It blocks until the whole frame is taken by write().
+ */
+void ilat_dump ( ilat_write_t write, uint8_t reset )
+{
+    ilat_stat_t st;
+    uint8_t     buff[ILAT_FRAME_MAX];
+    uint8_t     sum     =   0U;
+    uint8_t     src     =   0U;
+    uint8_t     i       =   0U;
+    uint8_t     n       =   0U;
+
+    /* Header   */
+    buff[0] =   'I';
+    buff[1] =   'L';
+    buff[2] =   'A';
+    buff[3] =   'T';
+    (void)ilat_send ( write, &buff[0], 4U, 0U );
+
+    buff[0] =   ILAT_VERSION;
+    buff[1] =   (uint8_t)sizeof( ilat_time_t );
+    buff[2] =   ILAT_SOURCES;
+    buff[3] =   ILAT_BINS;
+    buff[4] =   ILAT_BIN_SHIFT;
+    n       =   ilat_put ( &buff[0], 5U, ILAT_HZ, 4U );
+    sum     =   ilat_send ( write, &buff[0], n, sum );
+
+    /* Sources  */
+    for ( src = 0U; src < ILAT_SOURCES; src++ )
+    {
+        ilat_get ( src, &st );
+
+        buff[0] =   src;
+        n       =   ilat_put ( &buff[0], 1U, st.n, 4U );
+        n       =   ilat_put ( &buff[0], n, st.lat_min, sizeof( ilat_time_t ) );
+        n       =   ilat_put ( &buff[0], n, st.lat_max, sizeof( ilat_time_t ) );
+        n       =   ilat_put ( &buff[0], n, st.lat_sum, 4U );
+        n       =   ilat_put ( &buff[0], n, st.dur_min, sizeof( ilat_time_t ) );
+        n       =   ilat_put ( &buff[0], n, st.dur_max, sizeof( ilat_time_t ) );
+        n       =   ilat_put ( &buff[0], n, st.dur_sum, 4U );
+        for ( i = 0U; i < ILAT_BINS; i++ )
+        {
+            n   =   ilat_put ( &buff[0], n, st.hist[i], 2U );
+        }
+        sum     =   ilat_send ( write, &buff[0], n, sum );
+    }
+
+    /* Checksum: Every byte after the magic adds up to 0   */
+    buff[0] =   (uint8_t)( 0U - sum );
+    (void)ilat_send ( write, &buff[0], 1U, 0U );
+
+    if ( reset == 1U )
+    {
+        ilat_reset ();
+    }
+}
+
+
+
+/**
+ * @brief       uint8_t ilat_put ( uint8_t* , uint8_t , uint32_t , uint8_t )
+ * @details     It stores a value, little-endian.
+ *
+ *
+ * @param[in]    buff:      Buffer.
+ * @param[in]    i:         Position.
+ * @param[in]    value:     Value.
+ * @param[in]    size:      Bytes.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      Next position
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+static uint8_t ilat_put ( uint8_t* buff, uint8_t i, uint32_t value, uint8_t size )
+{
+    while ( size-- != 0U )
+    {
+        buff[i++]   =   (uint8_t)value;
+        value     >>=   8U;
+    }
+
+    return i;
+}
+
+
+/**
+ * @brief       uint8_t ilat_send ( ilat_write_t , uint8_t* , uint8_t , uint8_t )
+ * @details     It writes a buffer until every byte is taken and adds it to the checksum.
+ *
+ *
+ * @param[in]    write:     Write function.
+ * @param[in]    buff:      Buffer.
+ * @param[in]    length:    Bytes.
+ * @param[in]    sum:       Checksum so far.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      Checksum
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+static uint8_t ilat_send ( ilat_write_t write, uint8_t* buff, uint8_t length, uint8_t sum )
+{
+    uint8_t i   =   0U;
+
+    for ( i = 0U; i < length; i++ )
+    {
+        sum    +=   buff[i];
+    }
+
+    i   =   0U;
+    while ( i < length )
+    {
+        i  +=   write ( &buff[i], (uint8_t)( length - i ) );
+    }
+
+    return sum;
+}
+
+#endif /* ILAT_ENABLE */
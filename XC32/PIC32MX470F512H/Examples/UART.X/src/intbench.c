@@ -0,0 +1,221 @@
+/**
+ * @brief       intbench.c
+ * @details     Interrupt entry microbenchmark sources: SOFT vs SRS vs AUTO context ( intmap.h ).
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero (aqueronteblog@gmail.com)
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+#include "../inc/interrupts.h"
+
+#if ( INTBENCH_ENABLE == 1U )
+
+/**@brief Constants.
+ */
+static const uint32_t   myMask[INTBENCH_MODES]  =   { _IFS0_INT0IF_MASK, _IFS0_INT1IF_MASK, _IFS0_INT2IF_MASK };
+static const char       myName[INTBENCH_MODES][5]   =   { "SOFT", "SRS ", "AUTO" };
+
+
+/**@brief Variables.
+ */
+static volatile uint32_t    myStamp;        /*!<   Count read by the handler       */
+static volatile uint8_t     myDone;         /*!<   1: The handler was executed     */
+
+
+
+/**
+ * @brief       void intbench_work ( void )
+ * @details     Work of the benchmark handlers. Not inlined: The handlers call a function as a real one does.
+ *
+ *
+ * @param[in]    N/A.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+static void __attribute__ ( ( noinline ) ) intbench_work ( void )
+{
+    myDone  =   1U;
+}
+
+
+/**
+ * @brief       void INT0Handler ( void ), INT1Handler ( void ), INT2Handler ( void )
+ * @details     Benchmark handlers: SOFT, SRS and AUTO context. Count is read first.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A.
+ * @warning     N/A
+ */
+void INTMAP_ISR( BSOFT ) INT0Handler ( void )
+{
+    myStamp =   _CP0_GET_COUNT ();
+    IFS0CLR =   _IFS0_INT0IF_MASK;
+    intbench_work ();
+}
+
+void INTMAP_ISR( BSRS ) INT1Handler ( void )
+{
+    myStamp =   _CP0_GET_COUNT ();
+    IFS0CLR =   _IFS0_INT1IF_MASK;
+    intbench_work ();
+}
+
+void INTMAP_ISR( BAUTO ) INT2Handler ( void )
+{
+    myStamp =   _CP0_GET_COUNT ();
+    IFS0CLR =   _IFS0_INT2IF_MASK;
+    intbench_work ();
+}
+
+
+
+/**
+ * @brief       void intbench_run ( intbench_result_t* )
+ * @details     It triggers every benchmark vector INTBENCH_RUNS times ( plus a warm-up run ) and keeps the min
+ *              and the max time from the flag write to the handler body.
+ *
+ *
+ * @param[in]    N/A.
+ *
+ * @param[out]   result:    Min and max per context, SYSCLK cycles.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         intmap_init() was called and the interrupts are enabled, it runs from the main loop ( IPL0 ).
+ * @warning     The higher priority vectors ( U1 at IPL7 ) may preempt a run: Only the max is affected.
+ */
+void intbench_run ( intbench_result_t* result )
+{
+    uint32_t    t0  =   0UL;
+    uint32_t    d   =   0UL;
+    uint32_t    i   =   0UL;
+    uint32_t    m   =   0UL;
+
+    for ( m = 0UL; m < INTBENCH_MODES; m++ )
+    {
+        result->min[m]  =   0xFFFFFFFFUL;
+        result->max[m]  =   0UL;
+
+        IFS0CLR =   myMask[m];
+        IEC0SET =   myMask[m];
+
+        for ( i = 0UL; i <= INTBENCH_RUNS; i++ )
+        {
+            myDone  =   0U;
+            t0      =   _CP0_GET_COUNT ();
+            IFS0SET =   myMask[m];
+
+            while ( myDone == 0U );
+
+            /* Count runs at SYSCLK/2, the first run is the warm-up  */
+            d   =   ( myStamp - t0 ) * 2UL;
+            if ( i == 0UL )
+            {
+                continue;
+            }
+
+            if ( d < result->min[m] )
+            {
+                result->min[m]  =   d;
+            }
+            if ( d > result->max[m] )
+            {
+                result->max[m]  =   d;
+            }
+        }
+
+        IEC0CLR =   myMask[m];
+    }
+}
+
+
+/**
+ * @brief       void intbench_report ( const intbench_result_t* , intbench_write_t )
+ * @details     It sends the results as text, one line per context: "SOFT min max\r\n", SYSCLK cycles.
+ *
+ *
+ * @param[in]    result:    Results of intbench_run().
+ * @param[in]    write:     Write function, e.g. uart1_write().
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    Each line is written until it is taken ( uart1.h, non-blocking )
+ *              18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     It blocks until every line is taken by write().
+ */
+void intbench_report ( const intbench_result_t* result, intbench_write_t write )
+{
+    uint8_t     line[32];
+    uint8_t     n   =   0U;
+    uint8_t     k   =   0U;
+    uint8_t     j   =   0U;
+    uint32_t    m   =   0UL;
+    uint32_t    v   =   0UL;
+    uint8_t     digits[10];
+
+    for ( m = 0UL; m < INTBENCH_MODES; m++ )
+    {
+        n   =   0U;
+        for ( k = 0U; k < 4U; k++ )
+        {
+            line[n++]   =   (uint8_t)myName[m][k];
+        }
+
+        /* Min and max, decimal  */
+        for ( j = 0U; j < 2U; j++ )
+        {
+            v   =   ( j == 0U ) ? result->min[m] : result->max[m];
+            k   =   0U;
+            do
+            {
+                digits[k++] =   (uint8_t)( '0' + ( v % 10UL ) );
+                v          /=   10UL;
+            }while ( v != 0UL );
+
+            line[n++]   =   ' ';
+            while ( k > 0U )
+            {
+                line[n++]   =   digits[--k];
+            }
+        }
+
+        line[n++]   =   '\r';
+        line[n++]   =   '\n';
+
+        /* Until the whole line is taken  */
+        for ( k = 0U; k < n; )
+        {
+            k  +=   write ( &line[k], (uint8_t)( n - k ) );
+        }
+    }
+}
+
+#endif
@@ -13,49 +13,106 @@
 #include "../inc/interrupts.h"
 
 
+/**
+ * @brief       void uart1_rx_event ( uint32_t )
+ * @details     UART1 Rx notify function ( uart1_init() ): It posts the bytes received to the event queue.
+ *
+ *
+ * @param[in]    count:     Bytes received.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         It is called from U1Handler().
+ * @warning     N/A
+ */
+void uart1_rx_event ( uint32_t count )
+{
+    (void)evq_post ( &myEvents, EVT_RX, (uint16_t)count );
+}
+
+
 /**
  * @brief       void U1Handler ()
- * @details     UART1 interruption. 
+ * @details     UART1 interruption. With UART1_MODE_DMA the DMA moves the bytes: Only the errors are handled.
  *
  *
  * @return      N/A
  *
  * @author      Manuel Caballero
  * @date        27/February/2022
- * @version     27/February/2022   The ORIGIN
+ * @version     18/October/2026    UART1_MODE_DMA: Overrun only ( U1EIF )
+ *              18/October/2026    Hardware FIFOs moved in bursts ( uart1.h )
+ *              18/October/2026    IPL7SRS: Priority and context from the map ( INTMAP_U1 )
+ *              18/October/2026    Rx and Tx instrumented ( ILAT_ENABLE )
+ *              18/October/2026    Rx bytes posted to the event queue, none is overwritten
+ *              27/February/2022   The ORIGIN
  * @pre         N/A.
  * @warning     N/A
  */
-void __attribute__ ( ( vector(_UART_1_VECTOR), interrupt(IPL3SOFT) ) ) U1Handler ( void )
+void INTMAP_ISR( U1 ) U1Handler ( void )
 {
-    /* Rx	 */
-	if ( ( U1STAbits.URXDA == 1UL ) && ( U1STAbits.URXEN == 1UL ) )
+#if ( UART1_MODE == UART1_MODE_DMA )
+    /* Error: Overrun    */
+    uart1_dma_err_isr ();
+#else
+    ILAT_ISR_ENTER ();
+    
+    /* Rx: Drain the Rx FIFO	 */
+	if ( ( IFS1 & UART1_RXIF ) != 0UL )
 	{
-        while( U1STAbits.RIDLE == 0UL );
-        
-		/* Next action	 */
-		myState	 =	 (uint8_t)( U1RXREG );
-        
-        /* Clear Interrupt (IFS1<7>)  */
-        IFS1CLR |=  ( 1UL << 7UL );  
+        ILAT_BEGIN ( ILAT_U1RX, 0U );
+        uart1_rx_isr ();
+        ILAT_END ( ILAT_U1RX );
 	}
 
-	/* Tx	 */
-	if ( U1STAbits.UTXEN == 1UL )
+	/* Tx: Refill the Tx FIFO	 */
+	if ( ( ( IEC1 & UART1_TXIF ) != 0UL ) && ( ( IFS1 & UART1_TXIF ) != 0UL ) )
 	{
-        while( U1STAbits.TRMT == 0UL );
-        
-		/* Stop transmitting data when that character is found */
-		if ( *myPtr  == '\n' )
-		{
-			U1STAbits.UTXEN = 0UL;
-		}
-		else
-		{
-			U1TXREG	 =	 *++myPtr;
-		}
-        
-        /* Clear Interrupt (IFS1<8>)  */
-        IFS1CLR |=  ( 1UL << 8UL );
+        ILAT_BEGIN ( ILAT_U1TX, 0U );
+        uart1_tx_isr ();
+        ILAT_END ( ILAT_U1TX );
 	}
-}
\ No newline at end of file
+#endif
+}
+
+#if ( UART1_MODE == UART1_MODE_DMA )
+
+
+/**
+ * @brief       void DMA0Handler ( void ), DMA1Handler ( void )
+ * @details     UART1 DMA interruptions: Tx block sent ( channel 0 ) and Rx block complete ( channel 1 ).
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         UART1_MODE_DMA ( uart1.h ).
+ * @warning     N/A
+ */
+void INTMAP_ISR( U1TXDMA ) DMA0Handler ( void )
+{
+    ILAT_ISR_ENTER ();
+    
+    ILAT_BEGIN ( ILAT_U1TX, 0U );
+    uart1_dma_tx_isr ();
+    ILAT_END ( ILAT_U1TX );
+}
+
+void INTMAP_ISR( U1RXDMA ) DMA1Handler ( void )
+{
+    ILAT_ISR_ENTER ();
+    
+    ILAT_BEGIN ( ILAT_U1RX, 0U );
+    uart1_dma_rx_isr ();
+    ILAT_END ( ILAT_U1RX );
+}
+
+#endif
\ No newline at end of file
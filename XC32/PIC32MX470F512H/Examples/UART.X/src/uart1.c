@@ -0,0 +1,407 @@
+/**
+ * @brief       uart1.c
+ * @details     UART1 FIFO driver sources ( PIC32MX ), interrupt back end ( UART1_MODE_ISR ).
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero (aqueronteblog@gmail.com)
+ * @date        18/October/2026
+ * @version     18/October/2026    Only built with UART1_MODE_ISR, uart1dma.c is the DMA back end
+ *              18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+#include "../inc/uart1.h"
+
+#if ( UART1_MODE == UART1_MODE_ISR )
+
+
+/**@brief Variables.
+ */
+static uint8_t              myTxBuff[UART1_TX_BUFF_SIZE];   /*!<   Tx ring buffer                           */
+static volatile uint32_t    myTxHead;                       /*!<   Next free position ( main )              */
+static volatile uint32_t    myTxTail;                       /*!<   Next byte to send ( ISR )                */
+
+static uint8_t              myRxBuff[UART1_RX_BUFF_SIZE];   /*!<   Rx ring buffer                           */
+static volatile uint32_t    myRxHead;                       /*!<   Next free position ( ISR )               */
+static volatile uint32_t    myRxTail;                       /*!<   Next byte to read ( main )               */
+static volatile uint32_t    myRxDropped;                    /*!<   Bytes lost: Ring buffer full, overruns   */
+
+static uart1_rx_notify_t    myRxNotify;                     /*!<   Rx notify function                       */
+
+
+/**@brief Function prototypes.
+ */
+static uint32_t uart1_rx_drain ( void );
+
+
+
+/**
+ * @brief       void uart1_init ( uart1_rx_notify_t )
+ * @details     It empties the ring buffers and sets the Rx notify function.
+ *
+ *
+ * @param[in]    notify:    Rx notify function, NULL if not used.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         The UART1 interrupts are disabled.
+ * @warning     N/A
+ */
+void uart1_init ( uart1_rx_notify_t notify )
+{
+    myTxHead    =   0UL;
+    myTxTail    =   0UL;
+    myRxHead    =   0UL;
+    myRxTail    =   0UL;
+    myRxDropped =   0UL;
+    myRxNotify  =   notify;
+}
+
+
+/**
+ * @brief       uint8_t uart1_write ( const uint8_t* , uint8_t )
+ * @details     It copies data into the Tx ring buffer and enables the Tx interrupt.
+ *
+ *
+ * @param[in]    data:      Data to be transmitted.
+ * @param[in]    length:    How many bytes to be transmitted.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      How many bytes were taken ( less than length if the ring buffer is full )
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         Main context only ( single producer ).
+ * @warning     N/A
+ */
+uint8_t uart1_write ( const uint8_t* data, uint8_t length )
+{
+    uint8_t     i       =   0U;
+    uint32_t    head    =   myTxHead;
+    uint32_t    next    =   0UL;
+
+    /* Copy data while there is free room in the ring buffer  */
+    for ( i = 0U; i < length; i++ )
+    {
+        next    =   ( head + 1UL ) & UART1_TX_BUFF_MASK;
+
+        if ( next == myTxTail )
+        {
+            /* Ring buffer is full  */
+            break;
+        }
+
+        myTxBuff[head]  =   data[i];
+        head            =   next;
+    }
+
+    if ( i != 0U )
+    {
+        /* Publish the new data to the ISR   */
+        myTxHead    =   head;
+
+        /* Transmitter idle: Its interrupt flag may be already cleared, start it     */
+        if ( U1STAbits.TRMT == 1UL )
+        {
+            IFS1SET =   UART1_TXIF;
+        }
+
+        /* Enable the Tx interrupt  */
+        IEC1SET =   UART1_TXIF;
+    }
+
+    return i;
+}
+
+
+/**
+ * @brief       uint8_t uart1_read ( uint8_t* , uint8_t )
+ * @details     It takes the received bytes out of the Rx ring buffer. The bytes waiting in the hardware FIFO below
+ *              the Rx interrupt threshold are drained first.
+ *
+ *
+ * @param[in]    length:    Max. bytes to be read.
+ *
+ * @param[out]   data:      Received bytes.
+ *
+ *
+ * @return      How many bytes were read
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         Main context only ( single consumer ).
+ * @warning     The Rx interrupt is masked while the hardware FIFO is drained.
+ */
+uint8_t uart1_read ( uint8_t* data, uint8_t length )
+{
+    uint8_t     i       =   0U;
+    uint32_t    tail    =   myRxTail;
+
+#if ( UART1_RXISEL != 0b00 )
+    /* Bytes below the threshold    */
+    IEC1CLR =   UART1_RXIF;
+    (void)uart1_rx_drain ();
+    IEC1SET =   UART1_RXIF;
+#endif
+
+    for ( i = 0U; ( i < length ) && ( tail != myRxHead ); i++ )
+    {
+        data[i] =   myRxBuff[tail];
+        tail    =   ( tail + 1UL ) & UART1_RX_BUFF_MASK;
+    }
+
+    /* Release the room to the ISR   */
+    myRxTail    =   tail;
+
+    return i;
+}
+
+
+/**
+ * @brief       uint32_t uart1_rx_count ( void )
+ * @details     Bytes waiting in the Rx ring buffer.
+ *
+ *
+ * @param[in]    N/A.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      Bytes in the Rx ring buffer
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+uint32_t uart1_rx_count ( void )
+{
+    return ( myRxHead - myRxTail ) & UART1_RX_BUFF_MASK;
+}
+
+
+/**
+ * @brief       uint32_t uart1_rx_dropped ( void )
+ * @details     Bytes lost since uart1_init(): Rx ring buffer full or hardware FIFO overrun ( counted once ).
+ *
+ *
+ * @param[in]    N/A.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      Bytes lost
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+uint32_t uart1_rx_dropped ( void )
+{
+    return myRxDropped;
+}
+
+
+/**
+ * @brief       uint32_t uart1_tx_free ( void )
+ * @details     Free room in the Tx ring buffer.
+ *
+ *
+ * @param[in]    N/A.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      Bytes which can be written
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+uint32_t uart1_tx_free ( void )
+{
+    return ( myTxTail - myTxHead - 1UL ) & UART1_TX_BUFF_MASK;
+}
+
+
+/**
+ * @brief       uint8_t uart1_tx_busy ( void )
+ * @details     It checks if there is anything left to transmit.
+ *
+ *
+ * @param[in]    N/A.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      1: Data in the ring buffer, the FIFO or the shift register, 0: Idle
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+uint8_t uart1_tx_busy ( void )
+{
+    if ( ( myTxHead != myTxTail ) || ( U1STAbits.TRMT == 0UL ) )
+    {
+        return 1U;
+    }
+    else
+    {
+        return 0U;
+    }
+}
+
+
+/**
+ * @brief       void uart1_rx_isr ( void )
+ * @details     Rx interrupt: It drains the hardware FIFO and notifies how many bytes came in.
+ *
+ *
+ * @param[in]    N/A.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         It is called from U1Handler().
+ * @warning     N/A
+ */
+void uart1_rx_isr ( void )
+{
+    uint32_t    n   =   0UL;
+
+    n   =   uart1_rx_drain ();
+
+    /* Clear the Rx interrupt flag ( U1RXIF ), the FIFO is below the threshold now    */
+    IFS1CLR =   UART1_RXIF;
+
+    if ( ( n != 0UL ) && ( myRxNotify != NULL ) )
+    {
+        myRxNotify ( n );
+    }
+}
+
+
+/**
+ * @brief       void uart1_tx_isr ( void )
+ * @details     Tx interrupt: It refills the hardware FIFO from the Tx ring buffer while it has room.
+ *
+ *
+ * @param[in]    N/A.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         It is called from U1Handler().
+ * @warning     N/A
+ */
+void uart1_tx_isr ( void )
+{
+    uint32_t    tail    =   myTxTail;
+    uint32_t    head    =   myTxHead;
+
+    while ( ( U1STAbits.UTXBF == 0UL ) && ( tail != head ) )
+    {
+        U1TXREG =   myTxBuff[tail];
+        tail    =   ( tail + 1UL ) & UART1_TX_BUFF_MASK;
+    }
+
+    /* Release the room to the main context  */
+    myTxTail    =   tail;
+
+    /* Clear the Tx interrupt flag ( U1TXIF ), the FIFO is not empty now  */
+    IFS1CLR =   UART1_TXIF;
+
+    if ( tail == head )
+    {
+        /* Nothing else to transmit, disable the Tx interrupt  */
+        IEC1CLR =   UART1_TXIF;
+    }
+}
+
+
+/**
+ * @brief       uint32_t uart1_rx_drain ( void )
+ * @details     It moves the hardware Rx FIFO into the Rx ring buffer.
+ *
+ *
+ * @param[in]    N/A.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      Bytes stored
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         Only one context at a time: The ISR or uart1_read() with the Rx interrupt masked.
+ * @warning     N/A
+ */
+static uint32_t uart1_rx_drain ( void )
+{
+    uint32_t    head    =   myRxHead;
+    uint32_t    next    =   0UL;
+    uint32_t    n       =   0UL;
+    uint8_t     b       =   0U;
+
+    while ( U1STAbits.URXDA == 1UL )
+    {
+        b       =   (uint8_t)( U1RXREG & 0xFFUL );
+        next    =   ( head + 1UL ) & UART1_RX_BUFF_MASK;
+
+        if ( next == myRxTail )
+        {
+            /* Ring buffer is full  */
+            myRxDropped++;
+        }
+        else
+        {
+            myRxBuff[head]  =   b;
+            head            =   next;
+            n++;
+        }
+    }
+
+    /* Overrun: The FIFO is discarded when OERR is cleared   */
+    if ( U1STAbits.OERR == 1UL )
+    {
+        U1STAbits.OERR  =   0UL;
+        myRxDropped++;
+    }
+
+    /* Publish the new data  */
+    myRxHead    =   head;
+
+    return n;
+}
+
+#endif
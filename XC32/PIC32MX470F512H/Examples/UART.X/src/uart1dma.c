@@ -0,0 +1,701 @@
+/**
+ * @brief       uart1dma.c
+ * @details     UART1 FIFO driver sources ( PIC32MX ), DMA back end ( UART1_MODE_DMA ).
+ *
+ *              DMA channel 0 ( Tx ) writes one byte to U1TXREG on every UART1 Tx event, from the Tx ring buffer
+ *              or from the buffer of a descriptor. DMA channel 1 ( Rx ) reads one byte from U1RXREG on every
+ *              UART1 Rx event into the circular buffer and it is re-enabled at the end of every block.
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero (aqueronteblog@gmail.com)
+ * @date        18/October/2026
+ * @version     18/October/2026    The first Tx byte is forced only if the Tx FIFO has room
+ *              18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+#include <sys/kmem.h>
+#include "../inc/uart1.h"
+
+#if ( UART1_MODE == UART1_MODE_DMA )
+
+
+/**@brief Constants.
+ */
+#define UART1_DMA_RX_HALF   ( UART1_DMA_RX_SIZE / 2UL )     /*!<   Rx DMA block, no pattern        */
+#define UART1_DMA_FLAGS     0x000000FFUL                    /*!<   DCHxINT: Every interrupt flag   */
+
+
+/**@brief Variables.
+ */
+static uint8_t              myTxBuff[UART1_TX_BUFF_SIZE];   /*!<   Tx ring buffer                           */
+static volatile uint32_t    myTxHead;                       /*!<   Next free position ( main )              */
+static volatile uint32_t    myTxTail;                       /*!<   Next byte to send ( ISR )                */
+static uint32_t             myTxLength;                     /*!<   Tx ring buffer bytes of the DMA block    */
+static uart1_desc_t*        myTxFirst;                      /*!<   Queued descriptors: First                */
+static uart1_desc_t*        myTxLast;                       /*!<   Queued descriptors: Last                 */
+static uart1_desc_t*        myTxDesc;                       /*!<   Descriptor of the DMA block, NULL: Ring  */
+static volatile uint8_t     myTxActive;                     /*!<   1: DMA channel 0 is transmitting         */
+
+static uint8_t              myRxDma[UART1_DMA_RX_SIZE];     /*!<   Rx DMA circular buffer                   */
+static uint8_t              myRxBuff[UART1_RX_BUFF_SIZE];   /*!<   Rx ring buffer                           */
+static volatile uint32_t    myRxHead;                       /*!<   Next free position ( ISR )               */
+static volatile uint32_t    myRxTail;                       /*!<   Next byte to read ( main )               */
+static volatile uint32_t    myRxDropped;                    /*!<   Bytes lost: Ring buffer full, overruns   */
+
+static uart1_rx_notify_t    myRxNotify;                     /*!<   Rx notify function                       */
+
+
+/**@brief Function prototypes.
+ */
+static void     uart1_dma_tx_kick   ( void );
+static void     uart1_dma_tx_next   ( void );
+static void     uart1_dma_tx_start  ( const uint8_t* data, uint32_t length );
+static uint32_t uart1_dma_rx_move   ( uint32_t from, uint32_t length );
+
+
+
+/**
+ * @brief       void uart1_init ( uart1_rx_notify_t )
+ * @details     It empties the ring buffers, sets the Rx notify function and configures the DMA channels:
+ *
+ *                  - Channel 0, Tx:    U1TXREG <- Tx ring buffer or descriptor, one byte per UART1 Tx event.
+ *                  - Channel 1, Rx:    U1RXREG -> Circular buffer, one byte per UART1 Rx event, auto-enabled.
+ *
+ *
+ * @param[in]    notify:    Rx notify function, NULL if not used.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         The UART1 and the DMA interrupts are disabled, the priorities come from intmap_init().
+ * @warning     N/A
+ */
+void uart1_init ( uart1_rx_notify_t notify )
+{
+    myTxHead    =   0UL;
+    myTxTail    =   0UL;
+    myTxLength  =   0UL;
+    myTxFirst   =   NULL;
+    myTxLast    =   NULL;
+    myTxDesc    =   NULL;
+    myTxActive  =   0U;
+    myRxHead    =   0UL;
+    myRxTail    =   0UL;
+    myRxDropped =   0UL;
+    myRxNotify  =   notify;
+
+    /* DMA controller enabled    */
+    DMACONbits.ON   =   1UL;
+
+    /* Channel 0, Tx: Priority 2, started by a UART1 Tx event ( a free space in the Tx FIFO )    */
+    DCH0CON             =   0UL;
+    DCH0CONbits.CHPRI   =   2UL;
+    DCH0ECON            =   0UL;
+    DCH0ECONbits.CHSIRQ =   _UART1_TX_IRQ;
+    DCH0ECONbits.SIRQEN =   1UL;
+    DCH0DSA             =   KVA_TO_PA ( &U1TXREG );
+    DCH0DSIZ            =   1UL;
+    DCH0CSIZ            =   1UL;
+
+    /* Channel 0: Block transfer complete interrupt, flags cleared   */
+    DCH0INT             =   _DCH0INT_CHBCIE_MASK;
+
+    /* Channel 1, Rx: Priority 3, started by a UART1 Rx event, re-enabled at the end of every block ( circular )  */
+    DCH1CON             =   0UL;
+    DCH1CONbits.CHPRI   =   3UL;
+    DCH1CONbits.CHAEN   =   1UL;
+    DCH1ECON            =   0UL;
+    DCH1ECONbits.CHSIRQ =   _UART1_RX_IRQ;
+    DCH1ECONbits.SIRQEN =   1UL;
+    DCH1SSA             =   KVA_TO_PA ( &U1RXREG );
+    DCH1SSIZ            =   1UL;
+    DCH1DSA             =   KVA_TO_PA ( myRxDma );
+    DCH1DSIZ            =   UART1_DMA_RX_SIZE;
+    DCH1CSIZ            =   1UL;
+
+#if ( UART1_DMA_RX_PATTERN == UART1_DMA_NO_PATTERN )
+    /* Channel 1: Half full and block transfer complete ( full ) interrupts, flags cleared   */
+    DCH1INT             =   ( _DCH1INT_CHDHIE_MASK | _DCH1INT_CHBCIE_MASK );
+#else
+    /* Channel 1: The block ends with the pattern ( or full ), block transfer complete interrupt, flags cleared  */
+    DCH1DAT             =   UART1_DMA_RX_PATTERN;
+    DCH1ECONbits.PATEN  =   1UL;
+    DCH1INT             =   _DCH1INT_CHBCIE_MASK;
+#endif
+
+    /* Channel 1 enabled, it waits for the first byte    */
+    DCH1CONbits.CHEN    =   1UL;
+
+    /* Clear the DMA interrupt status flags ( DMA0IF, DMA1IF ) and enable them    */
+    IFS2CLR =   ( _IFS2_DMA0IF_MASK | _IFS2_DMA1IF_MASK );
+    IEC2SET =   ( _IEC2_DMA0IE_MASK | _IEC2_DMA1IE_MASK );
+}
+
+
+/**
+ * @brief       uint8_t uart1_write ( const uint8_t* , uint8_t )
+ * @details     It copies data into the Tx ring buffer and starts the DMA if it is idle.
+ *
+ *
+ * @param[in]    data:      Data to be transmitted.
+ * @param[in]    length:    How many bytes to be transmitted.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      How many bytes were taken ( less than length if the ring buffer is full )
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         Main context only ( single producer ).
+ * @warning     N/A
+ */
+uint8_t uart1_write ( const uint8_t* data, uint8_t length )
+{
+    uint8_t     i       =   0U;
+    uint32_t    head    =   myTxHead;
+    uint32_t    next    =   0UL;
+
+    /* Copy data while there is free room in the ring buffer  */
+    for ( i = 0U; i < length; i++ )
+    {
+        next    =   ( head + 1UL ) & UART1_TX_BUFF_MASK;
+
+        if ( next == myTxTail )
+        {
+            /* Ring buffer is full  */
+            break;
+        }
+
+        myTxBuff[head]  =   data[i];
+        head            =   next;
+    }
+
+    if ( i != 0U )
+    {
+        /* Publish the new data, start the DMA   */
+        myTxHead    =   head;
+        uart1_dma_tx_kick ();
+    }
+
+    return i;
+}
+
+
+/**
+ * @brief       void uart1_tx_submit ( uart1_desc_t* )
+ * @details     It queues a descriptor: Its data is sent from the caller buffer, without any copy, after the
+ *              bytes written before by uart1_write() and the descriptors queued before.
+ *
+ *
+ * @param[in]    desc:      Descriptor: data and length.
+ *
+ * @param[out]   desc:      done = 1 when the data was sent.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         Main context only. The descriptor is not queued ( done = 1 or never submitted ).
+ * @warning     The descriptor and its data must not change until done is 1.
+ */
+void uart1_tx_submit ( uart1_desc_t* desc )
+{
+    if ( desc->length == 0U )
+    {
+        /* Nothing to transmit   */
+        desc->done  =   1U;
+        return;
+    }
+
+    desc->done  =   0U;
+    desc->next  =   NULL;
+
+    /* Queue it behind the Tx ring buffer bytes written so far, DMA interrupt masked    */
+    IEC2CLR     =   _IEC2_DMA0IE_MASK;
+
+    desc->mark  =   myTxHead;
+
+    if ( myTxLast == NULL )
+    {
+        myTxFirst       =   desc;
+    }
+    else
+    {
+        myTxLast->next  =   desc;
+    }
+    myTxLast    =   desc;
+
+    if ( myTxActive == 0U )
+    {
+        uart1_dma_tx_next ();
+    }
+
+    IEC2SET     =   _IEC2_DMA0IE_MASK;
+}
+
+
+/**
+ * @brief       uint8_t uart1_read ( uint8_t* , uint8_t )
+ * @details     It takes the received bytes out of the Rx ring buffer.
+ *
+ *
+ * @param[in]    length:    Max. bytes to be read.
+ *
+ * @param[out]   data:      Received bytes.
+ *
+ *
+ * @return      How many bytes were read
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         Main context only ( single consumer ).
+ * @warning     The bytes of a block which is not complete yet are still in the Rx DMA circular buffer.
+ */
+uint8_t uart1_read ( uint8_t* data, uint8_t length )
+{
+    uint8_t     i       =   0U;
+    uint32_t    tail    =   myRxTail;
+
+    for ( i = 0U; ( i < length ) && ( tail != myRxHead ); i++ )
+    {
+        data[i] =   myRxBuff[tail];
+        tail    =   ( tail + 1UL ) & UART1_RX_BUFF_MASK;
+    }
+
+    /* Release the room to the ISR   */
+    myRxTail    =   tail;
+
+    return i;
+}
+
+
+/**
+ * @brief       uint32_t uart1_rx_count ( void )
+ * @details     Bytes waiting in the Rx ring buffer.
+ *
+ *
+ * @param[in]    N/A.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      Bytes in the Rx ring buffer
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+uint32_t uart1_rx_count ( void )
+{
+    return ( myRxHead - myRxTail ) & UART1_RX_BUFF_MASK;
+}
+
+
+/**
+ * @brief       uint32_t uart1_rx_dropped ( void )
+ * @details     Bytes lost since uart1_init(): Rx ring buffer full or hardware FIFO overrun ( counted once ).
+ *
+ *
+ * @param[in]    N/A.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      Bytes lost
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+uint32_t uart1_rx_dropped ( void )
+{
+    return myRxDropped;
+}
+
+
+/**
+ * @brief       uint32_t uart1_tx_free ( void )
+ * @details     Free room in the Tx ring buffer ( uart1_write() ).
+ *
+ *
+ * @param[in]    N/A.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      Bytes which can be written
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+uint32_t uart1_tx_free ( void )
+{
+    return ( myTxTail - myTxHead - 1UL ) & UART1_TX_BUFF_MASK;
+}
+
+
+/**
+ * @brief       uint8_t uart1_tx_busy ( void )
+ * @details     It checks if there is anything left to transmit.
+ *
+ *
+ * @param[in]    N/A.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      1: Data in the ring buffer, a descriptor queued, the FIFO or the shift register, 0: Idle
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+uint8_t uart1_tx_busy ( void )
+{
+    if ( ( myTxActive == 1U ) || ( myTxHead != myTxTail ) || ( U1STAbits.TRMT == 0UL ) )
+    {
+        return 1U;
+    }
+    else
+    {
+        return 0U;
+    }
+}
+
+
+/**
+ * @brief       void uart1_dma_tx_isr ( void )
+ * @details     DMA channel 0 interrupt: A Tx block was sent. It releases the Tx ring buffer room or the
+ *              descriptor and starts the next block.
+ *
+ *
+ * @param[in]    N/A.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         It is called from DMA0Handler().
+ * @warning     N/A
+ */
+void uart1_dma_tx_isr ( void )
+{
+    uart1_desc_t*   desc    =   myTxDesc;
+
+    /* Clear the channel flags, then the DMA0 interrupt flag ( DMA0IF )  */
+    DCH0INTCLR  =   UART1_DMA_FLAGS;
+    IFS2CLR     =   _IFS2_DMA0IF_MASK;
+
+    if ( desc == NULL )
+    {
+        /* Tx ring buffer block: Release the room to the main context    */
+        myTxTail    =   ( myTxTail + myTxLength ) & UART1_TX_BUFF_MASK;
+    }
+    else
+    {
+        /* Descriptor block: Unqueue it, its data may be reused  */
+        myTxFirst   =   desc->next;
+        if ( myTxFirst == NULL )
+        {
+            myTxLast    =   NULL;
+        }
+        desc->done  =   1U;
+    }
+
+    uart1_dma_tx_next ();
+}
+
+
+/**
+ * @brief       void uart1_dma_rx_isr ( void )
+ * @details     DMA channel 1 interrupt: A Rx block is complete. It moves the block into the Rx ring buffer and
+ *              notifies how many bytes came in.
+ *
+ *                  - Pattern:      From the start up to the pattern ( included ) or the whole buffer.
+ *                  - No pattern:   The half which was filled.
+ *
+ *
+ * @param[in]    N/A.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         It is called from DMA1Handler().
+ * @warning     The DMA fills the circular buffer again while the block is moved: It must run within one character
+ *              ( pattern ) or half the buffer ( no pattern ) from the end of the block, IPL7 ( INTMAP_U1RXDMA ).
+ */
+void uart1_dma_rx_isr ( void )
+{
+    uint32_t    flags   =   DCH1INT;
+    uint32_t    n       =   0UL;
+
+    /* Clear the channel flags, then the DMA1 interrupt flag ( DMA1IF )  */
+    DCH1INTCLR  =   UART1_DMA_FLAGS;
+    IFS2CLR     =   _IFS2_DMA1IF_MASK;
+
+#if ( UART1_DMA_RX_PATTERN == UART1_DMA_NO_PATTERN )
+    /* First half full: The DMA fills the second one     */
+    if ( ( flags & _DCH1INT_CHDHIF_MASK ) != 0UL )
+    {
+        n  +=   uart1_dma_rx_move ( 0UL, UART1_DMA_RX_HALF );
+    }
+
+    /* Second half full: The DMA fills the first one again   */
+    if ( ( flags & _DCH1INT_CHBCIF_MASK ) != 0UL )
+    {
+        n  +=   uart1_dma_rx_move ( UART1_DMA_RX_HALF, UART1_DMA_RX_HALF );
+    }
+#else
+    /* Pattern or full: The DMA fills the buffer again from the start, the copy goes ahead of it  */
+    if ( ( flags & _DCH1INT_CHBCIF_MASK ) != 0UL )
+    {
+        n   =   uart1_dma_rx_move ( 0UL, UART1_DMA_RX_SIZE );
+    }
+#endif
+
+    if ( ( n != 0UL ) && ( myRxNotify != NULL ) )
+    {
+        myRxNotify ( n );
+    }
+}
+
+
+/**
+ * @brief       void uart1_dma_err_isr ( void )
+ * @details     UART1 error interrupt: An overrun ( OERR ) stops the reception, the hardware FIFO is discarded and
+ *              it is counted.
+ *
+ *
+ * @param[in]    N/A.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         It is called from U1Handler().
+ * @warning     N/A
+ */
+void uart1_dma_err_isr ( void )
+{
+    if ( U1STAbits.OERR == 1UL )
+    {
+        U1STAbits.OERR  =   0UL;
+        myRxDropped++;
+    }
+
+    /* Clear the UART1 error interrupt flag ( U1EIF )    */
+    IFS1CLR =   UART1_EIF;
+}
+
+
+/**
+ * @brief       void uart1_dma_tx_kick ( void )
+ * @details     It starts the DMA if it is idle.
+ *
+ *
+ * @param[in]    N/A.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         Main context only.
+ * @warning     The DMA0 interrupt is masked while the state is checked.
+ */
+static void uart1_dma_tx_kick ( void )
+{
+    IEC2CLR =   _IEC2_DMA0IE_MASK;
+
+    if ( myTxActive == 0U )
+    {
+        uart1_dma_tx_next ();
+    }
+
+    IEC2SET =   _IEC2_DMA0IE_MASK;
+}
+
+
+/**
+ * @brief       void uart1_dma_tx_next ( void )
+ * @details     It starts the next Tx block, in order: The Tx ring buffer bytes written before the first queued
+ *              descriptor, then the descriptor. The ring buffer bytes are sent up to its end at most.
+ *
+ *
+ * @param[in]    N/A.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         DMA channel 0 idle. Called from the ISR or with the DMA0 interrupt masked.
+ * @warning     N/A
+ */
+static void uart1_dma_tx_next ( void )
+{
+    uint32_t    tail    =   myTxTail;
+    uint32_t    limit   =   0UL;
+
+    limit   =   ( myTxFirst != NULL ) ? myTxFirst->mark : myTxHead;
+
+    if ( tail != limit )
+    {
+        /* Tx ring buffer: Up to the limit or up to the end of the buffer    */
+        myTxLength  =   ( limit > tail ) ? ( limit - tail ) : ( UART1_TX_BUFF_SIZE - tail );
+        myTxDesc    =   NULL;
+        uart1_dma_tx_start ( &myTxBuff[tail], myTxLength );
+    }
+    else if ( myTxFirst != NULL )
+    {
+        /* Descriptor: Straight from the caller buffer   */
+        myTxDesc    =   myTxFirst;
+        uart1_dma_tx_start ( myTxDesc->data, myTxDesc->length );
+    }
+    else
+    {
+        /* Nothing else to transmit  */
+        myTxActive  =   0U;
+    }
+}
+
+
+/**
+ * @brief       void uart1_dma_tx_start ( const uint8_t* , uint32_t )
+ * @details     It starts DMA channel 0 with a block.
+ *
+ *
+ * @param[in]    data:      First byte, RAM or flash.
+ * @param[in]    length:    How many bytes, 1 to 65535.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The first byte is forced only if the Tx FIFO has room
+ *              18/October/2026    The ORIGIN
+ * @pre         DMA channel 0 idle.
+ * @warning     A forced cell writes U1TXREG even if the Tx FIFO is full, the byte would be lost: Chained from the
+ *              DMA0 interrupt, the Tx FIFO may be full already.
+ */
+static void uart1_dma_tx_start ( const uint8_t* data, uint32_t length )
+{
+    myTxActive  =   1U;
+
+    DCH0SSA     =   KVA_TO_PA ( data );
+    DCH0SSIZ    =   length;
+    DCH0CONSET  =   _DCH0CON_CHEN_MASK;
+
+    /* The Tx event of the free space may be gone already: The first byte is forced if it fits. Tx FIFO full:
+       The next Tx event starts the block  */
+    if ( U1STAbits.UTXBF == 0UL )
+    {
+        DCH0ECONSET =   _DCH0ECON_CFORCE_MASK;
+    }
+}
+
+
+/**
+ * @brief       uint32_t uart1_dma_rx_move ( uint32_t , uint32_t )
+ * @details     It moves a block of the Rx DMA circular buffer into the Rx ring buffer. With a pattern, it stops
+ *              after the first one.
+ *
+ *
+ * @param[in]    from:      First byte of the block.
+ * @param[in]    length:    Max. bytes of the block.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      Bytes stored
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         ISR context only.
+ * @warning     N/A
+ */
+static uint32_t uart1_dma_rx_move ( uint32_t from, uint32_t length )
+{
+    uint32_t    head    =   myRxHead;
+    uint32_t    next    =   0UL;
+    uint32_t    n       =   0UL;
+    uint32_t    i       =   0UL;
+    uint8_t     b       =   0U;
+
+    for ( i = from; i < ( from + length ); i++ )
+    {
+        b       =   myRxDma[i];
+        next    =   ( head + 1UL ) & UART1_RX_BUFF_MASK;
+
+        if ( next == myRxTail )
+        {
+            /* Ring buffer is full  */
+            myRxDropped++;
+        }
+        else
+        {
+            myRxBuff[head]  =   b;
+            head            =   next;
+            n++;
+        }
+
+#if ( UART1_DMA_RX_PATTERN != UART1_DMA_NO_PATTERN )
+        /* End of the block  */
+        if ( b == (uint8_t)UART1_DMA_RX_PATTERN )
+        {
+            break;
+        }
+#endif
+    }
+
+    /* Publish the new data  */
+    myRxHead    =   head;
+
+    return n;
+}
+
+#endif
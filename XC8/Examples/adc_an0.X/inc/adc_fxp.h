@@ -0,0 +1,80 @@
+/**
+ * @brief       adc_fxp.h
+ * @details     Fixed-point conversion and formatting of the ADC results header.
+ *
+ *              ADC counts are turned into voltage units by an integer multiply and shift:
+ *
+ *                  units = ( code * SCALE + 2^( ADC_FXP_SHIFT - 1 ) ) >> ADC_FXP_SHIFT
+ *                  SCALE = round( ADC_VDD_REF * 10^decimals * 2^ADC_FXP_SHIFT / ADC_RES )
+ *
+ *              SCALE is computed by the compiler from ADC_VDD_REF and ADC_RES, no float code is
+ *              linked. With ADC_VDD_REF = 5V and ADC_FXP_SHIFT = 18, the 1024 codes give the same digits
+ *              as the float formula printed with "%0.2f" ( centivolts ) or "%0.3f" ( millivolts ).
+ *
+ *              Oversampled results ( 10 + n bits ) use SCALE / 2^n, ADC_FXP_SCALE_OVS(). code*SCALE
+ *              still fits in 32 bits up to n = 3.
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero (aqueronteblog@gmail.com)
+ * @date        18/October/2026
+ * @version     18/October/2026    Scale factor for oversampled results
+ *              18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+#ifndef ADC_FXP_H_
+#define ADC_FXP_H_
+
+#include "board.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**@brief Constants.
+ */
+#ifndef ADC_VDD_REF
+#define ADC_VDD_REF     5.0                 /*!<   ADC VDD = 5V    */
+#endif
+
+#ifndef ADC_RES
+#define ADC_RES         ( 1024.0 - 1.0 )    /*!<   ADC 10-bit resolution    */
+#endif
+
+#define ADC_FXP_SHIFT   18U                 /*!<   Fixed-point fractional bits. code*SCALE must fit in 32 bits    */
+
+/**@brief Scale factor for a given number of units per volt ( evaluated at compile time ).
+ */
+#define ADC_FXP_SCALE( units_per_volt )     ( (uint32_t)( ( ( ADC_VDD_REF * (units_per_volt) * (double)( 1UL << ADC_FXP_SHIFT ) ) / ADC_RES ) + 0.5 ) )
+
+/**@brief Scale factor for an oversampled result of 10 + n bits ( evaluated at compile time ).
+ */
+#define ADC_FXP_SCALE_OVS( units_per_volt, n )  ( (uint32_t)( ( ( ADC_VDD_REF * (units_per_volt) * (double)( 1UL << ( ADC_FXP_SHIFT - (n) ) ) ) / ADC_RES ) + 0.5 ) )
+
+#define ADC_FXP_SCALE_MV    ADC_FXP_SCALE( 1000.0 )     /*!<   ADC counts to millivolts     */
+#define ADC_FXP_SCALE_CV    ADC_FXP_SCALE( 100.0 )      /*!<   ADC counts to centivolts     */
+
+/**@brief ADC counts to millivolts/centivolts.
+ */
+#define adc_fxp_to_mv( code )   adc_fxp_convert ( (code), ADC_FXP_SCALE_MV )
+#define adc_fxp_to_cv( code )   adc_fxp_convert ( (code), ADC_FXP_SCALE_CV )
+
+
+/**@brief Function prototypes.
+ */
+uint16_t adc_fxp_convert    ( uint16_t code, uint32_t scale );
+uint8_t  adc_fxp_format     ( uint16_t value, uint8_t decimals, uint8_t* buff );
+
+
+/**@brief Variables.
+ */
+
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ADC_FXP_H_ */
@@ -0,0 +1,213 @@
+/**
+ * @brief       adc_scan.h
+ * @details     Multi-channel ADC scan engine header.
+ *
+ *              A scan converts every channel of a table once, in order. The whole sequence is run
+ *              by the interrupts:
+ *
+ *                  - ADIF: The result is stored in the channel ring buffer and the next channel is
+ *                          selected. Timer4 is started for its acquisition delay.
+ *                  - TMR4IF: The acquisition delay is over, the conversion is started ( GO ).
+ *
+ *              Hardware-paced mode ( adc_scan_trigger_start() ): Timer1 and the CCP5 special event
+ *              trigger ( compare mode, 0b1011 ) start every conversion at an exact rate, with no CPU
+ *              involvement. The channels are converted round-robin, the ADIF interrupt selects the next
+ *              one, so its acquisition takes place until the next trigger. Each channel is sampled at
+ *              f_sample / count.
+ *
+ *              The trigger period must be longer than TACQ + TCNV + the ADIF interrupt time ( ~50
+ *              instruction cycles ), e.g. a few kHz at F_OSC = 8MHz or more.
+ *
+ *              Sleep conversion mode ( adc_scan_sleep_enable() ): The acquisition delay still runs awake
+ *              ( Timer4 ), but the conversion is started by adc_scan_sleep() from the main loop, right
+ *              before SLEEP. The core and every F_OSC peripheral are stopped while the ADC converts with
+ *              FRC, so there is no digital switching noise and the current drops to the ADC one. The
+ *              peripherals which keep running in SLEEP ( ADC_SCAN_GATE_xxx ) are turned off as well and
+ *              restored on ADIF wake-up:
+ *
+ *                  1. TMR4IF: Acquisition delay over, conversion pending.
+ *                  2. adc_scan_sleep(): GIE off, gate, GO, SLEEP ... ADIF wakes the uC up, restore, GIE back.
+ *                  3. ADIF: The result is stored and the next channel is acquired.
+ *
+ *              Oversampling ( ovs = n, 1 to 3 ): The channel is converted 4^n times in a row, the samples
+ *              are accumulated in the ADIF interrupt and decimated to 10 + n bits ( 11 to 13 bits ):
+ *
+ *                  - ADC_SCAN_AVG_BOXCAR: result = sum( 4^n samples ) >> n ( integrate and dump ).
+ *                  - ADC_SCAN_AVG_CIC2:   2nd order CIC decimator, R = 4^n, result = y >> 3n. Better
+ *                                         rejection of the noise above the output rate ( sinc^2 ), the
+ *                                         first 2 results after adc_scan_init() are not valid.
+ *
+ *              The gain only holds if the input has at least 1 LSB of noise ( dither ).
+ *
+ *              Rate/resolution trade-off, one channel, TACQ = 5us, TAD = FRC ( 1.6us typ. ), ~120
+ *              instruction cycles per sample ( ADIF + TMR4IF interrupts ). Output rate in Hz, estimated:
+ *
+ *                  F_OSC ( conf_clk() ) | 10-bit | 11-bit ( n=1 ) | 12-bit ( n=2 ) | 13-bit ( n=3 )
+ *                  ---------------------|--------|----------------|----------------|---------------
+ *                   1MHz                |  1980  |      495       |      124       |       31
+ *                   4MHz                |  6970  |     1740       |      436       |      109
+ *                   8MHz                | 12000  |     3000       |      750       |      187
+ *                  16MHz                | 18700  |     4680       |     1170       |      292
+ *                  32MHz                | 26000  |     6500       |     1630       |      407
+ *
+ *              Example:
+ *
+ *                  static uint16_t             myAN0buff[8];
+ *                  static uint16_t             myTempbuff[4];
+ *                  static adc_scan_channel_t   myChannels[] = {
+ *                      { .chs = ADC_SCAN_AN0,  .acq = ADC_SCAN_ACQ_US( 5U ),   .buff = myAN0buff,  .size = 8U, .ovs = 2U, .avg = ADC_SCAN_AVG_BOXCAR },
+ *                      { .chs = ADC_SCAN_TEMP, .acq = ADC_SCAN_ACQ_US( 200U ), .buff = myTempbuff, .size = 4U }
+ *                  };
+ *
+ *                  adc_scan_init  ( &myChannels[0], 2U );
+ *                  adc_scan_start ();
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero (aqueronteblog@gmail.com)
+ * @date        18/October/2026
+ * @version     18/October/2026    Sleep conversion mode
+ *              18/October/2026    Oversampling and decimation ( boxcar, CIC2 )
+ *              18/October/2026    Hardware-paced mode ( CCP5 special event trigger )
+ *              18/October/2026    The ORIGIN
+ * @pre         The ADC must be configured by conf_adc(). The temperature indicator ( TSEN ), the FVR
+ *              ( FVREN ) and the DAC ( DACEN ) must be enabled by the user before they are scanned.
+ * @warning     Timer4 is used by the engine. Timer1 and CCP5 are used by the hardware-paced mode. The sleep
+ *              conversion mode needs the FRC ADC clock and it is not used in the hardware-paced mode.
+ */
+#ifndef ADC_SCAN_H_
+#define ADC_SCAN_H_
+
+#include "board.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**@brief Constants.
+ */
+#ifndef ADC_SCAN_F_OSC
+#define ADC_SCAN_F_OSC      1000000UL       /*!<   F_OSC set by conf_clk()    */
+#endif
+
+/**@brief Timer4 prescaler: the acquisition delay resolution is kept at 1us or better up to F_OSC = 16MHz.
+ */
+#if   ( ( ADC_SCAN_F_OSC / 4UL ) <= 1000000UL )
+#define ADC_SCAN_T4CKPS     0b00            /*!<   Prescaler 1     */
+#define ADC_SCAN_T4_PRESC   1UL
+#elif ( ( ADC_SCAN_F_OSC / 4UL ) <= 4000000UL )
+#define ADC_SCAN_T4CKPS     0b01            /*!<   Prescaler 4     */
+#define ADC_SCAN_T4_PRESC   4UL
+#else
+#define ADC_SCAN_T4CKPS     0b10            /*!<   Prescaler 16    */
+#define ADC_SCAN_T4_PRESC   16UL
+#endif
+
+/**@brief Acquisition delay in Timer4 counts ( rounded up, max. 255 ). 0: No delay.
+ */
+#define ADC_SCAN_ACQ_US( us )   ( (uint8_t)( ( ( (uint32_t)(us) * ( ADC_SCAN_F_OSC / ( 4UL * ADC_SCAN_T4_PRESC ) ) ) + 999999UL ) / 1000000UL ) )
+
+
+/**@brief Hardware-paced mode: Timer1 counts ( F_OSC/4, prescaler 1 ) per conversion for a given sample rate in Hz.
+ */
+#define ADC_SCAN_TRIGGER_PERIOD( f_sample )     ( (uint16_t)( ( ADC_SCAN_F_OSC / 4UL ) / (uint32_t)(f_sample) ) )
+
+
+/**@brief Oversampling: maximum n ( 13-bit results ).
+ */
+#define ADC_SCAN_OVS_MAX        3U
+
+/**@brief Oversampling: output rate for a given sample rate and n.
+ */
+#define ADC_SCAN_OVS_RATE( f_sample, n )    ( (uint32_t)(f_sample) >> ( 2U * (n) ) )
+
+
+/**@brief Oversampling: decimation filter.
+ */
+typedef enum{
+  ADC_SCAN_AVG_BOXCAR   = 0U,       /*!<   Sum of 4^n samples >> n      */
+  ADC_SCAN_AVG_CIC2     = 1U        /*!<   2nd order CIC, R = 4^n       */
+} adc_scan_avg_t;
+
+
+/**@brief Sleep conversion mode: peripherals turned off during the conversion ( only if they are on ).
+ */
+typedef enum{
+  ADC_SCAN_GATE_NONE        = 0U,               /*!<   Nothing is gated                                   */
+  ADC_SCAN_GATE_TMR1        = ( 1U << 0U ),     /*!<   Timer1 ( SOSC/LFINTOSC/T1CKI keep it running )     */
+  ADC_SCAN_GATE_COMPARATORS = ( 1U << 1U ),     /*!<   Comparators C1 and C2                              */
+  ADC_SCAN_GATE_WDT         = ( 1U << 2U ),     /*!<   WDT ( WDTE = SWDTEN ), no wake-up by the WDT       */
+  ADC_SCAN_GATE_ALL         = 0b111             /*!<   All of the above                                   */
+} adc_scan_gate_t;
+
+
+/**@brief ADC channels ( ADCON0.CHS ).
+ */
+typedef enum{
+  ADC_SCAN_AN0      = 0U,           /*!<   AN0                              */
+  ADC_SCAN_AN1      = 1U,           /*!<   AN1                              */
+  ADC_SCAN_AN2      = 2U,           /*!<   AN2                              */
+  ADC_SCAN_AN3      = 3U,           /*!<   AN3                              */
+  ADC_SCAN_AN4      = 4U,           /*!<   AN4                              */
+  ADC_SCAN_AN5      = 5U,           /*!<   AN5                              */
+  ADC_SCAN_AN6      = 6U,           /*!<   AN6                              */
+  ADC_SCAN_AN7      = 7U,           /*!<   AN7                              */
+  ADC_SCAN_AN8      = 8U,           /*!<   AN8                              */
+  ADC_SCAN_AN9      = 9U,           /*!<   AN9                              */
+  ADC_SCAN_AN10     = 10U,          /*!<   AN10                             */
+  ADC_SCAN_AN11     = 11U,          /*!<   AN11                             */
+  ADC_SCAN_AN12     = 12U,          /*!<   AN12                             */
+  ADC_SCAN_AN13     = 13U,          /*!<   AN13                             */
+  ADC_SCAN_TEMP     = 0b11101,      /*!<   Temperature indicator            */
+  ADC_SCAN_DAC      = 0b11110,      /*!<   DAC output                       */
+  ADC_SCAN_FVR      = 0b11111       /*!<   FVR ( Fixed Voltage Reference )  */
+} adc_scan_chs_t;
+
+
+/**@brief Channel: configuration, ring buffer of results and decimator state.
+ */
+typedef struct{
+  adc_scan_chs_t    chs;            /*!<   ADC channel                                                  */
+  uint8_t           acq;            /*!<   Acquisition delay, ADC_SCAN_ACQ_US()                         */
+  uint16_t*         buff;           /*!<   Ring buffer of results                                       */
+  uint8_t           size;           /*!<   Ring buffer size, it must be a power of 2 ( max. 128 )       */
+  uint8_t           ovs;            /*!<   Oversampling n: 0 = Off, 1 to ADC_SCAN_OVS_MAX               */
+  adc_scan_avg_t    avg;            /*!<   Decimation filter                                            */
+  volatile uint8_t  head;           /*!<   Next free position ( ISR )                                   */
+  volatile uint8_t  tail;           /*!<   Next result to read ( main )                                 */
+  volatile uint8_t  overrun;        /*!<   Results lost because the ring buffer was full                */
+  uint8_t           n_acc;          /*!<   Samples accumulated ( ISR )                                  */
+  uint32_t          integ1;         /*!<   Accumulator / 1st CIC integrator ( ISR )                     */
+  uint32_t          integ2;         /*!<   2nd CIC integrator ( ISR )                                   */
+  uint32_t          comb1;          /*!<   1st CIC comb delay ( ISR )                                   */
+  uint32_t          comb2;          /*!<   2nd CIC comb delay ( ISR )                                   */
+} adc_scan_channel_t;
+
+
+/**@brief Function prototypes.
+ */
+void     adc_scan_init          ( adc_scan_channel_t* channels, uint8_t count );
+uint8_t  adc_scan_start         ( void );
+uint8_t  adc_scan_trigger_start ( uint16_t period );
+void     adc_scan_trigger_stop  ( void );
+void     adc_scan_sleep_enable  ( uint8_t gate );
+void     adc_scan_sleep_disable ( void );
+uint8_t  adc_scan_sleep         ( void );
+uint8_t  adc_scan_busy          ( void );
+uint8_t  adc_scan_available     ( const adc_scan_channel_t* channel );
+uint8_t  adc_scan_read          ( adc_scan_channel_t* channel, uint16_t* result );
+void     adc_scan_isr           ( void );
+void     adc_scan_tmr4_isr      ( void );
+
+
+/**@brief Variables.
+ */
+
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ADC_SCAN_H_ */
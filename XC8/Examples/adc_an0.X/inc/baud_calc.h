@@ -0,0 +1,137 @@
+/**
+ * @brief       baud_calc.h
+ * @details     Baud rate generator solver header ( PIC16F1937: EUSART, asynchronous mode ).
+ *
+ *              baud = F_OSC / ( m*( SPBRG + 1 ) ), candidates in order:
+ *
+ *                  - 0: BRG16 = 1, BRGH = 1:   m = 4,  SPBRG 16-bit
+ *                  - 1: BRG16 = 1, BRGH = 0:   m = 16, SPBRG 16-bit
+ *                  - 2: BRG16 = 0, BRGH = 1:   m = 16, SPBRG 8-bit
+ *                  - 3: BRG16 = 0, BRGH = 0:   m = 64, SPBRG 8-bit
+ *
+ *              Every candidate takes the SPBRG with the lower error of F_OSC/( m*baud ) rounded down and up ( the
+ *              nearest one is not always the best, the error is relative to the divider ), the candidate with the
+ *              lowest error is kept, ties go to the first one. The error is given in 0.01% of the baud rate:
+ *
+ *                  error = | F_OSC - m*( SPBRG + 1 )*baud | / ( m*( SPBRG + 1 )*baud )
+ *
+ *                  - BAUD_CALC_EUSART_DEFINE( name, f_osc, baud ): Compile time. The search is unrolled into the
+ *                    enumerators of name ( name_BRG16, name_BRGH, name_SPBRGH, name_SPBRGL, name_ERROR ), the
+ *                    build fails ( negative array size ) if the error is above BAUD_CALC_ERR_MAX.
+ *                  - baud_calc_eusart(): The same search at run time, e.g. after a clock switch.
+ *
+ *              BAUD_CALC_ERR_MAX: The receiver samples the middle of the bits, a 10-bit frame ( 8N1 ) drifts half
+ *              a bit at 5%, shared by both ends: 2.5% each by default.
+ *
+ *              Example: 115200 baud at F_OSC = 16MHz
+ *
+ *                  BAUD_CALC_EUSART_DEFINE( myBaud, 16000000UL, 115200UL );
+ *
+ *                  BAUDCONbits.BRG16   =   myBaud_BRG16;
+ *                  TXSTAbits.BRGH      =   myBaud_BRGH;
+ *                  SPBRGH              =   myBaud_SPBRGH;
+ *                  SPBRGL              =   myBaud_SPBRGL;
+ *
+ *              Result: BRG16 = 1, BRGH = 1, SPBRG = 34 ( 114286 baud, error 79: 0.79% ).
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero (aqueronteblog@gmail.com)
+ * @date        18/October/2026
+ * @version     18/October/2026    SPBRG rounded down or up, the one with the lower error
+ *              18/October/2026    The ORIGIN
+ * @pre         baud >= 25 and F_OSC <= 100MHz ( 32-bit arithmetic ).
+ * @warning     N/A
+ */
+#ifndef BAUD_CALC_H_
+#define BAUD_CALC_H_
+
+#include "board.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**@brief Constants.
+ */
+#ifndef BAUD_CALC_ERR_MAX
+#define BAUD_CALC_ERR_MAX   250U        /*!<   Max. error, 0.01%: 2.50%                                 */
+#endif
+
+#define BAUD_CALC_NONE      0x7FFF      /*!<   Error of a candidate which is 25% off or more            */
+
+/**@brief SPBRG + 1 for a divider m, rounded down and up, 1 to max.
+ */
+#define BAUD_CALC_CLAMP( n, max )           ( ( (n) == 0UL ) ? 1UL : ( (n) > (uint32_t)(max) ) ? (uint32_t)(max) : (n) )
+#define BAUD_CALC_N_LO( f, baud, m, max )   BAUD_CALC_CLAMP( ( (uint32_t)(f) / ( (uint32_t)(m) * (uint32_t)(baud) ) ), max )
+#define BAUD_CALC_N_HI( f, baud, m, max )   BAUD_CALC_CLAMP( ( (uint32_t)(f) / ( (uint32_t)(m) * (uint32_t)(baud) ) + 1UL ), max )
+
+/**@brief Error in 0.01% of the clock a divider needs ( mnb = m*( SPBRG + 1 )*baud ): Its distance to f over mnb.
+ */
+#define BAUD_CALC_DIFF( f, mnb )            ( ( (uint32_t)(f) > (uint32_t)(mnb) ) ? ( (uint32_t)(f) - (uint32_t)(mnb) ) : ( (uint32_t)(mnb) - (uint32_t)(f) ) )
+#define BAUD_CALC_ERR_MNB( f, mnb )         ( ( ( BAUD_CALC_DIFF( f, mnb ) * 4UL ) >= (uint32_t)(mnb) ) ? BAUD_CALC_NONE : \
+                                              (int)( ( BAUD_CALC_DIFF( f, mnb ) * 100UL ) / ( (uint32_t)(mnb) / 100UL ) ) )
+
+/**@brief SPBRG + 1 for a divider m: The lower error of both, ties go to the one rounded down. Its error.
+ */
+#define BAUD_CALC_N( f, baud, m, max )      ( ( BAUD_CALC_ERR_MNB( f, (uint32_t)(m) * BAUD_CALC_N_HI( f, baud, m, max ) * (uint32_t)(baud) ) < \
+                                                BAUD_CALC_ERR_MNB( f, (uint32_t)(m) * BAUD_CALC_N_LO( f, baud, m, max ) * (uint32_t)(baud) ) ) ? \
+                                              BAUD_CALC_N_HI( f, baud, m, max ) : BAUD_CALC_N_LO( f, baud, m, max ) )
+#define BAUD_CALC_ERR( f, baud, m, max )    BAUD_CALC_ERR_MNB( f, (uint32_t)(m) * BAUD_CALC_N( f, baud, m, max ) * (uint32_t)(baud) )
+
+/**@brief Search step k: error of the candidate, lowest error and best candidate so far.
+ */
+#define BAUD_CALC_FIRST( name, err )            name##_e0 = (err), name##_m0 = name##_e0, name##_c0 = 0
+#define BAUD_CALC_STEP( name, k, prev, err )    name##_e##k = (err), \
+                                                name##_m##k = ( name##_e##k < name##_m##prev ) ? name##_e##k : name##_m##prev, \
+                                                name##_c##k = ( name##_e##k < name##_m##prev ) ? k : name##_c##prev
+
+/**@brief Divider and SPBRG size of candidate k.
+ */
+#define BAUD_CALC_M( k )        ( ( (k) == 0 ) ? 4UL : ( (k) == 3 ) ? 64UL : 16UL )
+#define BAUD_CALC_MAX( k )      ( ( (k) < 2 ) ? 65536UL : 256UL )
+
+
+/**@brief EUSART: name_BRG16 ( BAUDCON ), name_BRGH ( TXSTA ), name_SPBRGH, name_SPBRGL and name_ERROR ( 0.01% ).
+ */
+#define BAUD_CALC_EUSART_DEFINE( name, f_osc, baud )    \
+    enum{ \
+        BAUD_CALC_FIRST( name, BAUD_CALC_ERR( f_osc, baud, 4UL, 65536UL ) ), \
+        BAUD_CALC_STEP( name, 1, 0, BAUD_CALC_ERR( f_osc, baud, 16UL, 65536UL ) ), \
+        BAUD_CALC_STEP( name, 2, 1, BAUD_CALC_ERR( f_osc, baud, 16UL, 256UL ) ), \
+        BAUD_CALC_STEP( name, 3, 2, BAUD_CALC_ERR( f_osc, baud, 64UL, 256UL ) ), \
+        name##_BRG16    = ( name##_c3 < 2 ) ? 1 : 0, \
+        name##_BRGH     = ( ( name##_c3 & 1 ) == 0 ) ? 1 : 0, \
+        name##_SPBRGH   = (int)( ( ( BAUD_CALC_N( f_osc, baud, BAUD_CALC_M( name##_c3 ), BAUD_CALC_MAX( name##_c3 ) ) - 1UL ) >> 8U ) & 0xFFUL ), \
+        name##_SPBRGL   = (int)( ( BAUD_CALC_N( f_osc, baud, BAUD_CALC_M( name##_c3 ), BAUD_CALC_MAX( name##_c3 ) ) - 1UL ) & 0xFFUL ), \
+        name##_ERROR    = name##_m3 \
+    }; \
+    typedef char name##_baud_error[ ( name##_m3 <= (int)BAUD_CALC_ERR_MAX ) ? 1 : -1 ]
+
+
+/**@brief Settings worked out at run time.
+ */
+typedef struct{
+  uint8_t   brg16;          /*!<   BAUDCON.BRG16                */
+  uint8_t   brgh;           /*!<   TXSTA.BRGH                   */
+  uint16_t  spbrg;          /*!<   SPBRGH:SPBRGL                */
+  uint16_t  error;          /*!<   Error, 0.01%                 */
+} baud_calc_eusart_t;
+
+
+/**@brief Function prototypes.
+ */
+uint8_t baud_calc_eusart    ( uint32_t f_osc, uint32_t baud, baud_calc_eusart_t* cfg );
+
+
+/**@brief Variables.
+ */
+
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* BAUD_CALC_H_ */
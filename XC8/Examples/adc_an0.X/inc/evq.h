@@ -0,0 +1,118 @@
+/**
+ * @brief       evq.h
+ * @details     Single-producer single-consumer event queue header.
+ *
+ *              The interrupts post events ( evq_post() ) and the main loop takes them out ( evq_get(),
+ *              evq_drain() ) in the same order. Every event is kept, unlike a shared flag where a second
+ *              interrupt overwrites the first one before the main loop reads it.
+ *
+ *              No interrupt is disabled on either side:
+ *
+ *                  - head: Written by the producer only, after the event is stored in the buffer.
+ *                  - tail: Written by the consumer only, after the event is read from the buffer.
+ *
+ *              Both indices are free-running and wrap on their own type, the number of events is
+ *              head - tail. Each index is read and written in a single access:
+ *
+ *                  - PIC16 ( XC8 ):  uint8_t, single-byte access. EVQ_SIZE up to 128.
+ *                  - PIC32 ( XC32 ): uint32_t, aligned word, single lw/sw instruction.
+ *
+ *              When the queue is full the new event is dropped and counted ( evq_dropped() ), the
+ *              events already queued are never overwritten.
+ *
+ *              Example:
+ *
+ *                  static evq_t    myEvents;
+ *
+ *                  ISR:        (void)evq_post ( &myEvents, EVT_TIMER, 0U );
+ *
+ *                  main:       evq_init ( &myEvents );
+ *                              while ( evq_get ( &myEvents, &my_evt ) == 1U ) { switch ( my_evt.id ) ... }
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero (aqueronteblog@gmail.com)
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         One producer per queue. On PIC16 every interrupt source runs at the same level, so all of
+ *              them may post to the same queue. On PIC32 the ISRs of different priority levels preempt
+ *              each other: one queue per priority level.
+ * @warning     N/A
+ */
+#ifndef EVQ_H_
+#define EVQ_H_
+
+#include <stdint.h>
+#include "board.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**@brief Constants.
+ */
+#ifndef EVQ_SIZE
+#define EVQ_SIZE        8U              /*!<   Events per queue, power of 2    */
+#endif
+
+#define EVQ_MASK        ( EVQ_SIZE - 1U )
+
+#if ( ( EVQ_SIZE & EVQ_MASK ) != 0U ) || ( EVQ_SIZE < 2U )
+#error "EVQ_SIZE must be a power of 2"
+#endif
+
+#if defined( __XC8 ) && ( EVQ_SIZE > 128U )
+#error "EVQ_SIZE must be 128 or less on PIC16 ( uint8_t indices )"
+#endif
+
+
+/**@brief Queue index: One single access on each architecture.
+ */
+#if defined( __XC8 )
+typedef uint8_t     evq_idx_t;
+#else
+typedef uint32_t    evq_idx_t;
+#endif
+
+
+/**@brief Event.
+ */
+typedef struct{
+  uint8_t       id;                 /*!<   Event identifier, defined by the user    */
+  uint16_t      data;               /*!<   Event data                               */
+} evq_event_t;
+
+typedef void ( *evq_handler_t )( const evq_event_t* evt );
+
+
+/**@brief Queue.
+ */
+typedef struct{
+  volatile evq_event_t  buff[EVQ_SIZE];     /*!<   Events                                   */
+  volatile evq_idx_t    head;               /*!<   Next event to be posted ( producer )     */
+  volatile evq_idx_t    tail;               /*!<   Next event to be read ( consumer )       */
+  volatile evq_idx_t    dropped;            /*!<   Events lost, queue full ( producer )     */
+} evq_t;
+
+
+/**@brief Function prototypes.
+ */
+void      evq_init      ( evq_t* q );
+uint8_t   evq_post      ( evq_t* q, uint8_t id, uint16_t data );
+uint8_t   evq_get       ( evq_t* q, evq_event_t* evt );
+evq_idx_t evq_drain     ( evq_t* q, evq_handler_t handler );
+evq_idx_t evq_count     ( const evq_t* q );
+evq_idx_t evq_dropped   ( const evq_t* q );
+
+
+/**@brief Variables.
+ */
+
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* EVQ_H_ */
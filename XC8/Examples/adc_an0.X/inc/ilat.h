@@ -0,0 +1,161 @@
+/**
+ * @brief       ilat.h
+ * @details     ISR latency and duration instrumentation header.
+ *
+ *              Every instrumented handler is timestamped when it starts and when it ends with a free-running
+ *              timer:
+ *
+ *                  - PIC16 ( XC8 ):  Timer1, F_OSC/4, 1:1, 16-bit. ilat_init() starts it.
+ *                  - PIC32 ( XC32 ): CP0 Count register, SYSCLK/2, 32-bit ( sysclk_sys_hz() ).
+ *
+ *              Per source, in RAM: number of calls, min/max/sum of the latency and of the duration, and a
+ *              histogram of the duration ( ILAT_BINS log2 bins ):
+ *
+ *                  - bin 0:    duration < 2^ILAT_BIN_SHIFT ticks
+ *                  - bin k:    2^( ILAT_BIN_SHIFT + k - 1 ) <= duration < 2^( ILAT_BIN_SHIFT + k )
+ *                  - last bin: anything longer
+ *
+ *              Latency = late + ticks from ILAT_ISR_ENTER() to ILAT_BEGIN(). late is the time elapsed before
+ *              the ISR was entered when the source knows it ( e.g. count of a timer since its period match,
+ *              in ticks ), 0 otherwise: the latency covers the dispatch inside the ISR only.
+ *
+ *              ilat_dump() sends every source through a write function ( binary frame, little-endian ),
+ *              tools/ilat_decode.py decodes it on the host:
+ *
+ *                  'I' 'L' 'A' 'T', version ( 1 ), tick size ( 2 | 4 ), sources, bins, bin shift, tick Hz ( u32 )
+ *                  Per source: id ( u8 ), n ( u32 ), lat_min, lat_max ( tick ), lat_sum ( u32 ),
+ *                              dur_min, dur_max ( tick ), dur_sum ( u32 ), hist[bins] ( u16 )
+ *                  Checksum ( u8 ): Every byte after the magic adds up to 0
+ *
+ *              Opt-in: With ILAT_ENABLE = 0 ( default ) the hooks expand to nothing and ilat.c is empty.
+ *
+ *              ILAT_ISR_ENTER() keeps the entry timestamp in a local variable of the ISR, so the nested
+ *              interrupts of the PIC32 ( several priority levels ) do not overwrite it.
+ *
+ *              Usage:
+ *
+ *                  ISR:    ILAT_ISR_ENTER ();                  // First statement of the ISR
+ *                          ILAT_BEGIN ( 0U, 0U );  handler ();  ILAT_END ( 0U );
+ *
+ *                  main:   ilat_init ();
+ *                          ...
+ *                          ilat_dump ( eusart_write, 1U );     // On demand, the statistics are reset
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero (aqueronteblog@gmail.com)
+ * @date        18/October/2026
+ * @version     18/October/2026    PIC16: Timer1 ( F_OSC/4 ) stops in SLEEP, the timestamps around SLEEP are invalid
+ *              18/October/2026    PIC32: Tick rate from the SYSCLK in use ( sysclk.h )
+ *              18/October/2026    The ORIGIN
+ * @pre         PIC16: Timer1 is used by the module. It is clocked by F_OSC/4, so it stops in SLEEP whatever
+ *              the gate mask of adc_scan_sleep_enable(): The timestamps around SLEEP are invalid.
+ * @warning     The sums wrap after 2^32 ticks, the decoder reports the mean of the last reset only.
+ */
+#ifndef ILAT_H_
+#define ILAT_H_
+
+#include <stdint.h>
+#include <string.h>
+#include "board.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**@brief Constants.
+ */
+#ifndef ILAT_ENABLE
+#define ILAT_ENABLE     0U              /*!<   1: Instrumentation compiled in    */
+#endif
+
+#ifndef ILAT_SOURCES
+#define ILAT_SOURCES    4U              /*!<   Instrumented sources, ids 0 to ILAT_SOURCES - 1    */
+#endif
+
+#ifndef ILAT_BINS
+#define ILAT_BINS       8U              /*!<   Histogram bins per source    */
+#endif
+
+#ifndef ILAT_BIN_SHIFT
+#define ILAT_BIN_SHIFT  4U              /*!<   Bin 0: Durations below 2^ILAT_BIN_SHIFT ticks    */
+#endif
+
+#define ILAT_VERSION    1U              /*!<   Dump format    */
+
+#if defined( __XC8 )
+#ifndef ILAT_F_CY
+#define ILAT_F_CY       250000UL        /*!<   Instruction clock, F_OSC/4 ( conf_clk() )    */
+#endif
+#define ILAT_HZ         ILAT_F_CY
+#else
+#include "sysclk.h"
+#define ILAT_HZ         ( sysclk_sys_hz () / 2UL )     /*!<   CP0 Count: SYSCLK/2, SYSCLK in use ( sysclk.h )    */
+#endif
+
+
+/**@brief Timestamp.
+ */
+#if defined( __XC8 )
+typedef uint16_t    ilat_time_t;
+#else
+typedef uint32_t    ilat_time_t;
+#endif
+
+
+/**@brief Statistics of a source.
+ */
+typedef struct{
+  uint32_t      n;                  /*!<   Calls                                */
+  ilat_time_t   lat_min;            /*!<   Latency, ticks                       */
+  ilat_time_t   lat_max;
+  uint32_t      lat_sum;
+  ilat_time_t   dur_min;            /*!<   Duration, ticks                      */
+  ilat_time_t   dur_max;
+  uint32_t      dur_sum;
+  uint16_t      hist[ILAT_BINS];    /*!<   Duration histogram ( saturated )     */
+} ilat_stat_t;
+
+
+/**@brief Write function of the dump, e.g. eusart_write(). It returns how many bytes were taken.
+ */
+typedef uint8_t ( *ilat_write_t )( const uint8_t* data, uint8_t length );
+
+
+/**@brief Hooks.
+ */
+#if ( ILAT_ENABLE == 1U )
+#define ILAT_ISR_ENTER()            ilat_time_t ilat_entry = ilat_now ()
+#define ILAT_BEGIN( src, late )     ilat_begin ( (src), (ilat_time_t)(late), ilat_entry )
+#define ILAT_END( src )             ilat_end ( (src) )
+#else
+#define ILAT_ISR_ENTER()
+#define ILAT_BEGIN( src, late )
+#define ILAT_END( src )
+#endif
+
+
+/**@brief Function prototypes.
+ */
+#if ( ILAT_ENABLE == 1U )
+void        ilat_init       ( void );
+ilat_time_t ilat_now        ( void );
+void        ilat_begin      ( uint8_t src, ilat_time_t late, ilat_time_t entry );
+void        ilat_end        ( uint8_t src );
+void        ilat_get        ( uint8_t src, ilat_stat_t* stat );
+void        ilat_reset      ( void );
+void        ilat_dump       ( ilat_write_t write, uint8_t reset );
+#endif
+
+
+/**@brief Variables.
+ */
+
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ILAT_H_ */
@@ -6,7 +6,10 @@
  *
  * @author      Manuel Caballero (aqueronteblog@gmail.com)
  * @date        09/February/2024
- * @version     09/February/2024    The ORIGIN
+ * @version     18/October/2026     ISR latency instrumentation ( ilat.h, ILAT_ENABLE )
+ *              18/October/2026     Table-driven interrupt dispatcher
+ *              18/October/2026     Events posted to the event queue
+ *              09/February/2024    The ORIGIN
  * @pre         N/A
  * @warning     N/A
  */
@@ -14,6 +17,25 @@
 #define INTERRUPTS_H_
 
 #include "board.h"
+#include "eusart.h"
+#include "adc_scan.h"
+#include "evq.h"
+
+
+/**@brief Interrupt sources, priority order ( isrd.h ). Handler cycles: worst case, estimated.
+ *
+ *        The ADC scan interrupts come first: A scan takes 2 interrupts per sample ( 16 samples of AN0 ), and
+ *        the Timer4 one, cheap and the most urgent ( the conversion waits for it ), is the fast path.
+ */
+#define ISRD_TABLE( X )                                                                         \
+    X( TMR4,    PIE3bits.TMR4IE,    PIR3bits.TMR4IF,    1U,     adc_scan_tmr4_isr,  30U  )      \
+    X( AD,      PIE1bits.ADIE,      PIR1bits.ADIF,      1U,     isr_adc,            180U )      \
+    X( TX,      PIE1bits.TXIE,      PIR1bits.TXIF,      0U,     eusart_tx_isr,      45U  )      \
+    X( TMR2,    PIE1bits.TMR2IE,    PIR1bits.TMR2IF,    1U,     isr_timer2,         50U  )
+
+#define ILAT_SOURCES    ISRD_COUNT      /*!<   ilat.h: One source per table entry   */
+
+#include "isrd.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -23,18 +45,22 @@ extern "C" {
 /**@brief Subroutine prototypes.
  */
 void __interrupt() ISR ( void );
+void isr_adc    ( void );
+void isr_timer2 ( void );
 
 
 /**@brief Constants.
  */
+typedef enum{
+  EVT_TIMER2               = 1U,      /*!<   Timer2 overflow, new ADC measurement    */
+  EVT_SCAN_DONE            = 2U       /*!<   ADC scan completed                      */
+} my_evt_t;
 
 
 
 /**@brief Variables.
  */
-extern volatile uint8_t     myFlag;
-extern volatile uint8_t     *myPtr;
-extern volatile uint16_t    myADCresult;
+extern evq_t               myEvents;
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,203 @@
+/**
+ * @brief       isrd.h
+ * @details     Table-driven interrupt dispatcher ( PIC16 single interrupt vector ) header.
+ *
+ *              The interrupt sources are listed once, in ISRD_TABLE( X ), in priority order: the first
+ *              entry is the most frequent or the most urgent one. The table is expanded at compile time:
+ *
+ *                  - ISRD_DISPATCH(): The body of ISR(), one flag check per source in table order. There
+ *                                     is no function pointer, every handler is called directly.
+ *                  - Fast path:       The first source is checked first and the ISR returns straight
+ *                                     after its handler. Any other pending flag vectors again at once,
+ *                                     so the first source never waits for a lower priority handler
+ *                                     which was pending in the same pass.
+ *                  - ISRD_ID_name:    Index of each source, hit counters and budgets ( isrd_stat() ).
+ *                  - ISRD_BUDGET_name: Worst-case latency of each source in instruction cycles, from the
+ *                                     flag being set to its handler being called ( see below ).
+ *
+ *              Entry: X( name, enable bit, flag bit, clear, handler, cycles )
+ *
+ *                  - clear:    1: The flag is cleared before the handler is called.
+ *                              0: The handler clears the flag ( e.g. TXIF, RCIF: read-only flags ).
+ *                  - cycles:   Worst-case cycles of the handler ( MPLAB SIM stopwatch ).
+ *
+ *              Latency budget, worst case ( T_entry = ISRD_T_ENTRY, T_exit = ISRD_T_EXIT,
+ *              C_j = ISRD_T_CHECK + cycles of the source j ):
+ *
+ *                  - A whole pass may be in progress when the flag is set, only missed by its check:
+ *                      T_pass = T_entry + sum( C_j, every source ) + T_exit
+ *                  - Fast path ( first source ):
+ *                      budget = T_pass + T_entry + ISRD_T_CHECK
+ *                  - Any other source i, the fast path may be served once before:
+ *                      budget = T_pass + ( T_entry + C_0 + T_exit ) + T_entry + sum( C_j, j < i ) + ISRD_T_CHECK
+ *
+ *              Every handler is instrumented by ilat.h ( source ISRD_ID_name ) if ILAT_ENABLE is 1, ISR() must
+ *              start with ILAT_ISR_ENTER().
+ *
+ *              ISRD_BUDGET_ASSERT( name, max ) breaks the build if a budget is exceeded once the table or
+ *              the handler cycles change.
+ *
+ *              Example ( interrupts.h ):
+ *
+ *                  #define ISRD_TABLE( X ) \
+ *                      X( TMR4, PIE3bits.TMR4IE, PIR3bits.TMR4IF, 1U, adc_scan_tmr4_isr, 30U )    \
+ *                      X( TX,   PIE1bits.TXIE,   PIR1bits.TXIF,   0U, eusart_tx_isr,     40U )
+ *
+ *                  #include "isrd.h"
+ *
+ *              ISR():
+ *
+ *                  void __interrupt() ISR ( void ) { ISRD_DISPATCH (); }
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero (aqueronteblog@gmail.com)
+ * @date        18/October/2026
+ * @version     18/October/2026    Handlers instrumented by ilat.h
+ *              18/October/2026    The ORIGIN
+ * @pre         ISRD_TABLE( X ) must be defined before this header is included.
+ * @warning     The handlers are called from the interrupt context.
+ */
+#ifndef ISRD_H_
+#define ISRD_H_
+
+#include "board.h"
+#include "ilat.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**@brief Constants.
+ */
+#ifndef ISRD_TABLE
+#error "ISRD_TABLE( X ) must be defined before isrd.h is included"
+#endif
+
+#ifndef ISRD_HITS
+#define ISRD_HITS       1U              /*!<   1: Hit counters enabled                                      */
+#endif
+
+#ifndef ISRD_T_ENTRY
+#define ISRD_T_ENTRY    12U             /*!<   Interrupt latency + context saving ( XC8 ), cycles           */
+#endif
+
+#ifndef ISRD_T_EXIT
+#define ISRD_T_EXIT     6U              /*!<   Context restoring + RETFIE, cycles                           */
+#endif
+
+#ifndef ISRD_T_CHECK
+#define ISRD_T_CHECK    6U              /*!<   Enable and flag bit tests of a source ( banked ), cycles     */
+#endif
+
+
+/**@brief Source indices: ISRD_ID_name, ISRD_COUNT sources.
+ */
+#define ISRD_X_ID( name, ie, flag, clear, handler, cycles )     ISRD_ID_##name,
+
+enum{
+  ISRD_TABLE( ISRD_X_ID )
+  ISRD_COUNT
+};
+
+
+/**@brief Cycles of the sources before each one: ISRD_PRE_name = sum( C_j, j < name ), ISRD_SUM = all of them.
+ *
+ *        Each source takes two enumerators, ISRD_END_name steps the next one up by its cycles.
+ */
+#define ISRD_X_PRE( name, ie, flag, clear, handler, cycles )    ISRD_PRE_##name, ISRD_END_##name = ISRD_PRE_##name + ISRD_T_CHECK + (cycles) - 1,
+
+enum{
+  ISRD_TABLE( ISRD_X_PRE )
+  ISRD_SUM
+};
+
+
+/**@brief Cycles of the fast path ( first source ): ISRD_FAST = C_0, the same way with the other sources counted as 0.
+ */
+#define ISRD_X_FAST( name, ie, flag, clear, handler, cycles )   ISRD_FPRE_##name, ISRD_FEND_##name = ISRD_FPRE_##name + ( ( ISRD_ID_##name == 0 ) ? ( ISRD_T_CHECK + (cycles) ) : 0 ) - 1,
+
+enum{
+  ISRD_TABLE( ISRD_X_FAST )
+  ISRD_FAST
+};
+
+#define ISRD_T_PASS     ( ISRD_T_ENTRY + ISRD_SUM + ISRD_T_EXIT )
+
+
+/**@brief Worst-case latency budget of each source, cycles: ISRD_BUDGET_name.
+ */
+#define ISRD_X_BUDGET( name, ie, flag, clear, handler, cycles )  \
+    ISRD_BUDGET_##name = ISRD_T_PASS + ISRD_T_ENTRY + ISRD_T_CHECK +  \
+                         ( ( ISRD_ID_##name == 0 ) ? 0 : ( ISRD_T_ENTRY + ISRD_FAST + ISRD_T_EXIT + ISRD_PRE_##name ) ),
+
+enum{
+  ISRD_TABLE( ISRD_X_BUDGET )
+  ISRD_BUDGET_END
+};
+
+/**@brief Budget in us for a given instruction clock ( F_OSC/4 ).
+ */
+#define ISRD_BUDGET_US( name, f_cy )    ( (uint32_t)( ( (uint32_t)ISRD_BUDGET_##name * 1000000UL ) / (f_cy) ) )
+
+/**@brief Build-time check: The worst-case latency of a source is max cycles or less.
+ */
+#define ISRD_BUDGET_ASSERT( name, max ) typedef char isrd_budget_##name[ ( ISRD_BUDGET_##name <= (max) ) ? 1 : -1 ]
+
+
+/**@brief Dispatcher: The body of ISR().
+ */
+#if ( ISRD_HITS == 1U )
+#define ISRD_HIT( name )    myIsrdHits[ISRD_ID_##name]++
+#else
+#define ISRD_HIT( name )
+#endif
+
+#define ISRD_X_CHECK( name, ie, flag, clear, handler, cycles )  \
+    if ( ( (ie) == 1U ) && ( (flag) == 1U ) )                   \
+    {                                                           \
+        if ( (clear) == 1U )                                    \
+        {                                                       \
+            (flag)  =   0U;                                     \
+        }                                                       \
+        ISRD_HIT( name );                                       \
+        ILAT_BEGIN( ISRD_ID_##name, 0U );                       \
+        handler ();                                             \
+        ILAT_END( ISRD_ID_##name );                             \
+        if ( ISRD_ID_##name == 0 )                              \
+        {                                                       \
+            return;                                             \
+        }                                                       \
+    }
+
+#define ISRD_DISPATCH()     do{ ISRD_TABLE( ISRD_X_CHECK ) }while( 0 )
+
+
+/**@brief Source statistics.
+ */
+typedef struct{
+  uint16_t      hits;               /*!<   Times the handler was called since isrd_init()   */
+  uint16_t      budget;             /*!<   Worst-case latency, cycles ( ISRD_BUDGET_name )  */
+} isrd_stat_t;
+
+
+/**@brief Function prototypes.
+ */
+void     isrd_init      ( void );
+uint8_t  isrd_stat      ( uint8_t id, isrd_stat_t* stat );
+
+
+/**@brief Variables.
+ */
+#if ( ISRD_HITS == 1U )
+extern volatile uint16_t    myIsrdHits[ISRD_COUNT];
+#endif
+
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* ISRD_H_ */
@@ -0,0 +1,776 @@
+/**
+ * @brief       adc_scan.c
+ * @details     Multi-channel ADC scan engine sources.
+ *
+ *              Every channel ring buffer has a single producer ( the ADC interrupt moves head ) and a
+ *              single consumer ( the main loop moves tail ). Both indexes are single bytes, so no
+ *              interrupt masking is needed.
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero (aqueronteblog@gmail.com)
+ * @date        18/October/2026
+ * @version     18/October/2026    Sleep conversion mode
+ *              18/October/2026    Oversampling and decimation ( boxcar, CIC2 )
+ *              18/October/2026    Hardware-paced mode ( CCP5 special event trigger )
+ *              18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+#include "../inc/adc_scan.h"
+
+
+/**@brief Variables.
+ */
+static adc_scan_channel_t*  myChannels;     /*!<   Channel table                    */
+static uint8_t              myCount;        /*!<   Channels in the table            */
+static volatile uint8_t     myIndex;        /*!<   Channel in progress              */
+static volatile uint8_t     myBusy;         /*!<   1: A scan is in progress         */
+static volatile uint8_t     myTriggered;    /*!<   1: Hardware-paced mode           */
+static uint8_t              mySleep;        /*!<   1: Sleep conversion mode         */
+static uint8_t              myGate;         /*!<   Peripherals gated, adc_scan_gate_t  */
+static volatile uint8_t     myPending;      /*!<   1: Conversion waiting for adc_scan_sleep()  */
+
+
+/**@brief Function prototypes.
+ */
+static void    adc_scan_acquire    ( void );
+static void    adc_scan_convert    ( void );
+static void    adc_scan_store      ( adc_scan_channel_t* ch, uint16_t result );
+static uint8_t adc_scan_decimate   ( adc_scan_channel_t* ch, uint16_t sample );
+static void    adc_scan_restart    ( void );
+
+
+/**
+ * @brief       void adc_scan_init ( adc_scan_channel_t* , uint8_t )
+ * @details     It sets the channel table and empties the ring buffers. Timer4 is configured for the
+ *              acquisition delays.
+ *
+ *              Timer4
+ *                  - Prescaler ADC_SCAN_T4CKPS, postscaler 1:1
+ *                  - Timer4 interrupt enabled
+ *
+ *
+ * @param[in]    channels:  Channel table.
+ * @param[in]    count:     Channels in the table.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         conf_adc() must be called first. The table must be kept while the engine is used.
+ * @warning     N/A
+ */
+void adc_scan_init ( adc_scan_channel_t* channels, uint8_t count )
+{
+    uint8_t i   =   0U;
+
+    myChannels  =   channels;
+    myCount     =   count;
+    myIndex     =   0U;
+    myBusy      =   0U;
+    myTriggered =   0U;
+    myPending   =   0U;
+
+    for ( i = 0U; i < count; i++ )
+    {
+        channels[i].head    =   0U;
+        channels[i].tail    =   0U;
+        channels[i].overrun =   0U;
+        channels[i].n_acc   =   0U;
+        channels[i].integ1  =   0UL;
+        channels[i].integ2  =   0UL;
+        channels[i].comb1   =   0UL;
+        channels[i].comb2   =   0UL;
+    }
+
+    /* Timer4: Acquisition delay   */
+    T4CONbits.TMR4ON    =   0U;
+    T4CONbits.T4CKPS    =   ADC_SCAN_T4CKPS;
+    T4CONbits.T4OUTPS   =   0b0000;
+
+    /* Clear Timer4 interrupt flag */
+    PIR3bits.TMR4IF =   0U;
+
+    /* Timer4 interrupt enabled */
+    PIE3bits.TMR4IE =   1U;
+}
+
+
+/**
+ * @brief       uint8_t adc_scan_start ( void )
+ * @details     It starts a new scan of the channel table.
+ *
+ *
+ * @param[in]    N/A.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      1: Scan started, 0: A scan is already in progress or the table is empty
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         Peripheral interrupts must be enabled.
+ * @warning     N/A
+ */
+uint8_t adc_scan_start ( void )
+{
+    if ( ( myBusy == 1U ) || ( myCount == 0U ) )
+    {
+        return 0U;
+    }
+
+    myBusy      =   1U;
+    myIndex     =   0U;
+    myPending   =   0U;
+    adc_scan_restart ();
+
+    /* ADC enabled   */
+    ADCON0bits.ADON =   1U;
+
+    adc_scan_acquire ();
+
+    return 1U;
+}
+
+
+/**
+ * @brief       uint8_t adc_scan_trigger_start ( uint16_t )
+ * @details     It starts the hardware-paced mode: the CCP5 special event trigger starts a conversion
+ *              every period Timer1 counts, the channels are converted round-robin until
+ *              adc_scan_trigger_stop() is called.
+ *
+ *              Timer1
+ *                  - Clock source: F_OSC/4, prescaler 1, gate disabled
+ *              CCP5
+ *                  - Compare mode, special event trigger: Timer1 is reset and the ADC conversion
+ *                    is started when TMR1 = CCPR5
+ *
+ *
+ * @param[in]    period:    Timer1 counts per conversion, ADC_SCAN_TRIGGER_PERIOD().
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      1: Started, 0: A scan is already in progress, the table is empty or period is 0
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         Peripheral interrupts must be enabled.
+ * @warning     Timer1 is clocked by F_OSC, the uC must not enter SLEEP in this mode.
+ */
+uint8_t adc_scan_trigger_start ( uint16_t period )
+{
+    if ( ( myBusy == 1U ) || ( myCount == 0U ) || ( period == 0U ) )
+    {
+        return 0U;
+    }
+
+    myBusy      =   1U;
+    myTriggered =   1U;
+    myIndex     =   0U;
+    myPending   =   0U;
+    adc_scan_restart ();
+
+    /* First channel, its acquisition takes place until the first trigger   */
+    ADCON0bits.CHS  =   myChannels[0].chs;
+    ADCON0bits.ADON =   1U;
+
+    /* Timer1: F_OSC/4, prescaler 1, gate disabled   */
+    T1CONbits.TMR1ON    =   0U;
+    T1CONbits.TMR1CS    =   0b00;
+    T1CONbits.T1CKPS    =   0b00;
+    T1GCONbits.TMR1GE   =   0U;
+    TMR1H   =   0U;
+    TMR1L   =   0U;
+
+    /* CCP5: Compare mode, special event trigger ( TMR1 = CCPR5 )   */
+    CCPR5H  =   (uint8_t)( ( period - 1U ) >> 8U );
+    CCPR5L  =   (uint8_t)( period - 1U );
+    CCP5CONbits.CCP5M   =   0b1011;
+    PIR3bits.CCP5IF     =   0U;
+
+    /* Start Timer1   */
+    T1CONbits.TMR1ON    =   1U;
+
+    return 1U;
+}
+
+
+/**
+ * @brief       void adc_scan_trigger_stop ( void )
+ * @details     It stops the hardware-paced mode. A conversion in progress is discarded.
+ *
+ *
+ * @param[in]    N/A.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+void adc_scan_trigger_stop ( void )
+{
+    /* CCP5 off, Timer1 stopped   */
+    CCP5CONbits.CCP5M   =   0b0000;
+    T1CONbits.TMR1ON    =   0U;
+
+    myTriggered =   0U;
+    myBusy      =   0U;
+}
+
+
+/**
+ * @brief       void adc_scan_sleep_enable ( uint8_t )
+ * @details     It sets the sleep conversion mode: the conversions are started by adc_scan_sleep().
+ *
+ *
+ * @param[in]    gate:      Peripherals turned off during the conversion, adc_scan_gate_t mask.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         No scan in progress. ADC clock: FRC ( conf_adc() ).
+ * @warning     adc_scan_sleep() must be called while adc_scan_busy() is 1, the scan is stuck otherwise.
+ */
+void adc_scan_sleep_enable ( uint8_t gate )
+{
+    mySleep     =   1U;
+    myGate      =   gate;
+    myPending   =   0U;
+}
+
+
+/**
+ * @brief       void adc_scan_sleep_disable ( void )
+ * @details     It goes back to the conversions started by the interrupts.
+ *
+ *
+ * @param[in]    N/A.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         No scan in progress.
+ * @warning     N/A
+ */
+void adc_scan_sleep_disable ( void )
+{
+    mySleep     =   0U;
+    myPending   =   0U;
+}
+
+
+/**
+ * @brief       uint8_t adc_scan_sleep ( void )
+ * @details     Sleep conversion mode. If a conversion is pending, it starts it and the uC sleeps until
+ *              ADIF. The gated peripherals are turned off meanwhile. It returns straight away otherwise
+ *              ( acquisition delay in progress or no scan ).
+ *
+ *              GIE is cleared, so the uC wakes up on ADIF and goes on after SLEEP, ADIF is served by
+ *              ISR() once GIE is restored ( as it was on entry ).
+ *
+ *
+ * @param[in]    N/A.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      1: A conversion was completed in SLEEP, 0: Nothing to do
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    GIE is restored on exit, no longer set
+ *              18/October/2026    The ORIGIN
+ * @pre         ADIE and PEIE must be enabled. Nothing else clocked by F_OSC may be in progress ( EUSART,
+ *              MSSP, ... ), it is stopped by SLEEP.
+ * @warning     It must only be called from the main context. If the ADC clock is not FRC, the
+ *              conversion is started but the uC does not sleep.
+ */
+uint8_t adc_scan_sleep ( void )
+{
+    uint8_t tmr1on  =   0U;
+    uint8_t c1on    =   0U;
+    uint8_t c2on    =   0U;
+    uint8_t swdten  =   0U;
+    uint8_t slept   =   0U;
+    uint8_t gie     =   0U;
+
+    gie             =   INTCONbits.GIE;
+    INTCONbits.GIE  =   0U;
+
+    if ( myPending == 1U )
+    {
+        myPending   =   0U;
+
+        if ( ( ADCON1bits.ADCS & 0b011 ) != 0b011 )
+        {
+            /* F_OSC based ADC clock: the conversion would be aborted by SLEEP   */
+            ADCON0bits.GO_nDONE =   1U;
+        }
+        else
+        {
+            /* Gate the peripherals which keep running in SLEEP   */
+            if ( ( myGate & ADC_SCAN_GATE_TMR1 ) == ADC_SCAN_GATE_TMR1 )
+            {
+                tmr1on              =   T1CONbits.TMR1ON;
+                T1CONbits.TMR1ON    =   0U;
+            }
+            if ( ( myGate & ADC_SCAN_GATE_COMPARATORS ) == ADC_SCAN_GATE_COMPARATORS )
+            {
+                c1on                =   CM1CON0bits.C1ON;
+                c2on                =   CM2CON0bits.C2ON;
+                CM1CON0bits.C1ON    =   0U;
+                CM2CON0bits.C2ON    =   0U;
+            }
+            if ( ( myGate & ADC_SCAN_GATE_WDT ) == ADC_SCAN_GATE_WDT )
+            {
+                swdten              =   WDTCONbits.SWDTEN;
+                WDTCONbits.SWDTEN   =   0U;
+            }
+
+            /* FRC: The conversion starts one instruction cycle later, the uC is already sleeping   */
+            ADCON0bits.GO_nDONE =   1U;
+            SLEEP();
+            NOP();
+
+            /* ADIF: Restore the peripherals   */
+            if ( ( myGate & ADC_SCAN_GATE_TMR1 ) == ADC_SCAN_GATE_TMR1 )
+            {
+                T1CONbits.TMR1ON    =   tmr1on;
+            }
+            if ( ( myGate & ADC_SCAN_GATE_COMPARATORS ) == ADC_SCAN_GATE_COMPARATORS )
+            {
+                CM1CON0bits.C1ON    =   c1on;
+                CM2CON0bits.C2ON    =   c2on;
+            }
+            if ( ( myGate & ADC_SCAN_GATE_WDT ) == ADC_SCAN_GATE_WDT )
+            {
+                WDTCONbits.SWDTEN   =   swdten;
+            }
+
+            slept   =   1U;
+        }
+    }
+
+    INTCONbits.GIE  =   gie;
+
+    return slept;
+}
+
+
+/**
+ * @brief       uint8_t adc_scan_busy ( void )
+ * @details     It checks if a scan is in progress.
+ *
+ *
+ * @param[in]    N/A.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      0: All the channels were converted, 1: Scan in progress
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+uint8_t adc_scan_busy ( void )
+{
+    return myBusy;
+}
+
+
+/**
+ * @brief       uint8_t adc_scan_available ( const adc_scan_channel_t* )
+ * @details     It returns how many results are stored in the channel ring buffer.
+ *
+ *
+ * @param[in]    channel:   Channel.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      Results ready to be read
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+uint8_t adc_scan_available ( const adc_scan_channel_t* channel )
+{
+    return (uint8_t)( channel->head - channel->tail );
+}
+
+
+/**
+ * @brief       uint8_t adc_scan_read ( adc_scan_channel_t* , uint16_t* )
+ * @details     It reads the oldest result of the channel ring buffer.
+ *
+ *
+ * @param[in]    channel:   Channel.
+ *
+ * @param[out]   result:    ADC result ( right justified ).
+ *
+ *
+ * @return      1: Result read, 0: Ring buffer empty
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+uint8_t adc_scan_read ( adc_scan_channel_t* channel, uint16_t* result )
+{
+    uint8_t tail    =   channel->tail;
+
+    if ( tail == channel->head )
+    {
+        return 0U;
+    }
+
+    *result         =   channel->buff[tail & (uint8_t)( channel->size - 1U )];
+    channel->tail   =   (uint8_t)( tail + 1U );
+
+    return 1U;
+}
+
+
+/**
+ * @brief       void adc_scan_isr ( void )
+ * @details     ADC interrupt handler. It must be called from ISR() when ADIE and ADIF are set, once
+ *              ADIF is cleared. The result is stored and the next channel is acquired. An oversampled
+ *              channel is acquired again until its 4^n samples are accumulated.
+ *
+ *
+ * @param[in]    N/A.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    Oversampling
+ *              18/October/2026    Hardware-paced mode
+ *              18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+void adc_scan_isr ( void )
+{
+    adc_scan_channel_t* ch;
+    uint16_t            result;
+
+    if ( myBusy == 0U )
+    {
+        return;
+    }
+
+    /* Get the ADC measurement (right alignment)  */
+    result  =   ADRESH;
+    result <<=  8U;
+    result |=   ADRESL;
+
+    ch  =   &myChannels[myIndex];
+    if ( ch->ovs == 0U )
+    {
+        adc_scan_store ( ch, result );
+    }
+    else if ( adc_scan_decimate ( ch, result ) == 0U )
+    {
+        /* Oversampling: same channel again. The next trigger converts it in hardware-paced mode   */
+        if ( myTriggered == 0U )
+        {
+            adc_scan_acquire ();
+        }
+        return;
+    }
+    else
+    {
+        /* 4^n samples decimated and stored   */
+    }
+
+    /* Next channel   */
+    myIndex++;
+    if ( myTriggered == 1U )
+    {
+        /* Hardware-paced mode: round-robin, the next trigger starts the conversion   */
+        if ( myIndex >= myCount )
+        {
+            myIndex =   0U;
+        }
+        ADCON0bits.CHS  =   myChannels[myIndex].chs;
+    }
+    else if ( myIndex < myCount )
+    {
+        adc_scan_acquire ();
+    }
+    else
+    {
+        /* Scan completed   */
+        myBusy  =   0U;
+    }
+}
+
+
+/**
+ * @brief       void adc_scan_tmr4_isr ( void )
+ * @details     Timer4 interrupt handler. It must be called from ISR() when TMR4IE and TMR4IF are set,
+ *              once TMR4IF is cleared. The acquisition delay is over, the conversion is started.
+ *
+ *
+ * @param[in]    N/A.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+void adc_scan_tmr4_isr ( void )
+{
+    /* One-shot   */
+    T4CONbits.TMR4ON    =   0U;
+
+    adc_scan_convert ();
+}
+
+
+/**
+ * @brief       void adc_scan_acquire ( void )
+ * @details     It connects the current channel to the ADC and waits its acquisition delay ( Timer4 ),
+ *              the conversion is started straight away if there is no delay.
+ *
+ *
+ * @param[in]    N/A.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+static void adc_scan_acquire ( void )
+{
+    const adc_scan_channel_t*   ch  =   &myChannels[myIndex];
+
+    ADCON0bits.CHS  =   ch->chs;
+
+    if ( ch->acq == 0U )
+    {
+        adc_scan_convert ();
+    }
+    else
+    {
+        /* Timer4 matches after ch->acq counts ( TMR4 = PR4 )  */
+        TMR4                =   0U;
+        PR4                 =   (uint8_t)( ch->acq - 1U );
+        PIR3bits.TMR4IF     =   0U;
+        T4CONbits.TMR4ON    =   1U;
+    }
+}
+
+
+/**
+ * @brief       void adc_scan_convert ( void )
+ * @details     The acquisition delay is over: the conversion is started, or left pending for
+ *              adc_scan_sleep() in the sleep conversion mode.
+ *
+ *
+ * @param[in]    N/A.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+static void adc_scan_convert ( void )
+{
+    if ( mySleep == 1U )
+    {
+        myPending   =   1U;
+    }
+    else
+    {
+        ADCON0bits.GO_nDONE =   1U;
+    }
+}
+
+
+/**
+ * @brief       void adc_scan_store ( adc_scan_channel_t* , uint16_t )
+ * @details     It stores a result in the channel ring buffer, the result is dropped if it is full.
+ *
+ *
+ * @param[in]    ch:        Channel.
+ * @param[in]    result:    Result.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+static void adc_scan_store ( adc_scan_channel_t* ch, uint16_t result )
+{
+    if ( (uint8_t)( ch->head - ch->tail ) < ch->size )
+    {
+        ch->buff[ch->head & (uint8_t)( ch->size - 1U )] =   result;
+        ch->head++;
+    }
+    else
+    {
+        ch->overrun++;
+    }
+}
+
+
+/**
+ * @brief       uint8_t adc_scan_decimate ( adc_scan_channel_t* , uint16_t )
+ * @details     It accumulates a sample of an oversampled channel. Every 4^n samples the decimated
+ *              result ( 10 + n bits ) is stored.
+ *
+ *              Boxcar: integ1 = sum( x ), result = integ1 >> n
+ *              CIC2:   integ1 += x, integ2 += integ1, every R = 4^n samples:
+ *                          d = integ2 - comb1, comb1 = integ2, y = d - comb2, comb2 = d
+ *                          result = y >> 3n ( gain R^2 = 2^4n )
+ *
+ *              The CIC registers wrap around modulo 2^32, 10 + 2*6 = 22 bits are needed at n = 3.
+ *
+ *
+ * @param[in]    ch:        Channel.
+ * @param[in]    sample:    10-bit sample.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      1: Result stored, 0: More samples are needed
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+static uint8_t adc_scan_decimate ( adc_scan_channel_t* ch, uint16_t sample )
+{
+    uint32_t    diff;
+    uint32_t    y;
+
+    ch->integ1 +=   sample;
+    if ( ch->avg == ADC_SCAN_AVG_CIC2 )
+    {
+        ch->integ2 +=   ch->integ1;
+    }
+
+    ch->n_acc++;
+    if ( ch->n_acc < (uint8_t)( 1U << ( 2U * ch->ovs ) ) )
+    {
+        return 0U;
+    }
+    ch->n_acc   =   0U;
+
+    if ( ch->avg == ADC_SCAN_AVG_CIC2 )
+    {
+        /* Comb stages   */
+        diff        =   ch->integ2 - ch->comb1;
+        ch->comb1   =   ch->integ2;
+        y           =   diff - ch->comb2;
+        ch->comb2   =   diff;
+
+        adc_scan_store ( ch, (uint16_t)( y >> ( 3U * ch->ovs ) ) );
+    }
+    else
+    {
+        /* Integrate and dump   */
+        adc_scan_store ( ch, (uint16_t)( ch->integ1 >> ch->ovs ) );
+        ch->integ1  =   0UL;
+    }
+
+    return 1U;
+}
+
+
+/**
+ * @brief       void adc_scan_restart ( void )
+ * @details     It discards the partial accumulations of the oversampled channels. The CIC2 state is
+ *              kept, it is a continuous filter.
+ *
+ *
+ * @param[in]    N/A.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         No conversion in progress.
+ * @warning     N/A
+ */
+static void adc_scan_restart ( void )
+{
+    uint8_t i   =   0U;
+
+    for ( i = 0U; i < myCount; i++ )
+    {
+        if ( myChannels[i].avg == ADC_SCAN_AVG_BOXCAR )
+        {
+            myChannels[i].integ1    =   0UL;
+        }
+        myChannels[i].n_acc =   0U;
+    }
+}
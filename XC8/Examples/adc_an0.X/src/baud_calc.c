@@ -0,0 +1,165 @@
+/**
+ * @brief       baud_calc.c
+ * @details     Baud rate generator solver sources ( PIC16F1937: EUSART, asynchronous mode ).
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero (aqueronteblog@gmail.com)
+ * @date        18/October/2026
+ * @version     18/October/2026    SPBRG rounded down or up, the one with the lower error
+ *              18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+#include "../inc/baud_calc.h"
+
+
+/**@brief Constants.
+ */
+#define BAUD_CALC_CANDIDATES    4U      /*!<   BRG16:BRGH = 11, 10, 01, 00   */
+
+
+/**@brief Function prototypes.
+ */
+static uint16_t baud_calc_try   ( uint32_t f, uint32_t baud, uint32_t m, uint32_t max, uint32_t* n );
+static uint16_t baud_calc_err   ( uint32_t f, uint32_t mnb );
+
+
+
+/**
+ * @brief       uint8_t baud_calc_eusart ( uint32_t , uint32_t , baud_calc_eusart_t* )
+ * @details     It works out the EUSART settings with the lowest error for a baud rate ( BAUD_CALC_EUSART_DEFINE()
+ *              at run time ).
+ *
+ *
+ * @param[in]    f_osc:     F_OSC in use, Hz.
+ * @param[in]    baud:      Baud rate.
+ *
+ * @param[out]   cfg:       BRG16, BRGH, SPBRG and the error ( 0.01% ).
+ *
+ *
+ * @return      1: Error within BAUD_CALC_ERR_MAX, 0: Above it ( cfg is the best there is anyway )
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         baud >= 25.
+ * @warning     32-bit divisions: Not for an ISR.
+ */
+uint8_t baud_calc_eusart ( uint32_t f_osc, uint32_t baud, baud_calc_eusart_t* cfg )
+{
+    uint8_t     k       =   0U;
+    uint16_t    e       =   0U;
+    uint32_t    n       =   0UL;
+
+    cfg->error  =   BAUD_CALC_NONE;
+
+    for ( k = 0U; k < BAUD_CALC_CANDIDATES; k++ )
+    {
+        e   =   baud_calc_try ( f_osc, baud, BAUD_CALC_M( k ), BAUD_CALC_MAX( k ), &n );
+
+        /* Lowest error, ties go to the first candidate  */
+        if ( e < cfg->error )
+        {
+            cfg->error  =   e;
+            cfg->brg16  =   ( k < 2U ) ? 1U : 0U;
+            cfg->brgh   =   ( ( k & 1U ) == 0U ) ? 1U : 0U;
+            cfg->spbrg  =   (uint16_t)( n - 1UL );
+        }
+    }
+
+    if ( cfg->error == BAUD_CALC_NONE )
+    {
+        /* Nothing within 25%: The fastest setting   */
+        cfg->brg16  =   1U;
+        cfg->brgh   =   1U;
+        cfg->spbrg  =   0U;
+    }
+
+    return ( cfg->error <= BAUD_CALC_ERR_MAX ) ? 1U : 0U;
+}
+
+
+/**
+ * @brief       uint16_t baud_calc_try ( uint32_t , uint32_t , uint32_t , uint32_t , uint32_t* )
+ * @details     Candidate of divider m: SPBRG + 1 rounded down or up ( 1 to max ), the one with the lower error,
+ *              ties go to the one rounded down ( BAUD_CALC_N() ), and its error.
+ *
+ *
+ * @param[in]    f:         F_OSC, Hz.
+ * @param[in]    baud:      Baud rate.
+ * @param[in]    m:         Divider: 4, 16 or 64.
+ * @param[in]    max:       SPBRG + 1 max.: 256 or 65536.
+ *
+ * @param[out]   n:         SPBRG + 1.
+ *
+ *
+ * @return      Error in 0.01%, BAUD_CALC_NONE if it is 25% off or more
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+static uint16_t baud_calc_try ( uint32_t f, uint32_t baud, uint32_t m, uint32_t max, uint32_t* n )
+{
+    uint32_t        mb      =   m * baud;
+    uint32_t        lo      =   f / mb;
+    uint32_t        hi      =   lo + 1UL;
+    uint16_t        e_lo    =   0U;
+    uint16_t        e_hi    =   0U;
+
+    /* SPBRG + 1 rounded down and up, 1 to max    */
+    lo  =   ( lo == 0UL ) ? 1UL : ( lo > max ) ? max : lo;
+    hi  =   ( hi > max ) ? max : hi;
+
+    /* The nearest one is not always the best: The error is relative to m*( SPBRG + 1 )*baud   */
+    e_lo    =   baud_calc_err ( f, mb * lo );
+    e_hi    =   baud_calc_err ( f, mb * hi );
+
+    if ( e_hi < e_lo )
+    {
+        *n  =   hi;
+
+        return e_hi;
+    }
+    else
+    {
+        *n  =   lo;
+
+        return e_lo;
+    }
+}
+
+
+/**
+ * @brief       uint16_t baud_calc_err ( uint32_t , uint32_t )
+ * @details     Error of a setting ( BAUD_CALC_ERR_MNB() ).
+ *
+ *
+ * @param[in]    f:         F_OSC, Hz.
+ * @param[in]    mnb:       Clock the setting needs: m*( SPBRG + 1 )*baud.
+ *
+ *
+ * @return      Error in 0.01%, BAUD_CALC_NONE if it is 25% off or more
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+static uint16_t baud_calc_err ( uint32_t f, uint32_t mnb )
+{
+    uint32_t        diff    =   ( f > mnb ) ? ( f - mnb ) : ( mnb - f );
+
+    if ( ( diff * 4UL ) >= mnb )
+    {
+        return BAUD_CALC_NONE;
+    }
+    else
+    {
+        return (uint16_t)( ( diff * 100UL ) / ( mnb / 100UL ) );
+    }
+}
@@ -0,0 +1,212 @@
+/**
+ * @brief       evq.c
+ * @details     Single-producer single-consumer event queue sources.
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero (aqueronteblog@gmail.com)
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+#include "../inc/evq.h"
+
+
+
+/**
+ * @brief       void evq_init ( evq_t* )
+ * @details     It empties the queue and resets the dropped events counter.
+ *
+ *
+ * @param[in]    q:         Queue.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         The producer must not post events while the queue is initialized.
+ * @warning     N/A
+ */
+void evq_init ( evq_t* q )
+{
+    q->head     =   0U;
+    q->tail     =   0U;
+    q->dropped  =   0U;
+}
+
+
+/**
+ * @brief       uint8_t evq_post ( evq_t* , uint8_t , uint16_t )
+ * @details     It posts an event. It must be called from the producer only ( ISR ).
+ *
+ *              The event is stored first, then head is advanced: The consumer never sees an event which
+ *              is not stored yet.
+ *
+ *
+ * @param[in]    q:         Queue.
+ * @param[in]    id:        Event identifier.
+ * @param[in]    data:      Event data.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      1: Event posted, 0: Queue full, event dropped
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+uint8_t evq_post ( evq_t* q, uint8_t id, uint16_t data )
+{
+    evq_idx_t   head    =   q->head;
+
+    /* Queue full: The event is dropped   */
+    if ( (evq_idx_t)( head - q->tail ) >= EVQ_SIZE )
+    {
+        q->dropped++;
+        return 0U;
+    }
+
+    /* Store the event, then publish it   */
+    q->buff[head & EVQ_MASK].id     =   id;
+    q->buff[head & EVQ_MASK].data   =   data;
+    q->head =   (evq_idx_t)( head + 1U );
+
+    return 1U;
+}
+
+
+/**
+ * @brief       uint8_t evq_get ( evq_t* , evq_event_t* )
+ * @details     It takes the oldest event out of the queue. It must be called from the consumer only ( main
+ *              loop ).
+ *
+ *              The event is read first, then tail is advanced: The producer never overwrites an event which
+ *              is not read yet.
+ *
+ *
+ * @param[in]    q:         Queue.
+ *
+ * @param[out]   evt:       Event, only if there is one.
+ *
+ *
+ * @return      1: Event read, 0: Queue empty
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+uint8_t evq_get ( evq_t* q, evq_event_t* evt )
+{
+    evq_idx_t   tail    =   q->tail;
+
+    /* Queue empty  */
+    if ( q->head == tail )
+    {
+        return 0U;
+    }
+
+    /* Read the event, then release its place   */
+    evt->id     =   q->buff[tail & EVQ_MASK].id;
+    evt->data   =   q->buff[tail & EVQ_MASK].data;
+    q->tail     =   (evq_idx_t)( tail + 1U );
+
+    return 1U;
+}
+
+
+/**
+ * @brief       evq_idx_t evq_drain ( evq_t* , evq_handler_t )
+ * @details     It calls the handler for every event in the queue, oldest first. It must be called from the
+ *              consumer only ( main loop ).
+ *
+ *              The events posted while the queue is drained are handled in the same call, up to EVQ_SIZE
+ *              events, so a busy producer cannot hold the main loop.
+ *
+ *
+ * @param[in]    q:         Queue.
+ * @param[in]    handler:   Event handler.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      Number of events handled
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+evq_idx_t evq_drain ( evq_t* q, evq_handler_t handler )
+{
+    evq_event_t evt;
+    evq_idx_t   n   =   0U;
+
+    while ( ( n < EVQ_SIZE ) && ( evq_get ( q, &evt ) == 1U ) )
+    {
+        handler ( &evt );
+        n++;
+    }
+
+    return n;
+}
+
+
+/**
+ * @brief       evq_idx_t evq_count ( const evq_t* )
+ * @details     It gets the number of events in the queue.
+ *
+ *
+ * @param[in]    q:         Queue.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      Events in the queue
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     It is a snapshot, the producer may post more events at any time.
+ */
+evq_idx_t evq_count ( const evq_t* q )
+{
+    evq_idx_t   tail    =   q->tail;
+
+    return (evq_idx_t)( q->head - tail );
+}
+
+
+/**
+ * @brief       evq_idx_t evq_dropped ( const evq_t* )
+ * @details     It gets the number of events dropped because the queue was full.
+ *
+ *
+ * @param[in]    q:         Queue.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      Events dropped since evq_init(), it wraps on evq_idx_t
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+evq_idx_t evq_dropped ( const evq_t* q )
+{
+    return q->dropped;
+}
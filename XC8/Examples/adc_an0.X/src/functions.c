@@ -176,6 +176,7 @@ void conf_Timer2 ( void )
  *                  - ADC clock: FRC (clock supplied from a dedicated RC oscillator)
  *                  - VREF- is connected to VSS
  *                  - VREF+ is connected to VDD
+ *                  - FVR buffer 1 = 1.024V ( it is scanned together with AN0 )
  * 
  * @param[in]    N/A.
  *
@@ -186,7 +187,8 @@ void conf_Timer2 ( void )
  *
  * @author      Manuel Caballero
  * @date        14/March/2024
- * @version     14/March/2024    The ORIGIN
+ * @version     18/October/2026  FVR buffer 1 enabled
+ *              14/March/2024    The ORIGIN
  * @pre         TADMmax@FRC ~ 6us 
  * @pre         New ADC conversion timing =  TACQ + TCNV = TACQ + 11.5*TAD = 5us + 11.5*6us = 74us 
  * @warning     The user must respect the TACQ before start a new ADC conversion! TACQtyp ~ 5us
@@ -212,6 +214,12 @@ void conf_adc ( void )
     /* VREF+ is connected to VDD   */
     ADCON1bits.ADPREF   =   0b00;
     
+    /* FVR buffer 1 = 1.024V    */
+    FVRCONbits.ADFVR    =   0b01;
+    
+    /* FVR is enabled    */
+    FVRCONbits.FVREN    =   1U;
+    
     /* ADC enabled    */
     ADCON0bits.ADON  =   1U;
     
@@ -225,16 +233,19 @@ void conf_adc ( void )
 }
 
 
+/**@brief EUSART baud rate settings ( baud_calc.h ): myBaud_BRG16, myBaud_BRGH, myBaud_SPBRGH, myBaud_SPBRGL.
+ */
+BAUD_CALC_EUSART_DEFINE( myBaud, EUSART_F_OSC, EUSART_BAUDRATE );
+
+
 /**
  * @brief       void conf_eusart ( void )
- * @details     It configures the EUSART in 16-bit asynchronous mode.
+ * @details     It configures the EUSART in asynchronous mode.
  *              
- *              Desire_baudrate = F_OSC/[4(SPBRG+1)]
+ *              Desire_baudrate = F_OSC/[m(SPBRG+1)], m = 4, 16 or 64 ( BRG16, BRGH )
  * 
  *              EUSART
- *                  - 16-bit asynchronous mode
- *                  - F_OSC = 1MHz
- *                  - SPBRG = ( F_OSC/(4Desire_baudrate) ) - 1 = ( 1000000/(4115200) ) - 1 ~ 1 (0x0001)
+ *                  - BRG16, BRGH and SPBRG: Lowest error for EUSART_BAUDRATE at EUSART_F_OSC ( baud_calc.h )
  *                  - 8-bit reception/transmission
  *                  - Auto-Baud detect disabled
  *                  - Receiver interrupt disabled
@@ -249,9 +260,10 @@ void conf_adc ( void )
  *
  * @author      Manuel Caballero
  * @date        10/February/2024
- * @version     14/March/2024       Rx is disabled, F_OSC = 1MHz
+ * @version     18/October/2026     BRG16, BRGH and SPBRG worked out by baud_calc.h
+ *              14/March/2024       Rx is disabled, F_OSC = 1MHz
  *              10/February/2024    The ORIGIN
- * @pre         Error = 100*( 115200 - 125000 )/115200 = 8.5%
+ * @pre         The build fails if the error ( myBaud_ERROR, 0.01% ) is above BAUD_CALC_ERR_MAX.
  * @warning     N/A
  */
 void conf_eusart ( void )
@@ -274,21 +286,21 @@ void conf_eusart ( void )
     /* EUSART: Asynchronous mode    */
     TXSTAbits.SYNC   =   0U;
     
-    /* EUSART: High speed    */
-    TXSTAbits.BRGH   =   1U;
+    /* EUSART: High speed or not ( baud_calc.h )    */
+    TXSTAbits.BRGH   =   myBaud_BRGH;
     
     /* Transmit non-inverted data to the TX/CK pin  */
     BAUDCONbits.SCKP    =   0U;
     
-    /* 16-bit Baud Rate Generator is used    */
-    BAUDCONbits.BRG16   =   1U;
+    /* 16-bit or 8-bit Baud Rate Generator ( baud_calc.h )    */
+    BAUDCONbits.BRG16   =   myBaud_BRG16;
     
     /* Auto-Baud Detect mode is disabled    */
     BAUDCONbits.ABDEN   =   0U;
     
     /* Baudrate value   */
-    SPBRGH  =   0x00;
-    SPBRGL  =   0x01;
+    SPBRGH  =   myBaud_SPBRGH;
+    SPBRGL  =   myBaud_SPBRGL;
     
     /* Clear receiver (Rx) and transmission (Tx) interrupt flags   */
     PIR1bits.RCIF   =   0U;
@@ -6,76 +6,90 @@
  *
  * @author      Manuel Caballero (aqueronteblog@gmail.com)
  * @date        10/February/2024
- * @version     10/February/2024    The ORIGIN
+ * @version     18/October/2026     ISR latency instrumentation ( ILAT_ENABLE )
+ *              18/October/2026     Table-driven interrupt dispatcher ( ISRD_TABLE )
+ *              10/February/2024    The ORIGIN
  * @pre         N/A
  * @warning     N/A
  */
 #include "../inc/interrupts.h"
 
 
+/**@brief Constants.
+ */
+ISRD_BUDGET_ASSERT( TMR4, 400U );      /*!<   Acquisition delay overrun: 1.6ms max. at F_OSC = 1MHz    */
+
+
 /**
  * @brief       void ISR ()
- * @details     Interrupt subroutine. 
+ * @details     Interrupt subroutine. The sources are dispatched in ISRD_TABLE order, Timer4 is the fast path.
  *
  *
  * @return      N/A
  *
  * @author      Manuel Caballero
  * @date        09/February/2024
- * @version     09/February/2024   The ORIGIN
+ * @version     18/October/2026    Entry timestamp ( ILAT_ISR_ENTER() )
+ *              18/October/2026    Sources dispatched from ISRD_TABLE
+ *              18/October/2026    Timer2 and end of scan posted to the event queue
+ *              18/October/2026    ADC results are sequenced by the ADC scan engine
+ *              18/October/2026    Tx is driven by the EUSART ring buffer driver
+ *              09/February/2024   The ORIGIN
  * @pre         N/A.
  * @warning     N/A
  */
 void __interrupt() ISR ( void )
 {
-    /* Check if Timer2 Overflow interrupt is enabled and Timer2 Overflow occurred */
-    if ( ( PIE1bits.TMR2IE == 1U  ) && ( PIR1bits.TMR2IF == 1U ) )
-    {        
-        /* Indicates that the timer overflows  */
-        myFlag  =   0b11;
-        
-        
-        /* Clear the interrupt flag   */
-        PIR1bits.TMR2IF = 0U;
-    }
+    ILAT_ISR_ENTER ();
     
-    /* Tx	 */
-	if ( ( PIE1bits.TXIE == 1U ) && ( TXSTAbits.TXEN == 1UL ) )
-	{        
-        /* Wait until Transmit Shift Register Status is empty  */
-        while ( TXSTAbits.TRMT ==  0U );
-        
-		/* Stop transmitting data when that character is found */
-		if ( *myPtr  == '\n' )
-		{            
-            /* Disable transmission   */
-			TXSTAbits.TXEN  =   0UL;
-            
-            /* Indicates that the transmission is completed */
-            myFlag  =   0b01;
-		}
-		else
-		{
-			TXREG	 =	 *myPtr;
-            myPtr++;
-		}
+    ISRD_DISPATCH ();
+}
+
+
+/**
+ * @brief       void isr_adc ()
+ * @details     ADC interrupt handler. It stores the result and acquires the next channel of the scan, the
+ *              end of the scan is posted to the event queue.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         ADIF cleared ( ISRD_TABLE ).
+ * @warning     N/A
+ */
+void isr_adc ( void )
+{
+    if ( adc_scan_busy () == 1U )
+    {
+        adc_scan_isr ();
         
-        /* Clear Tx Interrupt flag  */
-        PIR1bits.TXIF = 0U; 
-	}
-    
-    /* ADC	 */
-	if ( ( PIE1bits.ADIE == 1U ) && ( PIR1bits.ADIF == 1UL ) )
-	{        
-        /* Get the ADC measurement (right alignment)  */
-        myADCresult =   ADRESH;
-        myADCresult <<= 8U;
-        myADCresult |=  ADRESL;
-		
-        /* Indicates that the ADC data is completed */
-        myFlag  =   0b10;
-            
-        /* Clear ADC Interrupt flag  */
-        PIR1bits.ADIF = 0U; 
-	}
+        /* Indicates that the scan is completed  */
+        if ( adc_scan_busy () == 0U )
+        {
+            (void)evq_post ( &myEvents, EVT_SCAN_DONE, 0U );
+        }
+    }
+}
+
+
+/**
+ * @brief       void isr_timer2 ()
+ * @details     Timer2 interrupt handler. The overflow is posted to the event queue.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         TMR2IF cleared ( ISRD_TABLE ).
+ * @warning     N/A
+ */
+void isr_timer2 ( void )
+{
+    /* Indicates that the timer overflows  */
+    (void)evq_post ( &myEvents, EVT_TIMER2, 0U );
 }
\ No newline at end of file
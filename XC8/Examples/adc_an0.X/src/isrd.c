@@ -0,0 +1,104 @@
+/**
+ * @brief       isrd.c
+ * @details     Table-driven interrupt dispatcher ( PIC16 single interrupt vector ) sources.
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero (aqueronteblog@gmail.com)
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+#include "../inc/interrupts.h"
+
+
+/**@brief Constants.
+ */
+#define ISRD_X_BUDGET_ROW( name, ie, flag, clear, handler, cycles )     ISRD_BUDGET_##name,
+
+static const uint16_t   myBudget[ISRD_COUNT] = { ISRD_TABLE( ISRD_X_BUDGET_ROW ) };   /*!<   Latency budget report, cycles   */
+
+
+/**@brief Variables.
+ */
+#if ( ISRD_HITS == 1U )
+volatile uint16_t   myIsrdHits[ISRD_COUNT];     /*!<   Hit counters ( ISR )    */
+#endif
+
+
+
+/**
+ * @brief       void isrd_init ( void )
+ * @details     It resets the hit counters.
+ *
+ *
+ * @param[in]    N/A.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     Interrupts are disabled while the counters are reset.
+ */
+void isrd_init ( void )
+{
+#if ( ISRD_HITS == 1U )
+    uint8_t gie =   INTCONbits.GIE;
+    uint8_t i   =   0U;
+
+    INTCONbits.GIE  =   0U;
+    for ( i = 0U; i < ISRD_COUNT; i++ )
+    {
+        myIsrdHits[i]   =   0U;
+    }
+    INTCONbits.GIE  =   gie;
+#endif
+}
+
+
+/**
+ * @brief       uint8_t isrd_stat ( uint8_t , isrd_stat_t* )
+ * @details     It gets the hit counter and the latency budget of a source.
+ *
+ *
+ * @param[in]    id:        Source, ISRD_ID_name.
+ *
+ * @param[out]   stat:      Hits ( 0 if ISRD_HITS is 0 ) and worst-case latency in cycles.
+ *
+ *
+ * @return      1: Done, 0: Unknown source
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     Interrupts are disabled while the counter is read.
+ */
+uint8_t isrd_stat ( uint8_t id, isrd_stat_t* stat )
+{
+    uint8_t gie =   INTCONbits.GIE;
+
+    if ( id >= ISRD_COUNT )
+    {
+        return 0U;
+    }
+
+    stat->budget    =   myBudget[id];
+
+#if ( ISRD_HITS == 1U )
+    INTCONbits.GIE  =   0U;
+    stat->hits      =   myIsrdHits[id];
+    INTCONbits.GIE  =   gie;
+#else
+    (void)gie;
+    stat->hits      =   0U;
+#endif
+
+    return 1U;
+}
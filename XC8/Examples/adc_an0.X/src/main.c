@@ -2,14 +2,25 @@
  * @brief       main.c
  * @details     This example shows how to work with the internal peripheral: ADC channel AN0 enabled.
  * 
- *              The code is led by a state machine.
+ *              The code is led by a state machine. The interrupts post their events ( Timer2 overflow, end of
+ *              the ADC scan ) to an event queue, the main loop takes them out in order before running the
+ *              state machine, so no event is lost or overwritten.
  *              
- *                  - SM_SLEEP:                 It waits until the ADC completes a new measurement.
- *                  - SM_WAIT_TIMER:            It indicates when a new ADC measurement is needed [default].
- *                  - SM_NEW_ADC_AN0:           It makes the ADC start a new measurement.
+ *                  - SM_SLEEP:                 It waits until the ADC scan ( AN0 and FVR ) is completed, every conversion
+ *                                              runs in SLEEP ( sleep conversion mode ).
+ *                                              AN0 is oversampled 16 times, 12-bit result.
+ *                  - SM_WAIT_TIMER:            It waits until a new ADC measurement is needed ( EVT_TIMER2 ) [default].
+ *                  - SM_NEW_ADC_AN0:           It makes the ADC scan engine start a new scan.
  *                  - SM_SEND_DATA_OVER_UART:   It sends the ADC measurement over the UART.
  *                  - SM_WAIT_DATA_TRANSMITTED: It waits until the ADC measurement is sent over the UART.
  *              
+ *              ISR instrumentation ( build with ILAT_ENABLE = 1 ): Every time S2 is pressed, the latency and
+ *              duration statistics of the interrupt handlers are sent over the UART ( binary dump,
+ *              tools/ilat_decode.py --baud 19200 ) and reset. The dump waits until the message in flight
+ *              is sent. Timer1 ( timestamps, F_OSC/4 ) stops in SLEEP, the timestamps around SLEEP are invalid.
+ *              
+ *              The uC does not sleep while the EUSART is sending ( message or dump ), F_OSC would be stopped.
+ *              
  *              Every ~0.26s, a new value on AN0 pin will be transmitted over the UART. The SLEEP mode is only
  *              used to wait for the ADC module to complete a new measurement.  
  * 
@@ -18,7 +29,17 @@
  *
  * @author      Manuel Caballero (aqueronteblog@gmail.com)
  * @date        14/March/2024
- * @version     14/March/2024    The ORIGIN
+ * @version     18/October/2026  No SLEEP while the EUSART is busy, ILAT_ENABLE: Dump after the message in flight
+ *              18/October/2026  ISR latency statistics dumped when S2 is pressed ( ILAT_ENABLE )
+ *              18/October/2026  Table-driven interrupt dispatcher ( isrd_init() )
+ *              18/October/2026  Interrupt events through an SPSC event queue, myFlag removed
+ *              18/October/2026  Conversions in SLEEP ( adc_scan_sleep() )
+ *              18/October/2026  AN0 oversampled to 12 bits, printed in millivolts
+ *              18/October/2026  AN0 and FVR are converted by the ADC scan engine
+ *              18/October/2026  Fixed-point voltage formatting, sprintf/float removed
+ *              18/October/2026  Transmission through an EUSART Tx descriptor
+ *              18/October/2026  Transmission through the EUSART Tx ring buffer driver
+ *              14/March/2024    The ORIGIN
  * @pre         This project was tested on a PIC16F1937 using a PICDEM 2 Plus.
  * @pre         In asynchronous mode, the SLEEP mode cannot be used due to EUSART clock source (F_OSC).
  * @pre         The SLEEP mode cannot be used for the Timer2 due to Timer2/4/6 clock source (F_OSC).
@@ -60,13 +81,17 @@
 #include "../inc/board.h"
 #include "../inc/functions.h"
 #include "../inc/interrupts.h"
+#include "../inc/eusart.h"
+#include "../inc/adc_fxp.h"
+#include "../inc/adc_scan.h"
+#include "../inc/evq.h"
+#include "../inc/ilat.h"
 
 /**@brief Constants.
  */
-#define EUSART_BUFF 16U
-
-#define ADC_VDD_REF 5.0               /*!<   ADC VDD = 5V    */  
-#define ADC_RES     ( 1024.0 - 1.0 )  /*!<   ADC 10-bit resolution    */  
+#define EUSART_BUFF 32U
+#define ADC_BUFF    4U      /*!< Results kept per channel */
+#define AN0_OVS     2U      /*!< AN0 oversampling: 4^2 samples, 12-bit result */
 
 typedef enum{
   SM_SLEEP                 = 0U,      /*!<   Sleep mode    */
@@ -79,20 +104,43 @@ typedef enum{
 /**@brief Variables.
  */
 my_sm_t             myState;        /* State that indicates when to perform the next action */
-volatile uint8_t    *myPtr;         /* Pointer to point out myMessage   */
-volatile uint8_t    myFlag;         /* Flag that indicates either if the Timer overflows (0b11), the ADC measurement is transmitted over the UART (0b01) or ADC finishes the current measurement conversion (0b10) */
-volatile uint16_t   myADCresult;    /* ADC result */
+evq_t               myEvents;       /* Events posted by the interrupts */
+uint16_t            myAN0buff[ADC_BUFF];    /* AN0 results */
+uint16_t            myFVRbuff[ADC_BUFF];    /* FVR results */
+
+/* ADC scan table: AN0 ( TACQ ~5us, 12-bit ) and FVR buffer 1 = 1.024V  */
+adc_scan_channel_t  myChannels[] = {
+    { .chs = ADC_SCAN_AN0, .acq = ADC_SCAN_ACQ_US( 5U ),  .buff = &myAN0buff[0], .size = ADC_BUFF, .ovs = AN0_OVS, .avg = ADC_SCAN_AVG_BOXCAR },
+    { .chs = ADC_SCAN_FVR, .acq = ADC_SCAN_ACQ_US( 20U ), .buff = &myFVRbuff[0], .size = ADC_BUFF }
+};
 
 /**@brief Function for application main entry.
  */
 void main(void) {
     uint8_t my_message[EUSART_BUFF] = {0};
+    uint8_t my_length   =   0U;
+    uint16_t my_an0     =   0U;
+    uint16_t my_fvr     =   0U;
+    eusart_tx_desc_t my_tx = { NULL, 0U, NULL, 1U };
+    evq_event_t my_evt;
+#if ( ILAT_ENABLE == 1U )
+    uint8_t my_s2       =   S2_MSK;
+    uint8_t my_dump     =   0U;
+#endif
     
-    conf_clk    ();
-    conf_gpio   ();
-    conf_adc    ();
-    conf_eusart ();
-    conf_Timer2 ();
+    evq_init        ( &myEvents );
+    isrd_init       ();
+#if ( ILAT_ENABLE == 1U )
+    ilat_init       ();
+#endif
+    conf_clk        ();
+    conf_gpio       ();
+    conf_adc        ();
+    adc_scan_init   ( &myChannels[0], (uint8_t)( sizeof( myChannels ) / sizeof( myChannels[0] ) ) );
+    adc_scan_sleep_enable ( ADC_SCAN_GATE_ALL );
+    conf_eusart     ();
+    eusart_tx_init  ();
+    conf_Timer2     ();
        
     /* Enable interrupts    */
     INTCONbits.PEIE =   1U; // Enables all active peripheral interrupts
@@ -101,43 +149,76 @@ void main(void) {
     /* Start timer */
     T2CONbits.TMR2ON   =  1U;
     
+    /* Initiate the message: "V = x.xxx V | FVR = x.xx V\r\n"  */
+    my_message[0]   =   'V';
+    my_message[1]   =   ' ';
+    my_message[2]   =   '=';
+    my_message[3]   =   ' ';
+    my_tx.data      =   &my_message[0];
+    
     /* Reset variables  */
     myState =   SM_WAIT_TIMER;
-    myFlag  =   0U;
     
     while ( 1U )
     {
+        /* Events from the interrupts, oldest first  */
+        while ( evq_get ( &myEvents, &my_evt ) == 1U )
+        {
+            switch ( my_evt.id )
+            {
+                case EVT_TIMER2:
+                    if ( myState == SM_WAIT_TIMER )
+                    {
+                        /* Stop timer */
+                        T2CONbits.TMR2ON   =  0U;
+                        
+                        /* Next state   */
+                        myState =  SM_NEW_ADC_AN0; 
+                    }
+                    break;
+                    
+                case EVT_SCAN_DONE:
+                    if ( myState == SM_SLEEP )
+                    {
+                        /* Next state   */
+                        myState =  SM_SEND_DATA_OVER_UART; 
+                    }
+                    break;
+                    
+                default:
+                    break;
+            }
+        }
+        
+#if ( ILAT_ENABLE == 1U )
+        /* S2 pressed: ISR statistics over the UART, then reset  */
+        if ( ( ( PORTA & S2_MSK ) == 0U ) && ( my_s2 != 0U ) )
+        {
+            my_dump =   1U;
+        }
+        my_s2   =   (uint8_t)( PORTA & S2_MSK );
+        
+        /* Not in the middle of a message: The dump waits until it is sent   */
+        if ( ( my_dump == 1U ) && ( my_tx.completed == 1U ) )
+        {
+            ilat_dump ( eusart_write, 1U );
+            my_dump =   0U;
+        }
+#endif
+        
         /* State machine    */
         switch ( myState )
 		{
             default:
             case SM_WAIT_TIMER:
-                if ( myFlag == 0b11 )
-                {
-                    /* Stop timer */
-                    T2CONbits.TMR2ON   =  0U;
-    
-                    /* Reset flag   */
-                    myFlag  =   0U;
-                    
-                    /* Next state   */
-                    myState =  SM_NEW_ADC_AN0; 
-                }
-                else
-                {
-                    /* Do nothing   */
-                }
+                /* Do nothing: EVT_TIMER2 moves on to SM_NEW_ADC_AN0   */
                 break;
                 
             case SM_NEW_ADC_AN0:
                 LATB    |=  D5;
                 
-                /* Reset variable to store the ADC value    */
-                myADCresult =   0U;
-                
-                /* ADC enabled and start a new ADC sampling   */
-                ADCON0bits.ADON     =   1U;
-                ADCON0bits.GO_nDONE =   1U;
+                /* Start a new scan: AN0, FVR   */
+                (void)adc_scan_start ();
                 
                 /* Next state   */
                 myState =  SM_SLEEP; 
@@ -147,33 +228,34 @@ void main(void) {
                 /* D5 LED on    */
                 LATB    |=  D5;
                 
-                /* Pack the message. Turn ADC data into voltage data  */
-                sprintf ((char*)my_message, "V = %0.2f V\r\n", (float)( ( ADC_VDD_REF * myADCresult ) / ADC_RES ));
+                /* Get the last results  */
+                while ( adc_scan_read ( &myChannels[0], &my_an0 ) == 1U );
+                while ( adc_scan_read ( &myChannels[1], &my_fvr ) == 1U );
                 
-                /* Transmit data  */
-                myPtr    =   &my_message[0];
-            
-                /* Reset variables	 */
-                myState	 =	 0U;
-            
-                /* Enables the USART transmit interrupt	 */
-                PIE1bits.TXIE = 1UL;
-            
-                /* Enable transmission    */
-                TXSTAbits.TXEN  =   1UL;
+                /* Pack the message. Turn ADC data into voltage data ( AN0: millivolts, FVR: centivolts, fixed-point )  */
+                my_length   =   4U;
+                my_length  +=   adc_fxp_format ( adc_fxp_convert ( my_an0, ADC_FXP_SCALE_OVS( 1000.0, AN0_OVS ) ), 3U, &my_message[my_length] );
+                memcpy ( &my_message[my_length], " V | FVR = ", 11U );
+                my_length  +=   11U;
+                my_length  +=   adc_fxp_format ( adc_fxp_to_cv ( my_fvr ), 2U, &my_message[my_length] );
+                my_message[my_length++] =   ' ';
+                my_message[my_length++] =   'V';
+                my_message[my_length++] =   '\r';
+                my_message[my_length++] =   '\n';
+                my_tx.length    =   my_length;
+                
+                /* Transmit data. The ISR sends the message straight from my_message  */
+                (void)eusart_send ( &my_tx );
                 
                 /* Next state   */
                 myState =  SM_WAIT_DATA_TRANSMITTED; 
                 break;
                 
             case SM_WAIT_DATA_TRANSMITTED:
-                if ( myFlag ==   0b01 )
+                if ( my_tx.completed == 1U )
                 {
                     /* D5 LED off    */
                     LATB    &=  ~D5;
-                
-                    /* Reset flag   */
-                    myFlag  =   0U;
                     
                     /* Start timer */
                     T2CONbits.TMR2ON   =  1U;
@@ -188,15 +270,15 @@ void main(void) {
                 break;    
             
             case SM_SLEEP:
-                //SLEEP();
-                
-                if ( myFlag ==   0b10 )
+                /* Sleep while the ADC converts ( FRC clock ). The acquisition delays run awake ( Timer4 )  */
+                /* EVT_SCAN_DONE moves on to SM_SEND_DATA_OVER_UART  */
+                if ( eusart_tx_busy () == 0U )
                 {
-                    /* Reset flag   */
-                    myFlag  =   0U;
-                    
-                    /* Next state   */
-                    myState =  SM_SEND_DATA_OVER_UART; 
+                    (void)adc_scan_sleep ();
+                }
+                else
+                {
+                    /* SLEEP would stop the EUSART ( F_OSC ): The conversion waits until the last byte is sent ( ilat dump )  */
                 }
                 break;                
         }
@@ -17,6 +17,7 @@
 #include <pic16f1937.h>
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #ifdef __cplusplus
 extern "C" {
@@ -14,6 +14,8 @@
 #define INTERRUPTS_H_
 
 #include "board.h"
+#include "eusart.h"
+#include "adc_scan.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -33,8 +35,6 @@ void __interrupt() ISR ( void );
 /**@brief Variables.
  */
 extern volatile uint8_t     myFlag;
-extern volatile uint8_t     *myPtr;
-extern volatile uint16_t    myADCresult;
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,116 @@
+/**
+ * @brief       temp_ind.h
+ * @details     Temperature indicator conversion header.
+ *
+ *              The temperature indicator output is VOUT = VDD - n*VT, n = 4 ( high range, TSRNG = 1 )
+ *              or n = 2 ( low range, TSRNG = 0 ). VDD is removed by scanning the FVR as well, both
+ *              channels referred to VDD:
+ *
+ *                  n*VT = V_FVR * ( ADC_FS - code_temp ) / code_fvr
+ *
+ *              VT is kept in 1/4 mV units ( vt_q ) for both ranges. The conversion to degrees is an
+ *              integer lookup table, generated at compile time from the VT model of AN1333, and a
+ *              linear interpolation ( 8x8 multiply ):
+ *
+ *                  VT = TEMP_IND_VT_M40_MV - TEMP_IND_VT_SLOPE_MV * ( T + 40C )
+ *
+ *              Calibration, stored in the data EEPROM ( TEMP_IND_EE_ADDR ):
+ *
+ *                  - 1 point:  vt_q is shifted so the model matches the point ( offset ).
+ *                  - 2 points: vt_q is mapped onto the model through both points ( offset and gain ).
+ *
+ *              The calibration point is the vt_q read at a known temperature, see temp_ind_cal_save().
+ *              No calibration is used if the EEPROM is blank.
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero (aqueronteblog@gmail.com)
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         The accuracy of the uncalibrated indicator is poor, check: "AN1333. Use and Calibration of the
+ *              Internal Temperature Indicator".
+ * @warning     N/A
+ */
+#ifndef TEMP_IND_H_
+#define TEMP_IND_H_
+
+#include "board.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**@brief Constants.
+ */
+#ifndef TEMP_IND_FVR_MV
+#define TEMP_IND_FVR_MV         1024U           /*!<   FVR buffer 1 = 1.024V ( ADFVR = 0b01 )                  */
+#endif
+
+#define TEMP_IND_ADC_FS         1023U           /*!<   ADC 10-bit full scale                                   */
+
+#define TEMP_IND_VT_M40_MV      659.0           /*!<   VT at -40C ( AN1333, typ. )                             */
+#define TEMP_IND_VT_SLOPE_MV    1.32            /*!<   VT slope ( AN1333, typ. ), mV/C                         */
+
+#ifndef TEMP_IND_EE_ADDR
+#define TEMP_IND_EE_ADDR        0x00U           /*!<   Calibration record, data EEPROM address ( 10 bytes )    */
+#endif
+#define TEMP_IND_EE_MAGIC       0x7AU           /*!<   Calibration record is valid                             */
+
+/**@brief Lookup table: TEMP_IND_LUT_SIZE entries every 2^TEMP_IND_LUT_SHIFT vt_q ( 8mV, ~6C ) from TEMP_IND_LUT_Q0.
+ */
+#define TEMP_IND_LUT_Q0         1728U           /*!<   VT = 432mV, +132C    */
+#define TEMP_IND_LUT_SHIFT      5U
+#define TEMP_IND_LUT_SIZE       30U             /*!<   Up to VT = 664mV, -44C    */
+#define TEMP_IND_LUT_Q_MAX      ( TEMP_IND_LUT_Q0 + ( ( TEMP_IND_LUT_SIZE - 1U ) << TEMP_IND_LUT_SHIFT ) )
+
+/**@brief Model: degrees x10 for a given vt_q ( evaluated at compile time ).
+ */
+#define TEMP_IND_ROUND( x )     ( ( (x) < 0.0 ) ? ( (x) - 0.5 ) : ( (x) + 0.5 ) )
+#define TEMP_IND_MODEL( vt_q )  ( (int16_t)TEMP_IND_ROUND( 10.0 * ( ( ( TEMP_IND_VT_M40_MV - ( (double)(vt_q) / 4.0 ) ) / TEMP_IND_VT_SLOPE_MV ) - 40.0 ) ) )
+#define TEMP_IND_LUT( i )       TEMP_IND_MODEL( TEMP_IND_LUT_Q0 + ( (uint16_t)(i) << TEMP_IND_LUT_SHIFT ) )
+
+/**@brief Model: vt_q at -40C and vt_q per 100C ( inverse model, calibration ).
+ */
+#define TEMP_IND_Q_M40          ( (int16_t)( ( 4.0 * TEMP_IND_VT_M40_MV ) + 0.5 ) )
+#define TEMP_IND_Q_PER_KDECI    ( (int16_t)( ( 4.0 * TEMP_IND_VT_SLOPE_MV * 100.0 ) + 0.5 ) )
+
+#define TEMP_IND_GAIN_SHIFT     12U             /*!<   2-point calibration gain: Q12    */
+
+
+/**@brief Range ( FVRCON.TSRNG ).
+ */
+typedef enum{
+  TEMP_IND_RANGE_LOW    = 0U,       /*!<   VOUT = VDD - 2VT, VDD >= 1.8V    */
+  TEMP_IND_RANGE_HIGH   = 1U        /*!<   VOUT = VDD - 4VT, VDD >= 3.6V    */
+} temp_ind_range_t;
+
+
+/**@brief Calibration record.
+ */
+typedef struct{
+  uint8_t   points;                 /*!<   0: None, 1: Offset, 2: Offset and gain    */
+  uint16_t  vt_q[2];                /*!<   vt_q read at each point                   */
+  int16_t   deci[2];                /*!<   Temperature of each point, C x10          */
+} temp_ind_cal_t;
+
+
+/**@brief Function prototypes.
+ */
+void     temp_ind_init          ( temp_ind_range_t range );
+uint16_t temp_ind_vt_q          ( uint16_t code_temp, uint16_t code_fvr );
+int16_t  temp_ind_deci          ( uint16_t vt_q );
+void     temp_ind_cal_get       ( temp_ind_cal_t* cal );
+void     temp_ind_cal_save      ( const temp_ind_cal_t* cal );
+
+
+/**@brief Variables.
+ */
+
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TEMP_IND_H_ */
@@ -0,0 +1,97 @@
+/**
+ * @brief       adc_fxp.c
+ * @details     Fixed-point conversion and formatting of the ADC results sources.
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero (aqueronteblog@gmail.com)
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+#include "../inc/adc_fxp.h"
+
+
+/**@brief Constants.
+ */
+static const uint16_t myPow10[5] = { 10000U, 1000U, 100U, 10U, 1U };   /*!<   Decimal weights of a 16-bit value    */
+
+
+/**
+ * @brief       uint16_t adc_fxp_convert ( uint16_t , uint32_t )
+ * @details     It turns an ADC result into voltage units ( multiply, round and shift ).
+ *
+ *
+ * @param[in]    code:      ADC result.
+ * @param[in]    scale:     Scale factor, ADC_FXP_SCALE_MV or ADC_FXP_SCALE_CV.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      Voltage in the units of the scale factor
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+uint16_t adc_fxp_convert ( uint16_t code, uint32_t scale )
+{
+    return (uint16_t)( ( ( (uint32_t)code * scale ) + ( 1UL << ( ADC_FXP_SHIFT - 1U ) ) ) >> ADC_FXP_SHIFT );
+}
+
+
+/**
+ * @brief       uint8_t adc_fxp_format ( uint16_t , uint8_t , uint8_t* )
+ * @details     It writes a fixed-point value as decimal ASCII. The digits are got by subtracting
+ *              the decimal weights, so no division is performed.
+ *
+ *              Example: value = 499, decimals = 2 --> "4.99"
+ *
+ *
+ * @param[in]    value:     Fixed-point value.
+ * @param[in]    decimals:  How many digits are decimals ( 0 to 4 ).
+ *
+ * @param[out]   buff:      ASCII output ( not null terminated, up to 6 characters ).
+ *
+ *
+ * @return      How many characters were written
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+uint8_t adc_fxp_format ( uint16_t value, uint8_t decimals, uint8_t* buff )
+{
+    uint8_t i       =   0U;
+    uint8_t n       =   0U;
+    uint8_t digit   =   0U;
+
+    for ( i = 0U; i < 5U; i++ )
+    {
+        /* Get the digit   */
+        digit   =   '0';
+        while ( value >= myPow10[i] )
+        {
+            value   -=  myPow10[i];
+            digit++;
+        }
+
+        /* Skip the leading zeros, the units digit is always written  */
+        if ( ( n != 0U ) || ( digit != '0' ) || ( ( i + decimals ) >= 4U ) )
+        {
+            if ( ( i + decimals ) == 5U )
+            {
+                buff[n++]   =   '.';
+            }
+
+            buff[n++]   =   digit;
+        }
+    }
+
+    return n;
+}
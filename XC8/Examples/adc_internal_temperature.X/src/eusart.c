@@ -0,0 +1,324 @@
+/**
+ * @brief       eusart.c
+ * @details     EUSART driver sources. Interrupt-driven transmission through a ring buffer
+ *              and through pointer+length descriptors.
+ *
+ *              The main loop is the only producer (it moves myTxHead) and the Tx interrupt is
+ *              the only consumer (it moves myTxTail). Both indexes are single bytes, so they are
+ *              read and written atomically by the PIC16 core and no interrupt masking is needed.
+ *
+ *              A descriptor is sent straight from the caller buffer ( zero-copy ), so binary frames
+ *              of any content can be streamed. Everything goes out in the order it was submitted:
+ *              eusart_send() marks the ring buffer head, the ring buffer is served up to that mark,
+ *              then the descriptor, then the bytes queued after it.
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero (aqueronteblog@gmail.com)
+ * @date        18/October/2026
+ * @version     18/October/2026    Submission order kept: Ring buffer bytes queued after a descriptor wait for it
+ *              18/October/2026    Tx descriptors were added
+ *              18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+#include "../inc/eusart.h"
+
+
+/**@brief Variables.
+ */
+static uint8_t          myTxBuff[EUSART_TX_BUFF_SIZE];  /*!<   Tx ring buffer                   */
+static volatile uint8_t myTxHead;                       /*!<   Next free position ( producer )  */
+static volatile uint8_t myTxTail;                       /*!<   Next byte to send ( consumer )   */
+
+static eusart_tx_desc_t* volatile   myTxDesc;          /*!<   Descriptor in progress                   */
+static const uint8_t* volatile       myTxPtr;           /*!<   Next descriptor byte to send             */
+static volatile uint8_t              myTxMark;          /*!<   Ring buffer head when it was submitted   */
+static volatile uint8_t              myTxLen;           /*!<   Descriptor bytes left to send            */
+
+
+/**
+ * @brief       void eusart_tx_init ( void )
+ * @details     It resets the Tx ring buffer and the Tx descriptor.
+ *
+ *
+ * @param[in]    N/A.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    Tx descriptors were added
+ *              18/October/2026    The ORIGIN
+ * @pre         conf_eusart() must be called first.
+ * @warning     N/A
+ */
+void eusart_tx_init ( void )
+{
+    /* Disable transmission (Tx) interrupt    */
+    PIE1bits.TXIE   =   0U;
+
+    /* Empty ring buffer    */
+    myTxHead    =   0U;
+    myTxTail    =   0U;
+    
+    /* No descriptor in progress    */
+    myTxDesc    =   NULL;
+    myTxPtr     =   NULL;
+    myTxMark    =   0U;
+    myTxLen     =   0U;
+}
+
+
+/**
+ * @brief       uint8_t eusart_write ( const uint8_t* , uint8_t )
+ * @details     It queues data to be transmitted over the EUSART. It never blocks: only the bytes
+ *              that fit in the ring buffer are queued.
+ *
+ *
+ * @param[in]    data:      Data to be transmitted.
+ * @param[in]    length:    How many bytes to be transmitted.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      How many bytes were queued
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         It must not be called from the ISR ( single producer ).
+ * @warning     N/A
+ */
+uint8_t eusart_write ( const uint8_t* data, uint8_t length )
+{
+    uint8_t i       =   0U;
+    uint8_t head    =   myTxHead;
+    uint8_t next    =   0U;
+
+    /* Copy data while there is free room in the ring buffer  */
+    for ( i = 0U; i < length; i++ )
+    {
+        next    =   (uint8_t)( ( head + 1U ) & EUSART_TX_BUFF_MASK );
+
+        if ( next == myTxTail )
+        {
+            /* Ring buffer is full  */
+            break;
+        }
+
+        myTxBuff[head]  =   data[i];
+        head            =   next;
+    }
+
+    if ( i != 0U )
+    {
+        /* Publish the new data to the ISR ( single-byte write )   */
+        myTxHead    =   head;
+
+        /* Enable transmission and the Tx interrupt. TXIF is already set if TXREG is empty   */
+        TXSTAbits.TXEN  =   1U;
+        PIE1bits.TXIE   =   1U;
+    }
+
+    return i;
+}
+
+
+/**
+ * @brief       uint8_t eusart_write_string ( const char* )
+ * @details     It queues a string ( without its null character ) to be transmitted over the EUSART.
+ *
+ *
+ * @param[in]    str:       String to be transmitted.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      How many bytes were queued
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         It must not be called from the ISR ( single producer ).
+ * @warning     N/A
+ */
+uint8_t eusart_write_string ( const char* str )
+{
+    return eusart_write ( (const uint8_t*)str, (uint8_t)strlen ( str ) );
+}
+
+
+/**
+ * @brief       uint8_t eusart_send ( eusart_tx_desc_t* )
+ * @details     It transmits a buffer over the EUSART without copying it. The buffer is sent after
+ *              the data already queued in the ring buffer and before the data queued by
+ *              eusart_write() afterwards.
+ *
+ *              The descriptor is completed once its last byte is loaded into TXREG: completed is
+ *              set to 1 and the callback ( if any ) is called from the ISR.
+ *
+ *
+ * @param[in]    desc:      Tx descriptor.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      0: Another descriptor is in progress, 1: Transmission started
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ring buffer head is marked, the submission order is kept
+ *              18/October/2026    The ORIGIN
+ * @pre         The buffer must not be modified until the descriptor is completed.
+ * @warning     While the descriptor is in progress eusart_write() still queues, but its data waits
+ *              for the descriptor: the ring buffer may fill up.
+ */
+uint8_t eusart_send ( eusart_tx_desc_t* desc )
+{
+    if ( myTxLen != 0U )
+    {
+        return 0U;
+    }
+    
+    if ( desc->length == 0U )
+    {
+        /* Nothing to transmit  */
+        desc->completed =   1U;
+        
+        return 1U;
+    }
+    
+    desc->completed =   0U;
+    
+    /* Publish the descriptor to the ISR, the length goes last ( single-byte write ): The ring
+       buffer is only served up to the current head until the descriptor is completed   */
+    myTxDesc    =   desc;
+    myTxPtr     =   desc->data;
+    myTxMark    =   myTxHead;
+    myTxLen     =   desc->length;
+    
+    /* Enable transmission and the Tx interrupt. TXIF is already set if TXREG is empty   */
+    TXSTAbits.TXEN  =   1U;
+    PIE1bits.TXIE   =   1U;
+    
+    return 1U;
+}
+
+
+/**
+ * @brief       uint8_t eusart_tx_free ( void )
+ * @details     It returns the free room in the Tx ring buffer.
+ *
+ *
+ * @param[in]    N/A.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      How many bytes can be queued
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+uint8_t eusart_tx_free ( void )
+{
+    return (uint8_t)( ( myTxTail - myTxHead - 1U ) & EUSART_TX_BUFF_MASK );
+}
+
+
+/**
+ * @brief       uint8_t eusart_tx_busy ( void )
+ * @details     It checks if there is still data pending to be transmitted.
+ *
+ *
+ * @param[in]    N/A.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      0: All data was transmitted, 1: Transmission in progress
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    Tx descriptors were added
+ *              18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+uint8_t eusart_tx_busy ( void )
+{
+    if ( ( myTxHead != myTxTail ) || ( myTxLen != 0U ) || ( TXSTAbits.TRMT == 0U ) )
+    {
+        return 1U;
+    }
+    else
+    {
+        return 0U;
+    }
+}
+
+
+/**
+ * @brief       void eusart_tx_isr ( void )
+ * @details     Tx interrupt handler. It must be called from ISR() when TXIE and TXIF are set.
+ *              The ring buffer is served up to the mark of the descriptor in progress ( if any ),
+ *              then the descriptor, then the rest of the ring buffer.
+ *
+ *              TXIF is only set when TXREG is free, so a new byte is loaded without waiting for
+ *              the Transmit Shift Register ( TRMT ): the ISR never spins.
+ *
+ *
+ * @param[in]    N/A.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The descriptor is served once the ring buffer reaches its mark
+ *              18/October/2026    Tx descriptors were added
+ *              18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     TXIF is read-only, it is cleared by hardware when TXREG is written.
+ */
+void eusart_tx_isr ( void )
+{
+    if ( ( myTxLen != 0U ) && ( myTxTail == myTxMark ) )
+    {
+        /* Load the next descriptor byte, it clears TXIF    */
+        TXREG   =   *myTxPtr;
+        myTxPtr++;
+        myTxLen--;
+        
+        if ( myTxLen == 0U )
+        {
+            /* Descriptor completed, its buffer can be reused   */
+            myTxDesc->completed =   1U;
+            
+            if ( myTxDesc->done != NULL )
+            {
+                myTxDesc->done ();
+            }
+        }
+    }
+    else if ( myTxTail != myTxHead )
+    {
+        /* Load the next byte, it clears TXIF. Bytes after the mark wait for the descriptor    */
+        TXREG       =   myTxBuff[myTxTail];
+        myTxTail    =   (uint8_t)( ( myTxTail + 1U ) & EUSART_TX_BUFF_MASK );
+    }
+    else
+    {
+        /* Nothing else to transmit, disable the Tx interrupt  */
+        PIE1bits.TXIE   =   0U;
+    }
+}
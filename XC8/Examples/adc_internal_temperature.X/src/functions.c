@@ -177,6 +177,7 @@ void conf_Timer2 ( void )
  *                  - ADC clock: FRC (clock supplied from a dedicated RC oscillator)
  *                  - VREF- is connected to VSS
  *                  - VREF+ is connected to VDD
+ *                  - FVR buffer 1 = 1.024V ( it is scanned together with the temperature indicator )
  * 
  * @param[in]    N/A.
  *
@@ -187,7 +188,8 @@ void conf_Timer2 ( void )
  *
  * @author      Manuel Caballero
  * @date        27/March/2024
- * @version     27/March/2024    The ORIGIN
+ * @version     18/October/2026  FVR buffer 1 enabled
+ *              27/March/2024    The ORIGIN
  * @pre         N/A 
  * @warning     The user must respect the TACQ before start a new ADC conversion! TACQtyp ~ 200us
  * @warning     The user must respect the TCNV before start a new ADC conversion! TCNVtyp ~ 200us
@@ -218,6 +220,12 @@ void conf_adc ( void )
     /* Temperature Indicator is enabled    */
     FVRCONbits.TSEN    =   1U;
     
+    /* FVR buffer 1 = 1.024V    */
+    FVRCONbits.ADFVR    =   0b01;
+    
+    /* FVR is enabled    */
+    FVRCONbits.FVREN    =   1U;
+    
     /* ADC enabled    */
     ADCON0bits.ADON  =   1U;
     
@@ -231,16 +239,19 @@ void conf_adc ( void )
 }
 
 
+/**@brief EUSART baud rate settings ( baud_calc.h ): myBaud_BRG16, myBaud_BRGH, myBaud_SPBRGH, myBaud_SPBRGL.
+ */
+BAUD_CALC_EUSART_DEFINE( myBaud, EUSART_F_OSC, EUSART_BAUDRATE );
+
+
 /**
  * @brief       void conf_eusart ( void )
- * @details     It configures the EUSART in 16-bit asynchronous mode.
+ * @details     It configures the EUSART in asynchronous mode.
  *              
- *              Desire_baudrate = F_OSC/[4(SPBRG+1)]
+ *              Desire_baudrate = F_OSC/[m(SPBRG+1)], m = 4, 16 or 64 ( BRG16, BRGH )
  * 
  *              EUSART
- *                  - 16-bit asynchronous mode
- *                  - F_OSC = 8MHz
- *                  - SPBRG = ( F_OSC/(4Desire_baudrate) ) - 1 = ( 8000000/(4115200) ) - 1 ~ 16 (0x0010)
+ *                  - BRG16, BRGH and SPBRG: Lowest error for EUSART_BAUDRATE at EUSART_F_OSC ( baud_calc.h )
  *                  - 8-bit reception/transmission
  *                  - Auto-Baud detect disabled
  *                  - Receiver interrupt disabled
@@ -255,9 +266,10 @@ void conf_adc ( void )
  *
  * @author      Manuel Caballero
  * @date        10/February/2024
- * @version     27/March/2024       Rx is disabled, F_OSC = 8MHz
+ * @version     18/October/2026     BRG16, BRGH and SPBRG worked out by baud_calc.h
+ *              27/March/2024       Rx is disabled, F_OSC = 8MHz
  *              10/February/2024    The ORIGIN
- * @pre         Error = 100*( 115200 - 117647 )/115200 = 2.12%
+ * @pre         The build fails if the error ( myBaud_ERROR, 0.01% ) is above BAUD_CALC_ERR_MAX.
  * @warning     N/A
  */
 void conf_eusart ( void )
@@ -280,21 +292,21 @@ void conf_eusart ( void )
     /* EUSART: Asynchronous mode    */
     TXSTAbits.SYNC   =   0U;
     
-    /* EUSART: High speed    */
-    TXSTAbits.BRGH   =   1U;
+    /* EUSART: High speed or not ( baud_calc.h )    */
+    TXSTAbits.BRGH   =   myBaud_BRGH;
     
     /* Transmit non-inverted data to the TX/CK pin  */
     BAUDCONbits.SCKP    =   0U;
     
-    /* 16-bit Baud Rate Generator is used    */
-    BAUDCONbits.BRG16   =   1U;
+    /* 16-bit or 8-bit Baud Rate Generator ( baud_calc.h )    */
+    BAUDCONbits.BRG16   =   myBaud_BRG16;
     
     /* Auto-Baud Detect mode is disabled    */
     BAUDCONbits.ABDEN   =   0U;
     
     /* Baudrate value   */
-    SPBRGH  =   0x00;
-    SPBRGL  =   0x10;
+    SPBRGH  =   myBaud_SPBRGH;
+    SPBRGL  =   myBaud_SPBRGL;
     
     /* Clear receiver (Rx) and transmission (Tx) interrupt flags   */
     PIR1bits.RCIF   =   0U;
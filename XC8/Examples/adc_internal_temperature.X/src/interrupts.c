@@ -22,7 +22,9 @@
  *
  * @author      Manuel Caballero
  * @date        09/February/2024
- * @version     09/February/2024   The ORIGIN
+ * @version     18/October/2026    ADC results are sequenced by the ADC scan engine
+ *              18/October/2026    Tx is driven by the EUSART ring buffer driver
+ *              09/February/2024   The ORIGIN
  * @pre         N/A.
  * @warning     N/A
  */
@@ -40,42 +42,29 @@ void __interrupt() ISR ( void )
     }
     
     /* Tx	 */
-	if ( ( PIE1bits.TXIE == 1U ) && ( TXSTAbits.TXEN == 1UL ) )
-	{        
-        /* Wait until Transmit Shift Register Status is empty  */
-        while ( TXSTAbits.TRMT ==  0U );
-        
-		/* Stop transmitting data when that character is found */
-		if ( *myPtr  == '\n' )
-		{            
-            /* Disable transmission   */
-			TXSTAbits.TXEN  =   0UL;
-            
-            /* Indicates that the transmission is completed */
-            myFlag  =   0b01;
-		}
-		else
-		{
-			TXREG	 =	 *myPtr;
-            myPtr++;
-		}
-        
-        /* Clear Tx Interrupt flag  */
-        PIR1bits.TXIF = 0U; 
+	if ( ( PIE1bits.TXIE == 1U ) && ( PIR1bits.TXIF == 1U ) )
+	{
+        /* Load the next byte from the Tx ring buffer ( no waiting on TRMT )    */
+        eusart_tx_isr ();
 	}
     
     /* ADC	 */
 	if ( ( PIE1bits.ADIE == 1U ) && ( PIR1bits.ADIF == 1UL ) )
 	{        
-        /* Get the ADC measurement (right alignment)  */
-        myADCresult =   ADRESH;
-        myADCresult <<= 8U;
-        myADCresult |=  ADRESL;
-		
-        /* Indicates that the ADC data is completed */
-        myFlag  =   0b10;
-            
         /* Clear ADC Interrupt flag  */
         PIR1bits.ADIF = 0U; 
+        
+        /* Store the result and acquire the next channel of the scan  */
+        adc_scan_isr ();
+	}
+    
+    /* Timer4. ADC acquisition delay	 */
+	if ( ( PIE3bits.TMR4IE == 1U ) && ( PIR3bits.TMR4IF == 1U ) )
+	{        
+        /* Clear the interrupt flag   */
+        PIR3bits.TMR4IF = 0U;
+        
+        /* Start the conversion  */
+        adc_scan_tmr4_isr ();
 	}
 }
\ No newline at end of file
@@ -4,21 +4,31 @@
  * 
  *              The code is led by a state machine.
  *              
- *                  - SM_SLEEP:                 It waits until the ADC completes a new measurement.
+ *                  - SM_SLEEP:                 It waits until the ADC scan engine completes a new measurement, every
+ *                                              conversion runs in SLEEP ( sleep conversion mode ).
  *                  - SM_WAIT_TIMER:            It indicates when a new ADC measurement is needed [default].
- *                  - SM_NEW_ADC_TEMP:          It makes the ADC start a new measurement.
+ *                  - SM_NEW_ADC_TEMP:          It makes the ADC scan engine start a new measurement.
  *                  - SM_SEND_DATA_OVER_UART:   It sends the ADC measurement over the UART.
  *                  - SM_WAIT_DATA_TRANSMITTED: It waits until the ADC measurement is sent over the UART.
  *              
  *              Every ~0.13s, a new value of the internal temperature sensor will be transmitted over the UART. The SLEEP mode is only
  *              used to wait for the ADC module to complete a new measurement.  
  * 
+ *              The temperature indicator and the FVR are scanned together, so the temperature is independent of VDD. It is
+ *              converted into degrees by temp_ind ( lookup table, calibration in the data EEPROM ). 
+ * 
  *
  * @return      N/A
  *
  * @author      Manuel Caballero (aqueronteblog@gmail.com)
  * @date        27/March/2024
- * @version     27/March/2024    The ORIGIN
+ * @version     18/October/2026  Conversions in SLEEP ( adc_scan_sleep() )
+ *              18/October/2026  Temperature in degrees ( temp_ind ), FVR scanned as the reference
+ *              18/October/2026  The temperature indicator is converted by the ADC scan engine
+ *              18/October/2026  Fixed-point voltage formatting, sprintf/float removed
+ *              18/October/2026  Transmission through an EUSART Tx descriptor
+ *              18/October/2026  Transmission through the EUSART Tx ring buffer driver
+ *              27/March/2024    The ORIGIN
  * @pre         This project was tested on a PIC16F1937 using a PICDEM 2 Plus.
  * @pre         In asynchronous mode, the SLEEP mode cannot be used due to EUSART clock source (F_OSC).
  * @pre         The SLEEP mode cannot be used for the Timer2 due to Timer2/4/6 clock source (F_OSC).
@@ -60,13 +70,15 @@
 #include "../inc/board.h"
 #include "../inc/functions.h"
 #include "../inc/interrupts.h"
+#include "../inc/eusart.h"
+#include "../inc/adc_fxp.h"
+#include "../inc/adc_scan.h"
+#include "../inc/temp_ind.h"
 
 /**@brief Constants.
  */
-#define EUSART_BUFF 16U
-
-#define ADC_VDD_REF     5.0                 /*!<   ADC VDD = 5V    */
-#define ADC_RES         ( 1024.0 - 1.0 )    /*!<   ADC 10-bit resolution    */  
+#define EUSART_BUFF 64U
+#define ADC_BUFF    4U      /*!< Results kept per channel */
 
 typedef enum{
   SM_SLEEP                 = 0U,      /*!<   Sleep mode    */
@@ -79,20 +91,35 @@ typedef enum{
 /**@brief Variables.
  */
 my_sm_t             myState;        /* State that indicates when to perform the next action */
-volatile uint8_t    *myPtr;         /* Pointer to point out myMessage   */
-volatile uint8_t    myFlag;         /* Flag that indicates either if the Timer overflows (0b11), the ADC measurement is transmitted over the UART (0b01) or ADC finishes the current measurement conversion (0b10) */
-volatile uint16_t   myADCresult;    /* ADC result */
+volatile uint8_t    myFlag;         /* Flag that indicates if the Timer overflows (0b11) */
+uint16_t            myTempbuff[ADC_BUFF];   /* Temperature indicator results */
+uint16_t            myFVRbuff[ADC_BUFF];    /* FVR results */
+
+/* ADC scan table: Temperature indicator ( TACQ ~200us ) and FVR buffer 1 = 1.024V  */
+adc_scan_channel_t  myChannels[] = {
+    { .chs = ADC_SCAN_TEMP, .acq = ADC_SCAN_ACQ_US( 200U ), .buff = &myTempbuff[0], .size = ADC_BUFF },
+    { .chs = ADC_SCAN_FVR,  .acq = ADC_SCAN_ACQ_US( 20U ),  .buff = &myFVRbuff[0],  .size = ADC_BUFF }
+};
 
 /**@brief Function for application main entry.
  */
 void main(void) {
     uint8_t my_message[EUSART_BUFF] = {0};
+    uint8_t my_length   =   0U;
+    uint16_t my_temp    =   0U;
+    uint16_t my_fvr     =   0U;
+    int16_t  my_deci    =   0;
+    eusart_tx_desc_t my_tx = { NULL, 0U, NULL, 0U };
     
-    conf_clk    ();
-    conf_gpio   ();
-    conf_adc    ();
-    conf_eusart ();
-    conf_Timer2 ();
+    conf_clk        ();
+    conf_gpio       ();
+    conf_adc        ();
+    adc_scan_init   ( &myChannels[0], (uint8_t)( sizeof( myChannels ) / sizeof( myChannels[0] ) ) );
+    adc_scan_sleep_enable ( ADC_SCAN_GATE_ALL );
+    temp_ind_init   ( TEMP_IND_RANGE_HIGH );
+    conf_eusart     ();
+    eusart_tx_init  ();
+    conf_Timer2     ();
        
     /* Enable interrupts    */
     INTCONbits.PEIE =   1U; // Enables all active peripheral interrupts
@@ -132,12 +159,8 @@ void main(void) {
             case SM_NEW_ADC_TEMP:
                 LATB    |=  D5;
                 
-                /* Reset variable to store the ADC value    */
-                myADCresult =   0U;
-                
-                /* ADC enabled and start a new ADC sampling   */
-                ADCON0bits.ADON     =   1U;
-                ADCON0bits.GO_nDONE =   1U;
+                /* Start a new scan: Temperature indicator, FVR   */
+                (void)adc_scan_start ();
                 
                 /* Next state   */
                 myState =  SM_SLEEP; 
@@ -147,33 +170,42 @@ void main(void) {
                 /* D5 LED on    */
                 LATB    |=  D5;
                 
-                /* Pack the message. Turn ADC data into voltage data  */
-                sprintf ((char*)my_message, "ADC_temp = %d | Vtemp = %0.2f V\r\n", myADCresult, (float)( ( ADC_VDD_REF * myADCresult ) / ADC_RES ));
+                /* Turn ADC data into degrees ( C x10 ), VDD is cancelled out by the FVR  */
+                my_deci     =   temp_ind_deci ( temp_ind_vt_q ( my_temp, my_fvr ) );
                 
-                /* Transmit data  */
-                myPtr    =   &my_message[0];
-            
-                /* Reset variables	 */
-                myState	 =	 0U;
-            
-                /* Enables the USART transmit interrupt	 */
-                PIE1bits.TXIE = 1UL;
-            
-                /* Enable transmission    */
-                TXSTAbits.TXEN  =   1UL;
+                /* Pack the message: "T = x.x C | ADC_temp = x | Vtemp = x.xx V\r\n". Turn ADC data into voltage data ( centivolts, fixed-point )  */
+                memcpy ( &my_message[0], "T = ", 4U );
+                my_length   =   4U;
+                if ( my_deci < 0 )
+                {
+                    my_message[my_length++] =   '-';
+                    my_deci                 =   -my_deci;
+                }
+                my_length  +=   adc_fxp_format ( (uint16_t)my_deci, 1U, &my_message[my_length] );
+                memcpy ( &my_message[my_length], " C | ADC_temp = ", 16U );
+                my_length  +=   16U;
+                my_length  +=   adc_fxp_format ( my_temp, 0U, &my_message[my_length] );
+                memcpy ( &my_message[my_length], " | Vtemp = ", 11U );
+                my_length  +=   11U;
+                my_length  +=   adc_fxp_format ( adc_fxp_to_cv ( my_temp ), 2U, &my_message[my_length] );
+                memcpy ( &my_message[my_length], " V\r\n", 4U );
+                my_length  +=   4U;
+                
+                my_tx.data      =   &my_message[0];
+                my_tx.length    =   my_length;
+                
+                /* Transmit data. The ISR sends the message straight from my_message  */
+                (void)eusart_send ( &my_tx );
                 
                 /* Next state   */
                 myState =  SM_WAIT_DATA_TRANSMITTED; 
                 break;
                 
             case SM_WAIT_DATA_TRANSMITTED:
-                if ( myFlag ==   0b01 )
+                if ( my_tx.completed == 1U )
                 {
                     /* D5 LED off    */
                     LATB    &=  ~D5;
-                
-                    /* Reset flag   */
-                    myFlag  =   0U;
                     
                     /* Start timer */
                     T2CONbits.TMR2ON   =  1U;
@@ -188,12 +220,14 @@ void main(void) {
                 break;    
             
             case SM_SLEEP:
-                SLEEP();
+                /* Sleep while the ADC converts ( FRC clock ). The acquisition delays run awake ( Timer4 )  */
+                (void)adc_scan_sleep ();
                 
-                if ( myFlag ==   0b10 )
+                if ( adc_scan_busy () == 0U )
                 {
-                    /* Reset flag   */
-                    myFlag  =   0U;
+                    /* Get the last results  */
+                    while ( adc_scan_read ( &myChannels[0], &my_temp ) == 1U );
+                    while ( adc_scan_read ( &myChannels[1], &my_fvr ) == 1U );
                     
                     /* Next state   */
                     myState =  SM_SEND_DATA_OVER_UART; 
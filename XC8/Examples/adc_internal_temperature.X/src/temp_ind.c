@@ -0,0 +1,421 @@
+/**
+ * @brief       temp_ind.c
+ * @details     Temperature indicator conversion sources.
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero (aqueronteblog@gmail.com)
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+#include "../inc/temp_ind.h"
+
+
+/**@brief Constants.
+ */
+/**@brief Degrees x10 every 8mV of VT ( TEMP_IND_MODEL() ).
+ */
+static const int16_t myLut[TEMP_IND_LUT_SIZE] = {
+    TEMP_IND_LUT( 0U ),  TEMP_IND_LUT( 1U ),  TEMP_IND_LUT( 2U ),  TEMP_IND_LUT( 3U ),  TEMP_IND_LUT( 4U ),
+    TEMP_IND_LUT( 5U ),  TEMP_IND_LUT( 6U ),  TEMP_IND_LUT( 7U ),  TEMP_IND_LUT( 8U ),  TEMP_IND_LUT( 9U ),
+    TEMP_IND_LUT( 10U ), TEMP_IND_LUT( 11U ), TEMP_IND_LUT( 12U ), TEMP_IND_LUT( 13U ), TEMP_IND_LUT( 14U ),
+    TEMP_IND_LUT( 15U ), TEMP_IND_LUT( 16U ), TEMP_IND_LUT( 17U ), TEMP_IND_LUT( 18U ), TEMP_IND_LUT( 19U ),
+    TEMP_IND_LUT( 20U ), TEMP_IND_LUT( 21U ), TEMP_IND_LUT( 22U ), TEMP_IND_LUT( 23U ), TEMP_IND_LUT( 24U ),
+    TEMP_IND_LUT( 25U ), TEMP_IND_LUT( 26U ), TEMP_IND_LUT( 27U ), TEMP_IND_LUT( 28U ), TEMP_IND_LUT( 29U )
+};
+
+
+/**@brief Variables.
+ */
+static uint16_t myFvrScale;         /*!<   V_FVR * 4/n: ( ADC_FS - code_temp ) / code_fvr to vt_q    */
+static uint8_t  myPoints;           /*!<   Calibration points in use                                 */
+static int16_t  myOffset;           /*!<   1 point: vt_q offset                                      */
+static uint16_t myCalQ;             /*!<   2 points: vt_q read at the first point                    */
+static int16_t  myModelQ;           /*!<   2 points: model vt_q at the first point                   */
+static int16_t  myGain;             /*!<   2 points: gain, Q12                                       */
+
+
+/**@brief Function prototypes.
+ */
+static void     temp_ind_cal_load   ( void );
+static int16_t  temp_ind_model_q    ( int16_t deci );
+static uint8_t  temp_ind_ee_read    ( uint8_t address );
+static void     temp_ind_ee_write   ( uint8_t address, uint8_t data );
+
+
+/**
+ * @brief       void temp_ind_init ( temp_ind_range_t )
+ * @details     It sets the range and loads the calibration from the data EEPROM.
+ *
+ *
+ * @param[in]    range:     Range set in FVRCON.TSRNG.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+void temp_ind_init ( temp_ind_range_t range )
+{
+    /* vt_q = n*VT * 4/n: x1 in the high range, x2 in the low range   */
+    if ( range == TEMP_IND_RANGE_HIGH )
+    {
+        myFvrScale  =   TEMP_IND_FVR_MV;
+    }
+    else
+    {
+        myFvrScale  =   ( TEMP_IND_FVR_MV << 1U );
+    }
+
+    temp_ind_cal_load ();
+}
+
+
+/**
+ * @brief       uint16_t temp_ind_vt_q ( uint16_t , uint16_t )
+ * @details     It turns the temperature indicator and the FVR results into VT ( 1/4 mV ), VDD is
+ *              cancelled out. Both channels must be converted with VREF+ = VDD.
+ *
+ *
+ * @param[in]    code_temp: Temperature indicator result.
+ * @param[in]    code_fvr:  FVR result.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      VT, 1/4 mV ( 0: Not valid )
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         temp_ind_init() must be called first.
+ * @warning     N/A
+ */
+uint16_t temp_ind_vt_q ( uint16_t code_temp, uint16_t code_fvr )
+{
+    uint32_t    aux;
+
+    if ( ( code_fvr == 0U ) || ( code_temp > TEMP_IND_ADC_FS ) )
+    {
+        return 0U;
+    }
+
+    aux =   ( (uint32_t)( TEMP_IND_ADC_FS - code_temp ) * myFvrScale ) + ( code_fvr >> 1U );
+
+    return (uint16_t)( aux / code_fvr );
+}
+
+
+/**
+ * @brief       int16_t temp_ind_deci ( uint16_t )
+ * @details     It turns VT into degrees: calibration, lookup table and linear interpolation.
+ *              The result is clamped to the table range.
+ *
+ *
+ * @param[in]    vt_q:      VT, 1/4 mV ( temp_ind_vt_q() ).
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      Temperature, C x10
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         temp_ind_init() must be called first.
+ * @warning     N/A
+ */
+int16_t temp_ind_deci ( uint16_t vt_q )
+{
+    int16_t     q;
+    uint8_t     i;
+    uint8_t     frac;
+    uint8_t     step;
+
+    /* Calibration   */
+    if ( myPoints == 1U )
+    {
+        q   =   (int16_t)vt_q + myOffset;
+    }
+    else if ( myPoints == 2U )
+    {
+        q   =   myModelQ + (int16_t)( ( (int32_t)( (int16_t)vt_q - (int16_t)myCalQ ) * myGain ) >> TEMP_IND_GAIN_SHIFT );
+    }
+    else
+    {
+        q   =   (int16_t)vt_q;
+    }
+
+    /* Table range   */
+    if ( q <= (int16_t)TEMP_IND_LUT_Q0 )
+    {
+        return myLut[0];
+    }
+    if ( q >= (int16_t)TEMP_IND_LUT_Q_MAX )
+    {
+        return myLut[TEMP_IND_LUT_SIZE - 1U];
+    }
+
+    /* Lookup and interpolation. The table decreases by less than 256 per step   */
+    q      -=   (int16_t)TEMP_IND_LUT_Q0;
+    i       =   (uint8_t)( (uint16_t)q >> TEMP_IND_LUT_SHIFT );
+    frac    =   (uint8_t)( (uint16_t)q & ( ( 1U << TEMP_IND_LUT_SHIFT ) - 1U ) );
+    step    =   (uint8_t)( myLut[i] - myLut[i + 1U] );
+
+    return ( myLut[i] - (int16_t)( ( ( (uint16_t)step * frac ) + ( 1U << ( TEMP_IND_LUT_SHIFT - 1U ) ) ) >> TEMP_IND_LUT_SHIFT ) );
+}
+
+
+/**
+ * @brief       void temp_ind_cal_get ( temp_ind_cal_t* )
+ * @details     It reads the calibration record from the data EEPROM.
+ *
+ *
+ * @param[in]    N/A.
+ *
+ * @param[out]   cal:       Calibration ( points = 0 if the record is not valid ).
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+void temp_ind_cal_get ( temp_ind_cal_t* cal )
+{
+    uint8_t i   =   0U;
+    uint8_t a   =   TEMP_IND_EE_ADDR + 2U;
+
+    cal->points =   0U;
+    if ( temp_ind_ee_read ( TEMP_IND_EE_ADDR ) == TEMP_IND_EE_MAGIC )
+    {
+        cal->points =   temp_ind_ee_read ( TEMP_IND_EE_ADDR + 1U );
+    }
+
+    for ( i = 0U; i < 2U; i++ )
+    {
+        cal->vt_q[i]    =   temp_ind_ee_read ( a++ );
+        cal->vt_q[i]   |=   ( (uint16_t)temp_ind_ee_read ( a++ ) << 8U );
+        cal->deci[i]    =   (int16_t)temp_ind_ee_read ( a++ );
+        cal->deci[i]   |=   (int16_t)( (uint16_t)temp_ind_ee_read ( a++ ) << 8U );
+    }
+
+    if ( cal->points > 2U )
+    {
+        cal->points =   0U;
+    }
+}
+
+
+/**
+ * @brief       void temp_ind_cal_save ( const temp_ind_cal_t* )
+ * @details     It writes the calibration record into the data EEPROM and starts using it.
+ *
+ *              Calibration: Keep the device at a known temperature, read vt_q ( temp_ind_vt_q() ) and
+ *              save it together with the temperature. A second point, far from the first one
+ *              ( e.g. 25C and 85C ), corrects the slope too.
+ *
+ *
+ * @param[in]    cal:       Calibration.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     It blocks ~5ms per byte ( EEPROM write time ).
+ */
+void temp_ind_cal_save ( const temp_ind_cal_t* cal )
+{
+    uint8_t i   =   0U;
+    uint8_t a   =   TEMP_IND_EE_ADDR + 2U;
+
+    /* The record is invalidated until it is complete   */
+    temp_ind_ee_write ( TEMP_IND_EE_ADDR, 0xFFU );
+    temp_ind_ee_write ( TEMP_IND_EE_ADDR + 1U, cal->points );
+
+    for ( i = 0U; i < 2U; i++ )
+    {
+        temp_ind_ee_write ( a++, (uint8_t)cal->vt_q[i] );
+        temp_ind_ee_write ( a++, (uint8_t)( cal->vt_q[i] >> 8U ) );
+        temp_ind_ee_write ( a++, (uint8_t)cal->deci[i] );
+        temp_ind_ee_write ( a++, (uint8_t)( (uint16_t)cal->deci[i] >> 8U ) );
+    }
+
+    temp_ind_ee_write ( TEMP_IND_EE_ADDR, TEMP_IND_EE_MAGIC );
+
+    temp_ind_cal_load ();
+}
+
+
+/**
+ * @brief       void temp_ind_cal_load ( void )
+ * @details     It reads the calibration record and works out the offset/gain used by temp_ind_deci().
+ *
+ *
+ * @param[in]    N/A.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+static void temp_ind_cal_load ( void )
+{
+    temp_ind_cal_t  cal;
+    int16_t         model_q2;
+
+    temp_ind_cal_get ( &cal );
+
+    /* Two points too close to each other: offset only   */
+    if ( ( cal.points == 2U ) && ( cal.vt_q[1] == cal.vt_q[0] ) )
+    {
+        cal.points  =   1U;
+    }
+
+    myPoints    =   cal.points;
+    myCalQ      =   cal.vt_q[0];
+    myModelQ    =   temp_ind_model_q ( cal.deci[0] );
+    myOffset    =   myModelQ - (int16_t)cal.vt_q[0];
+    myGain      =   (int16_t)( 1U << TEMP_IND_GAIN_SHIFT );
+
+    if ( myPoints == 2U )
+    {
+        model_q2    =   temp_ind_model_q ( cal.deci[1] );
+        myGain      =   (int16_t)( ( (int32_t)( model_q2 - myModelQ ) << TEMP_IND_GAIN_SHIFT ) / ( (int32_t)cal.vt_q[1] - (int32_t)cal.vt_q[0] ) );
+    }
+}
+
+
+/**
+ * @brief       int16_t temp_ind_model_q ( int16_t )
+ * @details     Inverse model: vt_q for a given temperature.
+ *
+ *
+ * @param[in]    deci:      Temperature, C x10.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      vt_q
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+static int16_t temp_ind_model_q ( int16_t deci )
+{
+    int32_t aux =   (int32_t)( deci + 400 ) * TEMP_IND_Q_PER_KDECI;
+
+    /* Rounded to the nearest   */
+    if ( aux < 0 )
+    {
+        aux -=  500;
+    }
+    else
+    {
+        aux +=  500;
+    }
+
+    return (int16_t)( TEMP_IND_Q_M40 - (int16_t)( aux / 1000 ) );
+}
+
+
+/**
+ * @brief       uint8_t temp_ind_ee_read ( uint8_t )
+ * @details     It reads a byte from the data EEPROM.
+ *
+ *
+ * @param[in]    address:   Data EEPROM address.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      Data
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+static uint8_t temp_ind_ee_read ( uint8_t address )
+{
+    EEADRL  =   address;
+
+    /* Data EEPROM memory   */
+    EECON1bits.CFGS     =   0U;
+    EECON1bits.EEPGD    =   0U;
+
+    /* Initiate read  */
+    EECON1bits.RD       =   1U;
+
+    return EEDATL;
+}
+
+
+/**
+ * @brief       void temp_ind_ee_write ( uint8_t , uint8_t )
+ * @details     It writes a byte into the data EEPROM.
+ *
+ *
+ * @param[in]    address:   Data EEPROM address.
+ * @param[in]    data:      Data.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     It waits until the write is completed.
+ */
+static void temp_ind_ee_write ( uint8_t address, uint8_t data )
+{
+    uint8_t gie =   INTCONbits.GIE;
+
+    EEADRL  =   address;
+    EEDATL  =   data;
+
+    /* Data EEPROM memory, writes enabled   */
+    EECON1bits.CFGS     =   0U;
+    EECON1bits.EEPGD    =   0U;
+    EECON1bits.WREN     =   1U;
+
+    /* Unlock sequence: it must not be interrupted   */
+    INTCONbits.GIE      =   0U;
+    EECON2              =   0x55U;
+    EECON2              =   0xAAU;
+    EECON1bits.WR       =   1U;
+    INTCONbits.GIE      =   gie;
+
+    EECON1bits.WREN     =   0U;
+
+    while ( EECON1bits.WR == 1U );
+}
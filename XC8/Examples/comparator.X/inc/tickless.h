@@ -0,0 +1,118 @@
+/**
+ * @brief       tickless.h
+ * @details     Tickless idle scheduler header.
+ *
+ *              The tasks ( tls_task_t ) are kept in a table given by the user. Each one has a deadline
+ *              ( and a period if it is periodic ), tls_dispatch() calls the ones which are due. There is no
+ *              periodic tick: tls_idle() finds the nearest deadline, programs the wake-up source for that
+ *              interval and sleeps. With no task pending, the uC sleeps until any other interrupt.
+ *
+ *              Time is counted in TLS_HZ counts ( 32.768kHz ), TLS_MS() converts from ms.
+ *
+ *                  - TLS_SOURCE_T1OSC: Timer1, 32.768kHz crystal on T1OSI/T1OSO, asynchronous, it is never
+ *                                      stopped so the time base does not drift. Only TMR1H is written to
+ *                                      program the wake-up, so its resolution is 256 counts ( 7.8ms ) and the
+ *                                      tasks run up to 7.8ms late. An interval longer than 2s takes one wake-up
+ *                                      every 2s ( Timer1 overflow ).
+ *                  - TLS_SOURCE_WDT:   WDT ( WDTE = SWDTEN ), the largest WDT period ( 1ms to 256s, LFINTOSC )
+ *                                      which is shorter than the interval. Several sleeps are taken for long
+ *                                      intervals, the tasks may run early or late by the LFINTOSC tolerance.
+ *                                      A remainder below 1ms takes one 1ms period, the task runs up to 1ms late.
+ *                                      A wake-up by another interrupt does not advance the time ( the WDT
+ *                                      count cannot be read ), so the deadlines are late by the time slept.
+ *
+ *              The main loop becomes:
+ *
+ *                  while ( 1U )
+ *                  {
+ *                      tls_dispatch ();
+ *
+ *                      INTCONbits.GIE  =   0U;
+ *                      if ( myFlag == 0U )
+ *                      {
+ *                          tls_idle ();            // Sleeps until the next deadline or any interrupt
+ *                      }
+ *                      INTCONbits.GIE  =   1U;
+ *
+ *                      ...                         // Work of the interrupts ( myFlag )
+ *                  }
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero (aqueronteblog@gmail.com)
+ * @date        18/October/2026
+ * @version     18/October/2026    WDT: A remainder below the shortest period is rounded up to it
+ *              18/October/2026    The ORIGIN
+ * @pre         TLS_SOURCE_T1OSC: Timer1 is used by the module, tls_isr() must be called on TMR1IF.
+ *              TLS_SOURCE_WDT:   The configuration bits must be WDTE = SWDTEN.
+ * @warning     N/A
+ */
+#ifndef TICKLESS_H_
+#define TICKLESS_H_
+
+#include "board.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**@brief Constants.
+ */
+#define TLS_SOURCE_T1OSC    0U              /*!<   Timer1 and the 32.768kHz crystal    */
+#define TLS_SOURCE_WDT      1U              /*!<   WDT ( LFINTOSC )                    */
+
+#ifndef TLS_SOURCE
+#define TLS_SOURCE          TLS_SOURCE_T1OSC
+#endif
+
+#define TLS_HZ              32768UL         /*!<   Time base: counts per second    */
+
+/**@brief Counts for a given time in ms ( max. ~17min ) or seconds.
+ */
+#define TLS_MS( ms )        ( (uint32_t)( ( ( (uint32_t)(ms) * 4096UL ) + 62UL ) / 125UL ) )
+#define TLS_S( s )          ( (uint32_t)(s) * TLS_HZ )
+
+/**@brief Timer1: TMR1H is not written while TMR1L >= TLS_T1_GUARD. The 32 counts ( ~1ms ) left hold the TMR1H/TMR1L
+ *        read and the TMR1H write only, F_OSC down to 125kHz.
+ */
+#define TLS_T1_GUARD        0xE0U
+
+/**@brief WDT: Period ( WDTPS = ps, 1:32 to 1:8388608 of LFINTOSC = 31kHz ) in counts.
+ */
+#define TLS_WDT_PS_MAX      18U             /*!<   1:8388608, 256s    */
+#define TLS_WDT_COUNTS( ps )    ( ( 32UL << (ps) ) + ( ( ( 32UL << (ps) ) * 57UL ) / 1000UL ) )
+
+
+/**@brief Task.
+ */
+typedef struct{
+  void          ( *run )( void );   /*!<   Task function, called from tls_dispatch()       */
+  uint32_t      due;                /*!<   Deadline ( tls_now() )                          */
+  uint32_t      period;             /*!<   Counts, 0: One-shot task                        */
+  uint8_t       active;             /*!<   1: Pending                                      */
+} tls_task_t;
+
+
+/**@brief Function prototypes.
+ */
+void     tls_init       ( tls_task_t* tasks, uint8_t count );
+void     tls_start      ( tls_task_t* task, uint32_t delay, uint32_t period );
+void     tls_stop       ( tls_task_t* task );
+uint32_t tls_now        ( void );
+void     tls_dispatch   ( void );
+void     tls_idle       ( void );
+uint32_t tls_wakeups    ( void );
+void     tls_isr        ( void );
+
+
+/**@brief Variables.
+ */
+
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TICKLESS_H_ */
@@ -7,6 +7,10 @@
  *                  - D5 LED ON:    C1+ > C1-
  *                  - D5 LED OFF:   C1+ <= C1-
  *                             
+ *              The output is debounced by a one-shot task of the tickless scheduler ( tickless.h ): D5 is
+ *              updated 10ms after the last change of C1, so a noisy input does not make it flicker. Timer1
+ *              ( 32.768kHz crystal ) wakes the uC up for that deadline only, there is no periodic wake-up.
+ * 
  *              The microcontroller is in SLEEP mode the rest of the time.  
  * 
  *
@@ -14,7 +18,8 @@
  *
  * @author      Manuel Caballero (aqueronteblog@gmail.com)
  * @date        27/March/2024
- * @version     27/March/2024    The ORIGIN
+ * @version     18/October/2026  Debounce by the tickless scheduler
+ *              27/March/2024    The ORIGIN
  * @pre         This project was tested on a PIC16F1937 using a PICDEM 2 Plus.
  * @warning     N/A
  * @pre         This code belongs to AqueronteBlog. 
@@ -54,14 +59,24 @@
 #include "../inc/board.h"
 #include "../inc/functions.h"
 #include "../inc/interrupts.h"
+#include "../inc/tickless.h"
 
 /**@brief Constants.
  */
+#define TASK_DEBOUNCE   0U          /*!<   C1 output debounce task    */
 
 /**@brief Variables.
  */
 volatile uint8_t    myFlag;         /* Flag that indicates if there is a change by the comparator module */
 
+/**@brief Function prototypes.
+ */
+static void debounce_task   ( void );
+
+static tls_task_t   myTasks[]   =   {
+    [TASK_DEBOUNCE] = { .run = debounce_task }
+};
+
 /**@brief Function for application main entry.
  */
 void main(void) {    
@@ -73,32 +88,66 @@ void main(void) {
     INTCONbits.PEIE =   1U; // Enables all active peripheral interrupts
     INTCONbits.GIE  =   1U; // Enables all active interrupts
     
+    /* Tickless scheduler: Timer1 and the 32.768kHz crystal */
+    tls_init ( &myTasks[0], sizeof( myTasks )/sizeof( myTasks[0] ) );
+    
     /* Reset variables  */
     myFlag  =   0U;
     
     while ( 1U )
     {
-       /* Change the state of the D5 LED depending of C1 output, go to sleep mode otherwise */
+        /* Run the tasks which are due  */
+        tls_dispatch ();
+        
+        /* Sleep mode until the next deadline, unless an interrupt is pending */
+        INTCONbits.GIE  =   0U;
+        if ( myFlag == 0U )
+        {
+            tls_idle ();
+        }
+        INTCONbits.GIE  =   1U;
+        
+        /* C1 output changed: D5 LED is updated once it is stable for 10ms */
         if ( myFlag != 0U )
         {
-            /* Check comparator output  */
-            if ( CMOUTbits.MC1OUT == 0U )
-            {
-                /* If comparator output is low, D5 LED is off then   */
-                LATB    &=  ~D5;
-            }
-            else
-            {
-                /* If comparator output is high, D5 LED is on then   */
-                LATB    |=  D5;
-            }
+            tls_start ( &myTasks[TASK_DEBOUNCE], TLS_MS( 10U ), 0UL );
             
             /* Reset variable  */
             myFlag  =   0U;  
         }
-        else
-        {
-            SLEEP();
-        }
+    }
+}
+
+
+
+/**
+ * @brief       void debounce_task ( void )
+ * @details     C1 output debounce task, the state of the D5 LED follows the C1 output.
+ *
+ * @param[in]    N/A.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      N/A.
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026   The ORIGIN
+ * @pre         N/A
+ * @warning     N/A.
+ */
+static void debounce_task ( void )
+{
+    /* Check comparator output  */
+    if ( CMOUTbits.MC1OUT == 0U )
+    {
+        /* If comparator output is low, D5 LED is off then   */
+        LATB    &=  ~D5;
+    }
+    else
+    {
+        /* If comparator output is high, D5 LED is on then   */
+        LATB    |=  D5;
     }
 }
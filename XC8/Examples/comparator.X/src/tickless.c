@@ -0,0 +1,500 @@
+/**
+ * @brief       tickless.c
+ * @details     Tickless idle scheduler sources.
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero (aqueronteblog@gmail.com)
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+#include "../inc/tickless.h"
+
+
+/**@brief Variables.
+ */
+static tls_task_t*      myTasks;        /*!<   Task table                                              */
+static uint8_t          myCount;        /*!<   Number of tasks                                         */
+static volatile uint32_t myBase;        /*!<   Time base: tls_now() = myBase + TMR1 ( Timer1 )         */
+static uint32_t         myWakeups;      /*!<   Sleeps taken by tls_idle()                              */
+
+
+/**@brief Function prototypes.
+ */
+static uint8_t tls_next ( uint32_t now, uint32_t* interval );
+
+
+
+/**
+ * @brief       void tls_init ( tls_task_t* , uint8_t )
+ * @details     It initializes the scheduler, every task is stopped.
+ *
+ *              TLS_SOURCE_T1OSC, Timer1
+ *                  - Crystal oscillator on T1OSI/T1OSO pins = 32.768kHz, asynchronous, 1:1 Prescale
+ *                  - Stabilization for Timer1 external crystal is done ( 1/32s )
+ *                  - Free-running, Timer1 overflow interrupt enabled
+ *
+ *              TLS_SOURCE_WDT
+ *                  - WDT off until tls_idle()
+ *
+ *
+ * @param[in]    tasks:     Task table ( run set by the user ).
+ * @param[in]    count:     Number of tasks.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         TLS_SOURCE_T1OSC: Peripheral interrupts must be enabled ( PEIE ) to wake the uC up.
+ * @warning     TLS_SOURCE_T1OSC: It waits 1/32s at least, the crystal start-up.
+ */
+void tls_init ( tls_task_t* tasks, uint8_t count )
+{
+    uint8_t i   =   0U;
+
+    myTasks     =   tasks;
+    myCount     =   count;
+    myBase      =   0UL;
+    myWakeups   =   0UL;
+
+    for ( i = 0U; i < count; i++ )
+    {
+        tasks[i].active =   0U;
+    }
+
+#if ( TLS_SOURCE == TLS_SOURCE_T1OSC )
+    /* Stop Timer1 */
+    T1CONbits.TMR1ON    =   0U;
+
+    /* Crystal oscillator on T1OSI/T1OSO pins, 1:1 Prescale, asynchronous  */
+    T1CONbits.TMR1CS    =   0b10;
+    T1CONbits.T1OSCEN   =   1U;
+    T1CONbits.T1CKPS    =   0b00;
+    T1CONbits.nT1SYNC   =   1U;
+
+    /* Delay to ensure a safe start-up and stabilization ( 1/32s )     */
+    TMR1H   =   0xFCU;
+    TMR1L   =   0x00U;
+
+    PIE1bits.TMR1IE =   0U;
+    PIR1bits.TMR1IF =   0U;
+    T1CONbits.TMR1ON    =   1U;
+
+    while ( PIR1bits.TMR1IF ==   0U );
+
+    /* Timer1 keeps running from now on, it is the time base  */
+    PIR1bits.TMR1IF =   0U;
+    PIE1bits.TMR1IE =   1U;
+#else
+    /* WDT off  */
+    WDTCONbits.SWDTEN   =   0U;
+#endif
+}
+
+
+/**
+ * @brief       void tls_start ( tls_task_t* , uint32_t , uint32_t )
+ * @details     It starts a task, it is restarted if it is pending already.
+ *
+ *
+ * @param[in]    task:      Task.
+ * @param[in]    delay:     Counts to the first run, TLS_MS().
+ * @param[in]    period:    Counts between runs, 0: One-shot task.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         The delay and the period must be below 2^31 counts ( ~18h ).
+ * @warning     N/A
+ */
+void tls_start ( tls_task_t* task, uint32_t delay, uint32_t period )
+{
+    task->due       =   tls_now () + delay;
+    task->period    =   period;
+    task->active    =   1U;
+}
+
+
+/**
+ * @brief       void tls_stop ( tls_task_t* )
+ * @details     It stops a task.
+ *
+ *
+ * @param[in]    task:      Task.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+void tls_stop ( tls_task_t* task )
+{
+    task->active    =   0U;
+}
+
+
+/**
+ * @brief       uint32_t tls_now ( void )
+ * @details     It returns the time base in counts ( it wraps around every ~36h ).
+ *
+ *
+ * @param[in]    N/A.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      Time base
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     TLS_SOURCE_T1OSC: The time base is not kept while no task is pending.
+ */
+uint32_t tls_now ( void )
+{
+#if ( TLS_SOURCE == TLS_SOURCE_T1OSC )
+    uint8_t     gie =   INTCONbits.GIE;
+    uint8_t     h   =   0U;
+    uint8_t     l   =   0U;
+    uint32_t    now =   0UL;
+
+    INTCONbits.GIE  =   0U;
+
+    /* Asynchronous Timer1: TMR1H is read again in case TMR1L carried   */
+    do{
+        h   =   TMR1H;
+        l   =   TMR1L;
+    }while( h != TMR1H );
+
+    now =   myBase + ( ( (uint32_t)h << 8U ) | l );
+
+    /* Overflow not counted by tls_isr() yet   */
+    if ( ( PIR1bits.TMR1IF == 1U ) && ( h < 0x80U ) )
+    {
+        now +=  65536UL;
+    }
+
+    INTCONbits.GIE  =   gie;
+
+    return now;
+#else
+    return myBase;
+#endif
+}
+
+
+/**
+ * @brief       void tls_dispatch ( void )
+ * @details     It runs the tasks which are due. A periodic task is rescheduled from its deadline, so its
+ *              period does not drift, the runs which are missed are skipped.
+ *
+ *
+ * @param[in]    N/A.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         It must be called from the main loop.
+ * @warning     N/A
+ */
+void tls_dispatch ( void )
+{
+    uint8_t     i   =   0U;
+    uint32_t    now =   tls_now ();
+    tls_task_t* task;
+
+    for ( i = 0U; i < myCount; i++ )
+    {
+        task    =   &myTasks[i];
+
+        if ( ( task->active == 1U ) && ( (int32_t)( now - task->due ) >= 0L ) )
+        {
+            if ( task->period != 0UL )
+            {
+                task->due   +=  task->period;
+
+                if ( (int32_t)( now - task->due ) >= 0L )
+                {
+                    task->due   =   now + task->period;
+                }
+            }
+            else
+            {
+                task->active    =   0U;
+            }
+
+            task->run ();
+        }
+    }
+}
+
+
+/**
+ * @brief       void tls_idle ( void )
+ * @details     It programs the wake-up source for the nearest deadline and sleeps. Nothing is done if a task
+ *              is due already. With no task pending the uC sleeps until any other interrupt.
+ *
+ *              TLS_SOURCE_WDT: A remainder shorter than the shortest WDT period ( TLS_WDT_COUNTS( 0 ), ~1ms )
+ *              takes one shortest period, the deadline is rounded up to it. The main loop never spins on it.
+ *
+ *
+ * @param[in]    N/A.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    WDT: A remainder below the shortest period sleeps that period, no longer returns
+ *              18/October/2026    TMR1H worked out before the guard window ( TLS_T1_GUARD )
+ *              18/October/2026    The ORIGIN
+ * @pre         It must be called with the global interrupts disabled ( GIE = 0 ), once the pending work
+ *              is checked, so no interrupt is lost between the check and SLEEP. The interrupts are serviced
+ *              once GIE is set again.
+ * @warning     TLS_SOURCE_T1OSC: It may wait up to 1ms if TMR1L is about to carry.
+ *              TLS_SOURCE_WDT:   A wake-up by another interrupt ( nTO = 1 ) adds no time, the WDT count cannot
+ *                                be read. The deadlines are late by the time slept, one WDT period at most.
+ */
+void tls_idle ( void )
+{
+    uint32_t    now         =   tls_now ();
+    uint32_t    interval    =   0UL;
+    uint8_t     pending     =   tls_next ( now, &interval );
+#if ( TLS_SOURCE == TLS_SOURCE_T1OSC )
+    uint8_t     h           =   0U;
+    uint8_t     l           =   0U;
+    uint8_t     w           =   0U;
+    uint8_t     w_lo        =   0U;
+    uint8_t     w_hi        =   0U;
+    uint16_t    n           =   0U;
+    uint16_t    lim         =   0U;
+
+    if ( pending == 0U )
+    {
+        /* No task pending: Timer1 overflows do not wake the uC up  */
+        PIE1bits.TMR1IE =   0U;
+        SLEEP ();
+        NOP ();
+        myWakeups++;
+
+        /* The time base is not needed while no task is pending    */
+        PIR1bits.TMR1IF =   0U;
+        PIE1bits.TMR1IE =   1U;
+        return;
+    }
+
+    if ( interval == 0UL )
+    {
+        return;
+    }
+
+    /* Overflow after n*256 - TMR1L counts >= interval ( 2s max. ): n = ( interval + TMR1L + 255 )/256.
+       It is worked out before the guard window: TMR1H for n ( w_lo ) and n + 1 ( w_hi, TMR1L >= lim )   */
+    if ( interval > 65536UL )
+    {
+        interval    =   65536UL;
+    }
+
+    n   =   (uint16_t)( interval >> 8U );
+
+    if ( ( interval & 0xFFUL ) == 0UL )
+    {
+        lim =   1U;
+    }
+    else
+    {
+        n++;
+        lim =   (uint16_t)( 257UL - ( interval & 0xFFUL ) );
+    }
+
+    w_lo    =   (uint8_t)( 256U - n );
+    w_hi    =   ( n < 256U ) ? (uint8_t)( 255U - n ) : w_lo;
+
+    /* Do not write TMR1H if TMR1L is about to carry: Only the read and the write from here   */
+    while ( TMR1L >= TLS_T1_GUARD );
+
+    /* An overflow must be counted by tls_isr() first    */
+    if ( PIR1bits.TMR1IF == 1U )
+    {
+        return;
+    }
+
+    h       =   TMR1H;
+    l       =   TMR1L;
+    w       =   ( l >= lim ) ? w_hi : w_lo;
+    TMR1H   =   w;
+
+    /* TMR1L keeps counting, the time base is corrected by the counts skipped or added  */
+    myBase  +=  (uint32_t)( ( (int32_t)h - (int32_t)w ) * 256L );
+
+    SLEEP ();
+    NOP ();
+    myWakeups++;
+#else
+    uint8_t     ps          =   TLS_WDT_PS_MAX;
+
+    if ( pending == 0U )
+    {
+        /* No task pending: WDT off    */
+        WDTCONbits.SWDTEN   =   0U;
+        SLEEP ();
+        NOP ();
+        myWakeups++;
+        return;
+    }
+
+    if ( interval == 0UL )
+    {
+        return;
+    }
+
+    /* Longest WDT period within the interval. The shortest one if the interval is shorter: The time base
+       only advances on a WDT time-out, the deadline is rounded up to it   */
+    while ( ( ps > 0U ) && ( TLS_WDT_COUNTS( ps ) > interval ) )
+    {
+        ps--;
+    }
+
+    WDTCONbits.WDTPS    =   ps;
+    CLRWDT ();
+    WDTCONbits.SWDTEN   =   1U;
+    SLEEP ();
+    NOP ();
+    WDTCONbits.SWDTEN   =   0U;
+    myWakeups++;
+
+    /* WDT time-out wake-up: The whole period elapsed. Another interrupt: Unknown, nothing is added */
+    if ( STATUSbits.nTO == 0U )
+    {
+        myBase  +=  TLS_WDT_COUNTS( ps );
+    }
+#endif
+}
+
+
+/**
+ * @brief       uint32_t tls_wakeups ( void )
+ * @details     It returns the number of sleeps taken by tls_idle() since tls_init().
+ *
+ *
+ * @param[in]    N/A.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      Number of wake-ups
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+uint32_t tls_wakeups ( void )
+{
+    return myWakeups;
+}
+
+
+/**
+ * @brief       void tls_isr ( void )
+ * @details     Timer1 interrupt handler. It must be called from ISR() when TMR1IE and TMR1IF are set,
+ *              once TMR1IF is cleared ( TLS_SOURCE_T1OSC ).
+ *
+ *
+ * @param[in]    N/A.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+void tls_isr ( void )
+{
+#if ( TLS_SOURCE == TLS_SOURCE_T1OSC )
+    myBase  +=  65536UL;
+#endif
+}
+
+
+
+/**
+ * @brief       uint8_t tls_next ( uint32_t , uint32_t* )
+ * @details     It finds the nearest deadline.
+ *
+ *
+ * @param[in]    now:       Time base.
+ *
+ * @param[out]   interval:  Counts to the nearest deadline, 0 if a task is due.
+ *
+ *
+ * @return      1: A task is pending, 0: No task pending
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+static uint8_t tls_next ( uint32_t now, uint32_t* interval )
+{
+    uint8_t i       =   0U;
+    uint8_t pending =   0U;
+    int32_t left    =   0L;
+
+    *interval   =   0UL;
+
+    for ( i = 0U; i < myCount; i++ )
+    {
+        if ( myTasks[i].active == 1U )
+        {
+            left    =   (int32_t)( myTasks[i].due - now );
+
+            if ( left <= 0L )
+            {
+                *interval   =   0UL;
+                return 1U;
+            }
+
+            if ( ( pending == 0U ) || ( (uint32_t)left < *interval ) )
+            {
+                *interval   =   (uint32_t)left;
+            }
+
+            pending =   1U;
+        }
+    }
+
+    return pending;
+}
@@ -6,7 +6,8 @@
  *
  * @author      Manuel Caballero (aqueronteblog@gmail.com)
  * @date        09/February/2024
- * @version     09/February/2024    The ORIGIN
+ * @version     18/October/2026     EUSART_F_OSC and EUSART_BAUDRATE for baud_calc.h
+ *              09/February/2024    The ORIGIN
  * @pre         N/A
  * @warning     N/A
  */
@@ -14,6 +15,7 @@
 #define FUNCTIONS_H_
 
 #include "board.h"
+#include "baud_calc.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -29,6 +31,8 @@ void conf_eusart    ( void );
 
 /**@brief Constants.
  */
+#define EUSART_F_OSC        16000000UL      /*!<   F_OSC set by conf_clk()    */
+#define EUSART_BAUDRATE     115200UL        /*!<   EUSART baud rate           */
 
 
 
@@ -14,6 +14,7 @@
 #define INTERRUPTS_H_
 
 #include "board.h"
+#include "eusart.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -33,7 +34,6 @@ void __interrupt() ISR ( void );
 /**@brief Variables.
  */
 extern volatile uint8_t myState;
-extern volatile uint8_t *myPtr;
 
 
 #ifdef __cplusplus
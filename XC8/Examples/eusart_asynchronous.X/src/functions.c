@@ -113,15 +113,19 @@ void conf_gpio ( void )
 }
 
 
+/**@brief EUSART baud rate settings ( baud_calc.h ): myBaud_BRG16, myBaud_BRGH, myBaud_SPBRGH, myBaud_SPBRGL.
+ */
+BAUD_CALC_EUSART_DEFINE( myBaud, EUSART_F_OSC, EUSART_BAUDRATE );
+
+
 /**
  * @brief       void conf_eusart ( void )
- * @details     It configures the EUSART in 16-bit asynchronous mode.
+ * @details     It configures the EUSART in asynchronous mode.
  *              
- *              Desire_baudrate = F_OSC/[4(SPBRG+1)]
+ *              Desire_baudrate = F_OSC/[m(SPBRG+1)], m = 4, 16 or 64 ( BRG16, BRGH )
  * 
  *              EUSART
- *                  - 16-bit asynchronous mode
- *                  - SPBRG = ( F_OSC/(4Desire_baudrate) ) - 1 = ( 16000000/(4115200) ) - 1 ~ 34 (0x0022)
+ *                  - BRG16, BRGH and SPBRG: Lowest error for EUSART_BAUDRATE at EUSART_F_OSC ( baud_calc.h )
  *                  - 8-bit reception/transmission
  *                  - Auto-Baud detect disabled
  *                  - Receiver interrupt enabled
@@ -136,8 +140,9 @@ void conf_gpio ( void )
  *
  * @author      Manuel Caballero
  * @date        10/February/2024
- * @version     10/February/2024    The ORIGIN
- * @pre         Error = 100*( 115200 - 114285.714 )/115200 = 0.79%
+ * @version     18/October/2026     BRG16, BRGH and SPBRG worked out by baud_calc.h
+ *              10/February/2024    The ORIGIN
+ * @pre         The build fails if the error ( myBaud_ERROR, 0.01% ) is above BAUD_CALC_ERR_MAX.
  * @warning     N/A
  */
 void conf_eusart ( void )
@@ -160,21 +165,21 @@ void conf_eusart ( void )
     /* EUSART: Asynchronous mode    */
     TXSTAbits.SYNC   =   0U;
     
-    /* EUSART: High speed    */
-    TXSTAbits.BRGH   =   1U;
+    /* EUSART: High speed or not ( baud_calc.h )    */
+    TXSTAbits.BRGH   =   myBaud_BRGH;
     
     /* Transmit non-inverted data to the TX/CK pin  */
     BAUDCONbits.SCKP    =   0U;
     
-    /* 16-bit Baud Rate Generator is used    */
-    BAUDCONbits.BRG16   =   1U;
+    /* 16-bit or 8-bit Baud Rate Generator ( baud_calc.h )    */
+    BAUDCONbits.BRG16   =   myBaud_BRG16;
     
     /* Auto-Baud Detect mode is disabled    */
     BAUDCONbits.ABDEN   =   0U;
     
     /* Baudrate value   */
-    SPBRGH  =   0x00;
-    SPBRGL  =   0x22;
+    SPBRGH  =   myBaud_SPBRGH;
+    SPBRGL  =   myBaud_SPBRGL;
     
     /* Clear receiver (Rx) and transmission (Tx) interrupt flags   */
     PIR1bits.RCIF   =   0U;
@@ -22,7 +22,8 @@
  *
  * @author      Manuel Caballero
  * @date        09/February/2024
- * @version     09/February/2024   The ORIGIN
+ * @version     18/October/2026    Tx is driven by the EUSART ring buffer driver
+ *              09/February/2024   The ORIGIN
  * @pre         N/A.
  * @warning     N/A
  */
@@ -47,25 +48,9 @@ void __interrupt() ISR ( void )
 	}
 
 	/* Tx	 */
-	if ( ( PIE1bits.TXIE == 1U ) && ( TXSTAbits.TXEN == 1UL ) )
-	{        
-        /* Wait until Transmit Shift Register Status is empty  */
-        while ( TXSTAbits.TRMT ==  0U );
-        
-		/* Stop transmitting data when that character is found */
-		if ( *myPtr  == '\n' )
-		{            
-            /* Disable transmission and enable reception again    */
-			TXSTAbits.TXEN  =   0UL;
-            RCSTAbits.CREN  =   1U;
-		}
-		else
-		{
-			TXREG	 =	 *myPtr;
-            myPtr++;
-		}
-        
-        /* Clear Tx Interrupt flag  */
-        PIR1bits.TXIF = 0U; 
+	if ( ( PIE1bits.TXIE == 1U ) && ( PIR1bits.TXIF == 1U ) )
+	{
+        /* Load the next byte from the Tx ring buffer ( no waiting on TRMT )    */
+        eusart_tx_isr ();
 	}
 }
\ No newline at end of file
@@ -14,7 +14,8 @@
  *
  * @author      Manuel Caballero (aqueronteblog@gmail.com)
  * @date        10/February/2024
- * @version     10/February/2024    The ORIGIN
+ * @version     18/October/2026     Transmission through the EUSART Tx ring buffer driver
+ *              10/February/2024    The ORIGIN
  * @pre         This project was tested on a PIC16F1937 using a PICDEM 2 Plus.
  * @pre         In asynchronous mode, the SLEEP mode cannot be used due to EUSART clock source (F_OSC).
  * @warning     N/A
@@ -55,6 +56,7 @@
 #include "../inc/board.h"
 #include "../inc/functions.h"
 #include "../inc/interrupts.h"
+#include "../inc/eusart.h"
 
 /**@brief Constants.
  */
@@ -64,16 +66,17 @@
 /**@brief Variables.
  */
 volatile uint8_t    myState;    /* State that indicates when to perform the next action */
-volatile uint8_t    *myPtr;     /* Pointer to point out myMessage   */
 
 /**@brief Function for application main entry.
  */
 void main(void) {
     uint8_t my_message[EUSART_BUFF] = {0};
+    uint8_t my_length   =   0U;
     
-    conf_clk    ();
-    conf_gpio   ();
-    conf_eusart ();
+    conf_clk        ();
+    conf_gpio       ();
+    conf_eusart     ();
+    eusart_tx_init  ();
     
     /* Initiate variable  */
     my_message[0]   =   'L';
@@ -86,7 +89,6 @@ void main(void) {
     my_message[7]   =   '0';
     my_message[8]   =   'F';
     my_message[9]   =   'F';
-    my_message[10]  =   '\n';
     
     /* Enable interrupts    */
     INTCONbits.PEIE =   1U; // Enables all active peripheral interrupts
@@ -110,7 +112,7 @@ void main(void) {
 					/* Turn D5 on	 */
 					LATB    |=  D5;
 					my_message[8]   =   'N';
-                    my_message[9]  =   '\n';
+                    my_length       =   9U;
 					break;
 
 				case '2':
@@ -118,7 +120,7 @@ void main(void) {
 					LATB    &=  ~D5;
 					my_message[8]   =   'F';
                     my_message[9]   =   'F';
-                    my_message[10]  =   '\n';
+                    my_length       =   10U;
 					break;
 
 				default:
@@ -132,22 +134,15 @@ void main(void) {
 					my_message[ 10 ]  =  'O';
 					my_message[ 11 ]  =  'R';
 					my_message[ 12 ]  =  '!';
-                    my_message[ 13 ]  =  '\n';
+                    my_length         =  13U;
 					break;
 			}
             
-            /* Transmit data back	 */
-			myPtr    =   &my_message[0];
-            
             /* Reset variables	 */
 			myState	 =	 0U;
             
-            /* Enables the USART transmit interrupt	 */
-			PIE1bits.TXIE = 1UL;
-            
-            /* Disables receiver and enable transmission    */
-            RCSTAbits.CREN  =   0U;
-            TXSTAbits.TXEN  =   1UL;
+            /* Transmit data back. The message is copied into the Tx ring buffer, the ISR sends it	 */
+            (void)eusart_write ( &my_message[0], my_length );
         }
         else
         {
@@ -0,0 +1,74 @@
+/**
+ * @brief       eusart.h
+ * @details     EUSART driver header. Interrupt-driven transmission through a ring buffer
+ *              and through pointer+length descriptors.
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero (aqueronteblog@gmail.com)
+ * @date        18/October/2026
+ * @version     18/October/2026    Tx descriptors were added
+ *              18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+#ifndef EUSART_H_
+#define EUSART_H_
+
+#include "board.h"
+#include <string.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**@brief Constants.
+ */
+#ifndef EUSART_TX_BUFF_SIZE
+#define EUSART_TX_BUFF_SIZE     64U                             /*!<   Tx ring buffer size, it must be a power of two ( max. 128 )    */
+#endif
+
+#define EUSART_TX_BUFF_MASK     ( EUSART_TX_BUFF_SIZE - 1U )    /*!<   Tx ring buffer index mask    */
+
+#if ( ( EUSART_TX_BUFF_SIZE & EUSART_TX_BUFF_MASK ) != 0U ) || ( EUSART_TX_BUFF_SIZE > 128U )
+#error "EUSART_TX_BUFF_SIZE must be a power of two and not bigger than 128"
+#endif
+
+
+/**@brief Tx completion callback. It is called from the ISR.
+ */
+typedef void ( *eusart_tx_done_t ) ( void );
+
+
+/**@brief Tx descriptor.
+ */
+typedef struct{
+  const uint8_t*    data;           /*!<   Data to be transmitted ( not copied )                      */
+  uint8_t           length;         /*!<   How many bytes to be transmitted                           */
+  eusart_tx_done_t  done;           /*!<   Completion callback ( optional, NULL if not used )         */
+  volatile uint8_t  completed;      /*!<   Completion flag: 0 = in progress, 1 = data can be reused   */
+} eusart_tx_desc_t;
+
+
+/**@brief Function prototypes.
+ */
+void    eusart_tx_init      ( void );
+uint8_t eusart_write        ( const uint8_t* data, uint8_t length );
+uint8_t eusart_write_string ( const char* str );
+uint8_t eusart_send         ( eusart_tx_desc_t* desc );
+uint8_t eusart_tx_free  ( void );
+uint8_t eusart_tx_busy  ( void );
+void    eusart_tx_isr   ( void );
+
+
+/**@brief Variables.
+ */
+
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* EUSART_H_ */
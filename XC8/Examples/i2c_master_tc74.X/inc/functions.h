@@ -6,7 +6,8 @@
  *
  * @author      Manuel Caballero (aqueronteblog@gmail.com)
  * @date        17/February/2024
- * @version     17/February/2024    The ORIGIN
+ * @version     18/October/2026     EUSART_F_OSC and EUSART_BAUDRATE for baud_calc.h
+ *              17/February/2024    The ORIGIN
  * @pre         N/A
  * @warning     N/A
  */
@@ -14,6 +15,8 @@
 #define FUNCTIONS_H_
 
 #include "board.h"
+#include "baud_calc.h"
+#include "i2c_master.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -27,10 +30,13 @@ void conf_GPIO          ( void );
 void conf_ioc           ( void );
 void conf_eusart        ( void );
 void conf_master_i2c    ( void );
+void conf_WDT           ( void );
 
 
 /**@brief Constants.
  */
+#define EUSART_F_OSC        16000000UL      /*!<   F_OSC set by conf_CLK()    */
+#define EUSART_BAUDRATE     115200UL        /*!<   EUSART baud rate           */
 
 
 
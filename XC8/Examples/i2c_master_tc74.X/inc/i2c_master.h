@@ -0,0 +1,135 @@
+/**
+ * @brief       i2c_master.h
+ * @details     Interrupt-driven I2C master ( MSSP ) driver header.
+ *
+ *              SCL_F_CLOCK = F_OSC / ( 4*( SSPxADD + 1 ) )
+ *
+ *              SSPxADD is rounded up, so the bus never runs faster than requested. The slew rate
+ *              control is enabled for Fast-mode ( 100kHz < SCL_F_CLOCK <= 400kHz ) and disabled for
+ *              Standard mode and Fast-mode Plus ( 1MHz ).
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero (aqueronteblog@gmail.com)
+ * @date        18/October/2026
+ * @version     18/October/2026    Bus speed: 100kHz, 400kHz and 1MHz
+ *              18/October/2026    Completion callback
+ *              18/October/2026    Per-phase errors and millisecond timeouts
+ *              18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+#ifndef I2C_MASTER_H_
+#define I2C_MASTER_H_
+
+#include "board.h"
+#include "tick.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**@brief Constants.
+ */
+#ifndef I2C_MASTER_F_OSC
+#define I2C_MASTER_F_OSC                TICK_F_OSC  /*!<   F_OSC set by conf_CLK()    */
+#endif
+
+#ifndef I2C_MASTER_F_SCL
+#define I2C_MASTER_F_SCL                100000UL    /*!<   Bus speed set by conf_master_i2c()    */
+#endif
+
+#define I2C_MASTER_F_SCL_STANDARD       100000UL    /*!<   Standard mode          */
+#define I2C_MASTER_F_SCL_FAST           400000UL    /*!<   Fast-mode              */
+#define I2C_MASTER_F_SCL_FAST_PLUS      1000000UL   /*!<   Fast-mode Plus         */
+
+#define I2C_MASTER_SSPADD_MIN           3UL         /*!<   SSPxADD 0x00 to 0x02 are not supported in master mode    */
+#define I2C_MASTER_SSPADD_MAX           255UL       /*!<   8-bit baud rate generator                                 */
+
+/**@brief SSPxADD for a given F_OSC and bus speed, rounded up ( it can be used in #if ).
+ */
+#define I2C_MASTER_SSPADD( f_osc, f_scl )   ( ( ( (f_osc) + ( 4UL * (f_scl) ) - 1UL ) / ( 4UL * (f_scl) ) ) - 1UL )
+
+/**@brief SSPSTAT.SMP for a given bus speed. 0: Slew rate control enabled ( Fast-mode only ), 1: Disabled.
+ */
+#define I2C_MASTER_SMP( f_scl )             ( ( ( (f_scl) > I2C_MASTER_F_SCL_STANDARD ) && ( (f_scl) <= I2C_MASTER_F_SCL_FAST ) ) ? 0U : 1U )
+
+#if ( I2C_MASTER_F_SCL > I2C_MASTER_F_SCL_FAST_PLUS )
+#error "I2C_MASTER_F_SCL is above Fast-mode Plus ( 1MHz )"
+#endif
+
+#if ( I2C_MASTER_SSPADD( I2C_MASTER_F_OSC, I2C_MASTER_F_SCL ) < I2C_MASTER_SSPADD_MIN ) || ( I2C_MASTER_SSPADD( I2C_MASTER_F_OSC, I2C_MASTER_F_SCL ) > I2C_MASTER_SSPADD_MAX )
+#error "I2C_MASTER_F_SCL cannot be reached at I2C_MASTER_F_OSC"
+#endif
+
+#ifndef I2C_MASTER_PHASE_TIMEOUT_MS
+#define I2C_MASTER_PHASE_TIMEOUT_MS     10U     /*!<   Maximum time for a single phase ( START, byte, ACK, STOP )    */
+#endif
+
+
+/**@brief Transaction status.
+ */
+typedef enum{
+  I2C_MASTER_SUCCESS              = 0U,     /*!<   Transaction completed                                */
+  I2C_MASTER_BUSY                 = 1U,     /*!<   Transaction in progress / bus is busy                */
+  I2C_MASTER_ERROR_START          = 2U,     /*!<   (Repeated) START condition was not completed         */
+  I2C_MASTER_ERROR_ADDRESS_NACK   = 3U,     /*!<   Slave did not acknowledge its address                */
+  I2C_MASTER_ERROR_DATA_NACK      = 4U,     /*!<   Slave did not acknowledge a data byte                */
+  I2C_MASTER_ERROR_STOP           = 5U,     /*!<   STOP condition was not completed                     */
+  I2C_MASTER_ERROR_TIMEOUT        = 6U,     /*!<   Data/ACK phase was not completed ( SCL held low )    */
+  I2C_MASTER_ERROR_COLLISION      = 7U,     /*!<   Bus collision                                        */
+  I2C_MASTER_ERROR_ABORTED        = 8U,     /*!<   Transaction aborted by the user                      */
+  I2C_MASTER_ERROR_SPEED          = 9U      /*!<   Bus speed cannot be reached at this F_OSC            */
+} i2c_master_status_t;
+
+
+/**@brief STOP condition generation.
+ */
+typedef enum{
+  I2C_MASTER_NO_STOP  = 0U,     /*!<   Keep the bus, next transaction starts with a repeated START  */
+  I2C_MASTER_STOP     = 1U      /*!<   Generate a STOP condition at the end                         */
+} i2c_master_stop_t;
+
+
+/**@brief Completion callback. It is called from the interrupt context, the transaction status is already set.
+ */
+typedef void ( *i2c_master_done_t ) ( void );
+
+
+/**@brief Transaction. tx_length bytes are written, then rx_length bytes are read after a repeated START.
+ */
+typedef struct{
+  uint8_t                       address;        /*!<   7-bit slave address                 */
+  const uint8_t*                tx_buff;        /*!<   Data to be written                  */
+  uint8_t                       tx_length;      /*!<   How many bytes to be written        */
+  uint8_t*                      rx_buff;        /*!<   Data read                           */
+  uint8_t                       rx_length;      /*!<   How many bytes to be read           */
+  i2c_master_stop_t             stop;           /*!<   STOP condition at the end           */
+  i2c_master_done_t             done;           /*!<   Completion callback ( optional, NULL if not used )  */
+  volatile i2c_master_status_t  status;         /*!<   Transaction status                  */
+} i2c_master_xfer_t;
+
+
+/**@brief Function prototypes.
+ */
+void                i2c_master_init         ( void );
+i2c_master_status_t i2c_master_set_speed    ( uint32_t f_osc, uint32_t f_scl );
+i2c_master_status_t i2c_master_submit       ( i2c_master_xfer_t* xfer );
+uint8_t             i2c_master_busy         ( void );
+void                i2c_master_abort        ( void );
+void                i2c_master_poll         ( void );
+void                i2c_master_isr          ( void );
+void                i2c_master_bcl_isr      ( void );
+
+
+/**@brief Variables.
+ */
+
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* I2C_MASTER_H_ */
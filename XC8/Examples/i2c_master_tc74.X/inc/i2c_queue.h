@@ -0,0 +1,67 @@
+/**
+ * @brief       i2c_queue.h
+ * @details     I2C job queue header.
+ *
+ *              Several drivers enqueue write-then-read jobs for any slave on the bus. The jobs are
+ *              run back-to-back by the MSSP interrupt: every job but the last keeps the bus, so the
+ *              next one starts with a repeated START and only one STOP is generated per batch.
+ *
+ *              The jobs are kept in a static pool ( I2C_QUEUE_SIZE ), no heap is used.
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero (aqueronteblog@gmail.com)
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+#ifndef I2C_QUEUE_H_
+#define I2C_QUEUE_H_
+
+#include "board.h"
+#include "i2c_master.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**@brief Constants.
+ */
+#ifndef I2C_QUEUE_SIZE
+#define I2C_QUEUE_SIZE      8U                      /*!<   Jobs in the pool, it must be a power of 2 ( max. 128 )    */
+#endif
+
+#define I2C_QUEUE_MASK      ( I2C_QUEUE_SIZE - 1U ) /*!<   Pool index mask     */
+
+#if ( ( I2C_QUEUE_SIZE & I2C_QUEUE_MASK ) != 0U ) || ( I2C_QUEUE_SIZE > 128U )
+#error "I2C_QUEUE_SIZE must be a power of 2 ( max. 128 )"
+#endif
+
+
+/**@brief Job completion callback. It is called from the interrupt context with the job status and the
+ *        context given at submission.
+ */
+typedef void ( *i2c_queue_done_t ) ( i2c_master_status_t status, void* context );
+
+
+/**@brief Function prototypes.
+ */
+void                i2c_queue_init      ( void );
+i2c_master_status_t i2c_queue_submit    ( uint8_t address, const uint8_t* tx_buff, uint8_t tx_length, uint8_t* rx_buff, uint8_t rx_length, i2c_queue_done_t done, void* context );
+i2c_master_status_t i2c_queue_run       ( void );
+uint8_t             i2c_queue_busy      ( void );
+uint8_t             i2c_queue_free      ( void );
+
+
+/**@brief Variables.
+ */
+
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* I2C_QUEUE_H_ */
@@ -14,6 +14,9 @@
 #define INTERRUPTS_H_
 
 #include "board.h"
+#include "eusart.h"
+#include "i2c_master.h"
+#include "tick.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -33,7 +36,6 @@ void __interrupt() ISR ( void );
 /**@brief Variables.
  */
 extern volatile uint8_t myState;
-extern volatile uint8_t *myPtr;
 
 
 #ifdef __cplusplus
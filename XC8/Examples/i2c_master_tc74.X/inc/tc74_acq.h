@@ -0,0 +1,108 @@
+/**
+ * @brief       tc74_acq.h
+ * @details     TC74 acquisition state machine header.
+ *
+ *              A reading is split in three steps:
+ *                  1. tc74_acq_start(): The TC74 leaves standby.
+ *                  2. The uC sleeps for TC74_ACQ_WAIT_MS ( WDT wake-up ) while the TC74 converts.
+ *                  3. tc74_acq_run(): The configuration and the temperature are read in one I2C batch
+ *                     ( repeated START ), then the TC74 goes back to standby.
+ *
+ *              Step 2 and 3 are repeated if the data is not ready yet ( up to TC74_ACQ_MAX_POLLS ).
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero (aqueronteblog@gmail.com)
+ * @date        18/October/2026
+ * @version     18/October/2026    tc74_acq_get_error(): Cause of TC74_ACQ_ERROR
+ *              18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+#ifndef TC74_ACQ_H_
+#define TC74_ACQ_H_
+
+#include "board.h"
+#include "i2c_master.h"
+#include "i2c_queue.h"
+#include "../../../../../Drivers/TC74/inc/TC74.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**@brief Constants.
+ */
+#define TC74_ACQ_CMD_RTR        0x00U       /*!<   TC74 command: Read temperature               */
+#define TC74_ACQ_CMD_RWCR       0x01U       /*!<   TC74 command: Read/Write configuration       */
+#define TC74_ACQ_DATA_RDY_MSK   0x40U       /*!<   Configuration register: DATA_RDY bit mask    */
+
+#ifndef TC74_ACQ_WAIT_MS
+#define TC74_ACQ_WAIT_MS        256U        /*!<   Sleep time per poll, WDT 1:8192 ( TC74 conversion: 125ms typ., 250ms max. )    */
+#endif
+
+#ifndef TC74_ACQ_MAX_POLLS
+#define TC74_ACQ_MAX_POLLS      4U          /*!<   Data-ready checks before the reading fails    */
+#endif
+
+#define TC74_ACQ_READ_BITS      39U         /*!<   Bus bits: START, addr+W, cmd, Sr, addr+R, data ( 4x9 bits ), STOP    */
+#define TC74_ACQ_WRITE_BITS     29U         /*!<   Bus bits: START, addr+W, cmd, data ( 3x9 bits ), STOP                */
+
+/**@brief Bus time in us for a given number of bits at I2C_MASTER_F_SCL.
+ */
+#define TC74_ACQ_BUS_US( bits ) ( (uint32_t)( ( (uint32_t)(bits) * 1000000UL ) / I2C_MASTER_F_SCL ) )
+
+
+/**@brief Acquisition state.
+ */
+typedef enum{
+  TC74_ACQ_IDLE         = 0U,     /*!<   No reading in progress                                  */
+  TC74_ACQ_CONVERTING   = 1U,     /*!<   TC74 is converting, the uC must sleep TC74_ACQ_WAIT_MS  */
+  TC74_ACQ_DONE         = 2U,     /*!<   Temperature is ready                                    */
+  TC74_ACQ_ERROR        = 3U      /*!<   I2C error or data never ready                           */
+} tc74_acq_state_t;
+
+
+/**@brief Cause of TC74_ACQ_ERROR ( the first one of the reading ).
+ */
+typedef enum{
+  TC74_ACQ_ERR_NONE         = 0U,     /*!<   No error                                                         */
+  TC74_ACQ_ERR_START        = 1U,     /*!<   TC74 did not leave standby ( TC74_SetConfig(), blocking I2C )     */
+  TC74_ACQ_ERR_READ         = 2U,     /*!<   Configuration + temperature I2C batch failed                     */
+  TC74_ACQ_ERR_NOT_READY    = 3U,     /*!<   DATA_RDY still 0 after TC74_ACQ_MAX_POLLS checks ( timeout )      */
+  TC74_ACQ_ERR_STANDBY      = 4U      /*!<   TC74 did not go back to standby ( TC74_SetConfig(), blocking I2C )  */
+} tc74_acq_error_t;
+
+
+/**@brief Statistics of the last reading.
+ */
+typedef struct{
+  uint8_t   polls;              /*!<   Data-ready checks                                                   */
+  uint16_t  bus_us;             /*!<   I2C bus time used                                                   */
+  uint16_t  saved_polls;        /*!<   Data-ready checks avoided against a GetConfig spin loop ( estimated )  */
+  uint32_t  saved_bus_us;       /*!<   I2C bus time avoided against a GetConfig spin loop ( estimated )    */
+} tc74_acq_stats_t;
+
+
+/**@brief Function prototypes.
+ */
+void                tc74_acq_init               ( TC74_i2c_comm_t* comm );
+tc74_acq_state_t    tc74_acq_start              ( void );
+tc74_acq_state_t    tc74_acq_run                ( void );
+tc74_acq_state_t    tc74_acq_get_state          ( void );
+int8_t              tc74_acq_get_temperature    ( void );
+void                tc74_acq_get_stats          ( tc74_acq_stats_t* stats );
+tc74_acq_error_t    tc74_acq_get_error          ( i2c_master_status_t* status );
+
+
+/**@brief Variables.
+ */
+
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TC74_ACQ_H_ */
@@ -0,0 +1,79 @@
+/**
+ * @brief       tick.h
+ * @details     Monotonic millisecond tick ( Timer2 ) header.
+ *
+ *              TMR2_flag ( TMR2 = PR2 ) = ( 1/( F_OSC/4 ) )*Prescaler*( PR2 + 1 )
+ *
+ *              The prescaler and PR2 are computed at compile time from TICK_F_OSC and TICK_PERIOD_MS.
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero (aqueronteblog@gmail.com)
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     Timer2 is clocked by F_OSC, the tick does not run in SLEEP mode.
+ */
+#ifndef TICK_H_
+#define TICK_H_
+
+#include "board.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**@brief Constants.
+ */
+#ifndef TICK_F_OSC
+#define TICK_F_OSC      16000000UL      /*!<   F_OSC set by conf_CLK()    */
+#endif
+
+#ifndef TICK_PERIOD_MS
+#define TICK_PERIOD_MS  1U              /*!<   Tick period. Use 10ms or more at low F_OSC ( e.g. 125kHz ) to keep the ISR load low    */
+#endif
+
+#define TICK_COUNTS     ( ( TICK_F_OSC * TICK_PERIOD_MS ) / 4000UL )   /*!<   Instruction cycles per tick    */
+
+#if   ( TICK_COUNTS <= 256UL )
+#define TICK_T2CKPS     0b00            /*!<   Prescaler 1     */
+#define TICK_PR2        ( TICK_COUNTS - 1UL )
+#elif ( TICK_COUNTS <= ( 4UL * 256UL ) )
+#define TICK_T2CKPS     0b01            /*!<   Prescaler 4     */
+#define TICK_PR2        ( ( TICK_COUNTS / 4UL ) - 1UL )
+#elif ( TICK_COUNTS <= ( 16UL * 256UL ) )
+#define TICK_T2CKPS     0b10            /*!<   Prescaler 16    */
+#define TICK_PR2        ( ( TICK_COUNTS / 16UL ) - 1UL )
+#elif ( TICK_COUNTS <= ( 64UL * 256UL ) )
+#define TICK_T2CKPS     0b11            /*!<   Prescaler 64    */
+#define TICK_PR2        ( ( TICK_COUNTS / 64UL ) - 1UL )
+#else
+#error "TICK_PERIOD_MS cannot be reached by Timer2 at TICK_F_OSC"
+#endif
+
+#if ( TICK_COUNTS == 0UL )
+#error "TICK_PERIOD_MS is too short for TICK_F_OSC"
+#endif
+
+
+/**@brief Function prototypes.
+ */
+void     tick_init          ( void );
+void     tick_start         ( void );
+void     tick_stop          ( void );
+uint16_t tick_get_ms        ( void );
+uint16_t tick_elapsed_ms    ( uint16_t start );
+void     tick_isr           ( void );
+
+
+/**@brief Variables.
+ */
+
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TICK_H_ */
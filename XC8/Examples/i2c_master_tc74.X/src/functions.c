@@ -149,9 +149,12 @@ void conf_ioc ( void )
  *              
  *              I2C
  *                  - Master mode.
- *                  - Polling mode (interrupts disabled)
- *                  - SCL_F_CLOCK = 100kHz. SSPxADD = ( F_OSC / ( 4*SCL_F_CLOCK ) ) - 1 = ( 16MHz / ( 4*100kHz ) ) - 1 = 39
- *                  - F_OSC = 16MHz
+ *                  - Interrupt mode, SSPIF/BCLIF are enabled by i2c_master_init()
+ *                  - SCL_F_CLOCK = I2C_MASTER_F_SCL ( 100kHz ). SSPxADD = ( F_OSC / ( 4*SCL_F_CLOCK ) ) - 1 = ( 16MHz / ( 4*100kHz ) ) - 1 = 39
+ *                  - F_OSC = I2C_MASTER_F_OSC ( 16MHz )
+ *                  - Slew rate control enabled for 400kHz only
+ *
+ *              SSPxADD is computed at compile time, i2c_master_set_speed() changes it at runtime.
  * 
  * @param[in]    N/A.
  *
@@ -162,7 +165,9 @@ void conf_ioc ( void )
  *
  * @author      Manuel Caballero
  * @date        17/February/2024
- * @version     17/February/2024    The ORIGIN
+ * @version     18/October/2026     SSPxADD and slew rate computed from I2C_MASTER_F_SCL
+ *              18/October/2026     I2C master driven by interrupts
+ *              17/February/2024    The ORIGIN
  * @pre         N/A
  * @warning     N/A
  */
@@ -181,23 +186,30 @@ void conf_master_i2c ( void )
     /*  Minimum of 100 ns hold time on SDA after the falling edge of SCL   */
     SSPCON3bits.SDAHT    =   0U;
     
-    /*  SCL pin clock = 100kHz   */
-    SSPADD    =   39U; 
+    /*  SCL pin clock = I2C_MASTER_F_SCL   */
+    SSPADD    =   (uint8_t)I2C_MASTER_SSPADD( I2C_MASTER_F_OSC, I2C_MASTER_F_SCL );
+    
+    /*  Slew rate control  */
+    SSPSTATbits.SMP =   I2C_MASTER_SMP( I2C_MASTER_F_SCL );
     
     /* Enable the serial port and configures the SDA and SCL pins */
     SSPCON1bits.SSPEN    =   1U;
 }
 
 
+/**@brief EUSART baud rate settings ( baud_calc.h ): myBaud_BRG16, myBaud_BRGH, myBaud_SPBRGH, myBaud_SPBRGL.
+ */
+BAUD_CALC_EUSART_DEFINE( myBaud, EUSART_F_OSC, EUSART_BAUDRATE );
+
+
 /**
  * @brief       void conf_eusart ( void )
- * @details     It configures the EUSART in 16-bit asynchronous mode.
+ * @details     It configures the EUSART in asynchronous mode.
  *              
- *              Desire_baudrate = F_OSC/[4(SPBRG+1)]
+ *              Desire_baudrate = F_OSC/[m(SPBRG+1)], m = 4, 16 or 64 ( BRG16, BRGH )
  * 
  *              EUSART
- *                  - 16-bit asynchronous mode
- *                  - SPBRG = ( F_OSC/(4Desire_baudrate) ) - 1 = ( 16000000/(4115200) ) - 1 ~ 34 (0x0022)
+ *                  - BRG16, BRGH and SPBRG: Lowest error for EUSART_BAUDRATE at EUSART_F_OSC ( baud_calc.h )
  *                  - 8-bit reception/transmission
  *                  - Auto-Baud detect disabled
  *                  - Receiver interrupt disabled
@@ -212,8 +224,9 @@ void conf_master_i2c ( void )
  *
  * @author      Manuel Caballero
  * @date        28/February/2024
- * @version     28/February/2024    The ORIGIN
- * @pre         Error = 100*( 115200 - 114285.714 )/115200 = 0.79%
+ * @version     18/October/2026     BRG16, BRGH and SPBRG worked out by baud_calc.h
+ *              28/February/2024    The ORIGIN
+ * @pre         The build fails if the error ( myBaud_ERROR, 0.01% ) is above BAUD_CALC_ERR_MAX.
  * @warning     N/A
  */
 void conf_eusart ( void )
@@ -236,21 +249,21 @@ void conf_eusart ( void )
     /* EUSART: Asynchronous mode    */
     TXSTAbits.SYNC   =   0U;
     
-    /* EUSART: High speed    */
-    TXSTAbits.BRGH   =   1U;
+    /* EUSART: High speed or not ( baud_calc.h )    */
+    TXSTAbits.BRGH   =   myBaud_BRGH;
     
     /* Transmit non-inverted data to the TX/CK pin  */
     BAUDCONbits.SCKP    =   0U;
     
-    /* 16-bit Baud Rate Generator is used    */
-    BAUDCONbits.BRG16   =   1U;
+    /* 16-bit or 8-bit Baud Rate Generator ( baud_calc.h )    */
+    BAUDCONbits.BRG16   =   myBaud_BRG16;
     
     /* Auto-Baud Detect mode is disabled    */
     BAUDCONbits.ABDEN   =   0U;
     
     /* Baudrate value   */
-    SPBRGH  =   0x00;
-    SPBRGL  =   0x22;
+    SPBRGH  =   myBaud_SPBRGH;
+    SPBRGL  =   myBaud_SPBRGL;
     
     /* Clear receiver (Rx) and transmission (Tx) interrupt flags   */
     PIR1bits.RCIF   =   0U;
@@ -267,4 +280,37 @@ void conf_eusart ( void )
     
     /* Serial port enabled (configures RX/DT and TX/CK pins as serial port pins)    */
     RCSTAbits.SPEN  =   1U;
+}
+
+
+
+/**
+ * @brief       void conf_WDT ( void )
+ * @details     It configures the Watchdog peripheral. It is used to wake the uC up while the TC74
+ *              is converting.
+ *              
+ *              WDT:
+ *                  - WDT overflows ~256ms ( TC74_ACQ_WAIT_MS )
+ *                  - Software Enabled, it is turned on only before SLEEP
+ * 
+ * @param[in]    N/A.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         WDTE = SWDTEN ( Configuration Word ).
+ * @warning     N/A
+ */
+void conf_WDT ( void )
+{
+    /* Watchdog Timer Period: 1:8192 (Interval 256ms typ) */
+    WDTCONbits.WDTPS    =   0b01000;
+    
+    /* WDT is turned off */
+    WDTCONbits.SWDTEN   =   0U;
 }
\ No newline at end of file
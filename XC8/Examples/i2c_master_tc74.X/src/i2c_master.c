@@ -0,0 +1,596 @@
+/**
+ * @brief       i2c_master.c
+ * @details     Interrupt-driven I2C master ( MSSP ) driver sources.
+ *
+ *              Every phase of a transaction ( START, address, data, ACK/NACK and STOP ) is started
+ *              here and completed by the MSSP, which sets SSPIF. The SSPIF interrupt runs the next
+ *              phase, so the CPU never polls SEN/RSEN/RCEN/ACKEN/PEN.
+ *
+ *              Every phase is timestamped with the millisecond tick, i2c_master_poll() fails the
+ *              transaction if a phase takes longer than I2C_MASTER_PHASE_TIMEOUT_MS, whatever F_OSC is.
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero (aqueronteblog@gmail.com)
+ * @date        18/October/2026
+ * @version     18/October/2026    Per-phase errors and millisecond timeouts
+ *              18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     The MSSP is clocked by F_OSC in master mode, so the uC must not enter SLEEP while a
+ *              transaction is in progress.
+ */
+#include "../inc/i2c_master.h"
+
+
+/**@brief Constants.
+ */
+typedef enum{
+  I2C_SM_IDLE           = 0U,     /*!<   No transaction                           */
+  I2C_SM_START_WRITE    = 1U,     /*!<   (Repeated) START, then address + W       */
+  I2C_SM_START_READ     = 2U,     /*!<   (Repeated) START, then address + R       */
+  I2C_SM_ADDRESS_WRITE  = 3U,     /*!<   Address + W sent                         */
+  I2C_SM_DATA_WRITE     = 4U,     /*!<   Data byte sent                           */
+  I2C_SM_ADDRESS_READ   = 5U,     /*!<   Address + R sent                         */
+  I2C_SM_DATA_READ      = 6U,     /*!<   Data byte received                       */
+  I2C_SM_ACK            = 7U,     /*!<   ACK/NACK sent                            */
+  I2C_SM_STOP           = 8U      /*!<   STOP condition sent                      */
+} i2c_sm_t;
+
+
+/**@brief Variables.
+ */
+static i2c_master_xfer_t*   myXfer;         /*!<   Transaction in progress                          */
+static volatile i2c_sm_t    myPhase;        /*!<   Current phase                                    */
+static i2c_master_status_t  myResult;       /*!<   Result to report when the STOP is completed      */
+static uint8_t              myIndex;        /*!<   Current data byte                                */
+static uint8_t              myBusHeld;      /*!<   1: The last transaction did not release the bus  */
+static uint16_t             myPhaseStart;   /*!<   Tick when the current phase was started          */
+
+
+/**@brief Function prototypes.
+ */
+static void i2c_master_complete ( i2c_master_status_t status );
+static void i2c_master_finish   ( i2c_master_status_t status );
+static void i2c_master_reset    ( i2c_master_status_t status );
+
+
+/**
+ * @brief       void i2c_master_init ( void )
+ * @details     It resets the driver and enables the MSSP and bus collision interrupts.
+ *
+ *
+ * @param[in]    N/A.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         conf_master_i2c() must be called first.
+ * @warning     PEIE must be enabled while a transaction is in progress.
+ */
+void i2c_master_init ( void )
+{
+    /* Reset the driver    */
+    myXfer      =   NULL;
+    myPhase     =   I2C_SM_IDLE;
+    myIndex     =   0U;
+    myBusHeld   =   0U;
+
+    /* Clear MSSP and bus collision interrupt flags   */
+    PIR1bits.SSPIF  =   0U;
+    PIR2bits.BCLIF  =   0U;
+
+    /* Enable MSSP and bus collision interrupts   */
+    PIE1bits.SSPIE  =   1U;
+    PIE2bits.BCLIE  =   1U;
+}
+
+
+/**
+ * @brief       i2c_master_status_t i2c_master_set_speed ( uint32_t , uint32_t )
+ * @details     It sets the bus speed for the given F_OSC. It must be called again after a clock change.
+ *
+ *              SSPxADD = ceil( F_OSC / ( 4*SCL_F_CLOCK ) ) - 1
+ *
+ *              Slew rate control is enabled for Fast-mode ( 400kHz ) only.
+ *
+ *
+ * @param[in]    f_osc:     Current F_OSC in Hz.
+ * @param[in]    f_scl:     Bus speed in Hz ( max. 1MHz ).
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      I2C_MASTER_SUCCESS, I2C_MASTER_BUSY: The bus is in use, I2C_MASTER_ERROR_SPEED: Speed cannot be reached
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         conf_master_i2c() must be called first.
+ * @warning     The MSSP is disabled while it is reconfigured.
+ */
+i2c_master_status_t i2c_master_set_speed ( uint32_t f_osc, uint32_t f_scl )
+{
+    uint32_t    sspadd;
+
+    if ( ( f_scl == 0UL ) || ( f_scl > I2C_MASTER_F_SCL_FAST_PLUS ) )
+    {
+        return I2C_MASTER_ERROR_SPEED;
+    }
+
+    sspadd  =   I2C_MASTER_SSPADD( f_osc, f_scl );
+
+    if ( ( sspadd < I2C_MASTER_SSPADD_MIN ) || ( sspadd > I2C_MASTER_SSPADD_MAX ) )
+    {
+        return I2C_MASTER_ERROR_SPEED;
+    }
+
+    /* The MSSP cannot be reconfigured while a transaction is in progress or the bus is held  */
+    if ( ( myPhase != I2C_SM_IDLE ) || ( myBusHeld == 1U ) )
+    {
+        return I2C_MASTER_BUSY;
+    }
+
+    /* Disable the serial port */
+    SSPCON1bits.SSPEN   =   0U;
+
+    /* Baud rate generator and slew rate control  */
+    SSPADD          =   (uint8_t)sspadd;
+    SSPSTATbits.SMP =   I2C_MASTER_SMP( f_scl );
+
+    /* Enable the serial port */
+    SSPCON1bits.SSPEN   =   1U;
+
+    return I2C_MASTER_SUCCESS;
+}
+
+
+/**
+ * @brief       i2c_master_status_t i2c_master_submit ( i2c_master_xfer_t* )
+ * @details     It starts a new transaction and returns straight away. The transaction status is
+ *              I2C_MASTER_BUSY until it is completed by the ISR.
+ *
+ *
+ * @param[in]    xfer:      Transaction.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      I2C_MASTER_SUCCESS: Transaction started, I2C_MASTER_BUSY: Another one is in progress
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         The buffers must be kept until the transaction is completed.
+ * @pre         The tick must be running, see tick_start().
+ * @warning     N/A
+ */
+i2c_master_status_t i2c_master_submit ( i2c_master_xfer_t* xfer )
+{
+    if ( myPhase != I2C_SM_IDLE )
+    {
+        return I2C_MASTER_BUSY;
+    }
+
+    xfer->status    =   I2C_MASTER_BUSY;
+    myXfer          =   xfer;
+    myResult        =   I2C_MASTER_SUCCESS;
+    myIndex         =   0U;
+    myPhaseStart    =   tick_get_ms ();
+
+    /* Write phase first, unless it is a read-only transaction  */
+    if ( ( xfer->tx_length != 0U ) || ( xfer->rx_length == 0U ) )
+    {
+        myPhase =   I2C_SM_START_WRITE;
+    }
+    else
+    {
+        myPhase =   I2C_SM_START_READ;
+    }
+
+    /* Generate a repeated START if the bus was not released, a START otherwise  */
+    if ( myBusHeld == 1U )
+    {
+        SSPCON2bits.RSEN    =   1U;
+    }
+    else
+    {
+        SSPCON2bits.SEN     =   1U;
+    }
+
+    return I2C_MASTER_SUCCESS;
+}
+
+
+/**
+ * @brief       uint8_t i2c_master_busy ( void )
+ * @details     It checks if a transaction is in progress.
+ *
+ *
+ * @param[in]    N/A.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      0: Driver is idle, 1: Transaction in progress
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+uint8_t i2c_master_busy ( void )
+{
+    if ( myPhase != I2C_SM_IDLE )
+    {
+        return 1U;
+    }
+    else
+    {
+        return 0U;
+    }
+}
+
+
+/**
+ * @brief       void i2c_master_abort ( void )
+ * @details     It aborts the transaction in progress, the MSSP is reset and the bus released.
+ *
+ *
+ * @param[in]    N/A.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+void i2c_master_abort ( void )
+{
+    i2c_master_reset ( I2C_MASTER_ERROR_ABORTED );
+}
+
+
+/**
+ * @brief       void i2c_master_poll ( void )
+ * @details     It checks the phase in progress against I2C_MASTER_PHASE_TIMEOUT_MS. A phase that
+ *              is not completed in time ( stuck bus, SCL held low by a slave ) fails the transaction
+ *              with the error of that phase, and the MSSP is reset.
+ *
+ *
+ * @param[in]    N/A.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         It must be called from the main context while waiting for a transaction.
+ * @warning     N/A
+ */
+void i2c_master_poll ( void )
+{
+    i2c_sm_t            phase;
+    uint16_t            start;
+    i2c_master_status_t status;
+
+    /* The phase and its timestamp are updated by the ISR   */
+    PIE1bits.SSPIE  =   0U;
+    phase   =   myPhase;
+    start   =   myPhaseStart;
+    PIE1bits.SSPIE  =   1U;
+
+    if ( ( phase == I2C_SM_IDLE ) || ( tick_elapsed_ms ( start ) < I2C_MASTER_PHASE_TIMEOUT_MS ) )
+    {
+        return;
+    }
+
+    switch ( phase )
+    {
+        case I2C_SM_START_WRITE:
+        case I2C_SM_START_READ:
+            status  =   I2C_MASTER_ERROR_START;
+            break;
+
+        case I2C_SM_STOP:
+            status  =   I2C_MASTER_ERROR_STOP;
+            break;
+
+        default:
+            status  =   I2C_MASTER_ERROR_TIMEOUT;
+            break;
+    }
+
+    i2c_master_reset ( status );
+}
+
+
+/**
+ * @brief       void i2c_master_isr ( void )
+ * @details     MSSP interrupt handler. It must be called from ISR() when SSPIE and SSPIF are set,
+ *              once SSPIF is cleared. The last phase is completed, the next one is started.
+ *
+ *
+ * @param[in]    N/A.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The phase start is timestamped
+ *              18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+void i2c_master_isr ( void )
+{
+    switch ( myPhase )
+    {
+        case I2C_SM_START_WRITE:
+            /* Send the I2C slave address. Write option   */
+            SSPBUF  =   (uint8_t)( ( myXfer->address << 1U ) & 0xFE );
+            myPhase =   I2C_SM_ADDRESS_WRITE;
+            break;
+
+        case I2C_SM_START_READ:
+            /* Send the I2C slave address. Read option   */
+            SSPBUF  =   (uint8_t)( ( myXfer->address << 1U ) | 0x01 );
+            myPhase =   I2C_SM_ADDRESS_READ;
+            break;
+
+        case I2C_SM_ADDRESS_WRITE:
+        case I2C_SM_DATA_WRITE:
+            if ( SSPCON2bits.ACKSTAT == 1U )
+            {
+                /* Slave did not acknowledge   */
+                if ( myPhase == I2C_SM_ADDRESS_WRITE )
+                {
+                    i2c_master_finish ( I2C_MASTER_ERROR_ADDRESS_NACK );
+                }
+                else
+                {
+                    i2c_master_finish ( I2C_MASTER_ERROR_DATA_NACK );
+                }
+            }
+            else if ( myIndex < myXfer->tx_length )
+            {
+                /* Send data    */
+                SSPBUF  =   myXfer->tx_buff[myIndex];
+                myIndex++;
+                myPhase =   I2C_SM_DATA_WRITE;
+            }
+            else if ( myXfer->rx_length != 0U )
+            {
+                /* Generate a repeated START condition for the read phase   */
+                myIndex =   0U;
+                myPhase =   I2C_SM_START_READ;
+                SSPCON2bits.RSEN    =   1U;
+            }
+            else
+            {
+                i2c_master_finish ( I2C_MASTER_SUCCESS );
+            }
+            break;
+
+        case I2C_SM_ADDRESS_READ:
+            if ( SSPCON2bits.ACKSTAT == 1U )
+            {
+                /* Slave did not acknowledge   */
+                i2c_master_finish ( I2C_MASTER_ERROR_ADDRESS_NACK );
+            }
+            else
+            {
+                /* Enable Receive mode for I2C */
+                myPhase =   I2C_SM_DATA_READ;
+                SSPCON2bits.RCEN    =   1U;
+            }
+            break;
+
+        case I2C_SM_DATA_READ:
+            /* Read data    */
+            myXfer->rx_buff[myIndex]    =   SSPBUF;
+            myIndex++;
+
+            /* ACK/NACK and Initiate Acknowledge sequence    */
+            if ( myIndex == myXfer->rx_length )
+            {
+                /* Send a NACK - End of communication   */
+                SSPCON2bits.ACKDT   =   1U;
+            }
+            else
+            {
+                /* Send a ACK - Communication in progress   */
+                SSPCON2bits.ACKDT   =   0U;
+            }
+            myPhase =   I2C_SM_ACK;
+            SSPCON2bits.ACKEN   =   1U;
+            break;
+
+        case I2C_SM_ACK:
+            if ( myIndex < myXfer->rx_length )
+            {
+                /* Enable Receive mode for the next byte */
+                myPhase =   I2C_SM_DATA_READ;
+                SSPCON2bits.RCEN    =   1U;
+            }
+            else
+            {
+                i2c_master_finish ( I2C_MASTER_SUCCESS );
+            }
+            break;
+
+        case I2C_SM_STOP:
+            /* STOP condition completed, the bus is released   */
+            myBusHeld   =   0U;
+            i2c_master_complete ( myResult );
+            break;
+
+        default:
+        case I2C_SM_IDLE:
+            /* Unexpected event, nothing to do   */
+            break;
+    }
+
+    /* Timestamp of the phase just started   */
+    myPhaseStart    =   tick_get_ms ();
+}
+
+
+/**
+ * @brief       void i2c_master_bcl_isr ( void )
+ * @details     Bus collision interrupt handler. It must be called from ISR() when BCLIE and BCLIF
+ *              are set, once BCLIF is cleared. The MSSP is idle after a collision.
+ *
+ *
+ * @param[in]    N/A.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+void i2c_master_bcl_isr ( void )
+{
+    myBusHeld   =   0U;
+
+    if ( myPhase != I2C_SM_IDLE )
+    {
+        i2c_master_complete ( I2C_MASTER_ERROR_COLLISION );
+    }
+}
+
+
+/**
+ * @brief       void i2c_master_finish ( i2c_master_status_t )
+ * @details     It ends the transaction: a STOP condition is generated if required ( always on errors ),
+ *              otherwise the bus is kept for a repeated START.
+ *
+ *
+ * @param[in]    status:    Transaction result.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+static void i2c_master_finish ( i2c_master_status_t status )
+{
+    if ( ( status != I2C_MASTER_SUCCESS ) || ( myXfer->stop == I2C_MASTER_STOP ) )
+    {
+        /* Generate a STOP condition, the result is reported when it is completed    */
+        myResult    =   status;
+        myPhase     =   I2C_SM_STOP;
+        SSPCON2bits.PEN =   1U;
+    }
+    else
+    {
+        /* Keep the bus, next transaction starts with a repeated START    */
+        myBusHeld   =   1U;
+        i2c_master_complete ( status );
+    }
+}
+
+
+/**
+ * @brief       void i2c_master_reset ( i2c_master_status_t )
+ * @details     It resets the MSSP ( SDA and SCL are released ) and ends the transaction in progress
+ *              with the given status.
+ *
+ *
+ * @param[in]    status:    Transaction result.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+static void i2c_master_reset ( i2c_master_status_t status )
+{
+    /* Disable MSSP interrupt while the driver is reset   */
+    PIE1bits.SSPIE  =   0U;
+
+    /* Reset the MSSP, it releases SDA and SCL   */
+    SSPCON1bits.SSPEN   =   0U;
+    SSPCON1bits.SSPEN   =   1U;
+
+    /* Clear it before the completion callback, it may start a new transaction   */
+    PIR1bits.SSPIF  =   0U;
+    myBusHeld       =   0U;
+
+    if ( myPhase != I2C_SM_IDLE )
+    {
+        i2c_master_complete ( status );
+    }
+
+    PIE1bits.SSPIE  =   1U;
+}
+
+
+/**
+ * @brief       void i2c_master_complete ( i2c_master_status_t )
+ * @details     It reports the transaction result, sets the driver idle and calls the completion
+ *              callback ( if any ), which can submit the next transaction.
+ *
+ *
+ * @param[in]    status:    Transaction result.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    Completion callback
+ *              18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+static void i2c_master_complete ( i2c_master_status_t status )
+{
+    i2c_master_xfer_t*  xfer    =   myXfer;
+
+    myXfer  =   NULL;
+    myPhase =   I2C_SM_IDLE;
+
+    xfer->status    =   status;
+
+    if ( xfer->done != NULL )
+    {
+        xfer->done ();
+    }
+}
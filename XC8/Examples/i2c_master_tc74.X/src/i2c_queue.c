@@ -0,0 +1,301 @@
+/**
+ * @brief       i2c_queue.c
+ * @details     I2C job queue sources.
+ *
+ *              The pool is a ring of jobs. The main loop is the only producer ( it moves myHead )
+ *              and the job completion, run by the MSSP interrupt, is the only consumer ( it moves
+ *              myTail ). Both indexes are single bytes and free running, so ( myHead - myTail ) is
+ *              the number of pending jobs.
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero (aqueronteblog@gmail.com)
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     The job callbacks run in the interrupt context, they must not submit new jobs.
+ */
+#include "../inc/i2c_queue.h"
+
+
+/**@brief Constants.
+ */
+/**@brief Job.
+ */
+typedef struct{
+  i2c_master_xfer_t xfer;       /*!<   I2C transaction                         */
+  i2c_queue_done_t  done;       /*!<   Completion callback ( NULL if not used ) */
+  void*             context;    /*!<   User data given to the callback          */
+} i2c_queue_job_t;
+
+
+/**@brief Variables.
+ */
+static i2c_queue_job_t  myJobs[I2C_QUEUE_SIZE];     /*!<   Job pool                                 */
+static volatile uint8_t myHead;                     /*!<   Next free job ( producer )               */
+static volatile uint8_t myTail;                     /*!<   Job in progress/next job ( consumer )    */
+static volatile uint8_t myRunning;                  /*!<   1: A job is in progress                  */
+
+
+/**@brief Function prototypes.
+ */
+static void i2c_queue_next  ( void );
+static void i2c_queue_done  ( void );
+
+
+/**
+ * @brief       void i2c_queue_init ( void )
+ * @details     It empties the job pool.
+ *
+ *
+ * @param[in]    N/A.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         i2c_master_init() must be called first.
+ * @warning     N/A
+ */
+void i2c_queue_init ( void )
+{
+    myHead      =   0U;
+    myTail      =   0U;
+    myRunning   =   0U;
+}
+
+
+/**
+ * @brief       i2c_master_status_t i2c_queue_submit ( uint8_t , const uint8_t* , uint8_t , uint8_t* , uint8_t , i2c_queue_done_t , void* )
+ * @details     It adds a job to the queue: tx_length bytes are written, then rx_length bytes are read
+ *              after a repeated START. The job is run by i2c_queue_run() or, if a batch is in progress,
+ *              right after the pending ones.
+ *
+ *
+ * @param[in]    address:   7-bit slave address.
+ * @param[in]    tx_buff:   Data to be written.
+ * @param[in]    tx_length: How many bytes to be written.
+ * @param[in]    rx_length: How many bytes to be read.
+ * @param[in]    done:      Completion callback ( NULL if not used ).
+ * @param[in]    context:   User data given to the callback.
+ *
+ * @param[out]   rx_buff:   Data read.
+ *
+ *
+ * @return      I2C_MASTER_SUCCESS: Job queued, I2C_MASTER_BUSY: The pool is full
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         The buffers must be kept until the job is completed.
+ * @warning     It must only be called from the main context.
+ */
+i2c_master_status_t i2c_queue_submit ( uint8_t address, const uint8_t* tx_buff, uint8_t tx_length, uint8_t* rx_buff, uint8_t rx_length, i2c_queue_done_t done, void* context )
+{
+    i2c_queue_job_t*    job;
+
+    if ( (uint8_t)( myHead - myTail ) >= I2C_QUEUE_SIZE )
+    {
+        return I2C_MASTER_BUSY;
+    }
+
+    job =   &myJobs[myHead & I2C_QUEUE_MASK];
+
+    job->xfer.address   =   address;
+    job->xfer.tx_buff   =   tx_buff;
+    job->xfer.tx_length =   tx_length;
+    job->xfer.rx_buff   =   rx_buff;
+    job->xfer.rx_length =   rx_length;
+    job->xfer.done      =   i2c_queue_done;
+    job->done           =   done;
+    job->context        =   context;
+
+    /* The job is visible to the ISR once myHead is updated  */
+    myHead++;
+
+    return I2C_MASTER_SUCCESS;
+}
+
+
+/**
+ * @brief       i2c_master_status_t i2c_queue_run ( void )
+ * @details     It starts the pending jobs, they are run back-to-back by the MSSP interrupt.
+ *
+ *
+ * @param[in]    N/A.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      I2C_MASTER_SUCCESS: Jobs in progress or nothing to do, I2C_MASTER_BUSY: The MSSP is busy
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         Peripheral interrupts must be enabled and the tick running. i2c_master_poll() must be
+ *              called while i2c_queue_busy() is 1.
+ * @warning     N/A
+ */
+i2c_master_status_t i2c_queue_run ( void )
+{
+    i2c_master_status_t status  =   I2C_MASTER_SUCCESS;
+
+    /* Avoid a race with the completion of the last job   */
+    PIE1bits.SSPIE  =   0U;
+
+    if ( myRunning == 0U )
+    {
+        if ( i2c_master_busy () == 1U )
+        {
+            status  =   I2C_MASTER_BUSY;
+        }
+        else
+        {
+            i2c_queue_next ();
+        }
+    }
+
+    PIE1bits.SSPIE  =   1U;
+
+    return status;
+}
+
+
+/**
+ * @brief       uint8_t i2c_queue_busy ( void )
+ * @details     It checks if there are jobs pending or in progress.
+ *
+ *
+ * @param[in]    N/A.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      0: Queue is empty, 1: Jobs pending or in progress
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+uint8_t i2c_queue_busy ( void )
+{
+    if ( ( myRunning == 1U ) || ( myHead != myTail ) )
+    {
+        return 1U;
+    }
+    else
+    {
+        return 0U;
+    }
+}
+
+
+/**
+ * @brief       uint8_t i2c_queue_free ( void )
+ * @details     It returns how many jobs can be submitted.
+ *
+ *
+ * @param[in]    N/A.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      Free jobs in the pool
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+uint8_t i2c_queue_free ( void )
+{
+    return (uint8_t)( I2C_QUEUE_SIZE - (uint8_t)( myHead - myTail ) );
+}
+
+
+/**
+ * @brief       void i2c_queue_next ( void )
+ * @details     It submits the next job. It keeps the bus if another job is pending, so it starts
+ *              with a repeated START.
+ *
+ *
+ * @param[in]    N/A.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         The MSSP must be idle.
+ * @warning     N/A
+ */
+static void i2c_queue_next ( void )
+{
+    i2c_queue_job_t*    job;
+
+    if ( myHead == myTail )
+    {
+        /* Batch completed   */
+        myRunning   =   0U;
+        return;
+    }
+
+    job =   &myJobs[myTail & I2C_QUEUE_MASK];
+
+    if ( (uint8_t)( myHead - myTail ) > 1U )
+    {
+        job->xfer.stop  =   I2C_MASTER_NO_STOP;
+    }
+    else
+    {
+        job->xfer.stop  =   I2C_MASTER_STOP;
+    }
+
+    myRunning   =   1U;
+    (void)i2c_master_submit ( &job->xfer );
+}
+
+
+/**
+ * @brief       void i2c_queue_done ( void )
+ * @details     Completion callback of the I2C master driver. It reports the job result, frees the
+ *              job and submits the next one.
+ *
+ *
+ * @param[in]    N/A.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+static void i2c_queue_done ( void )
+{
+    i2c_queue_job_t*    job =   &myJobs[myTail & I2C_QUEUE_MASK];
+
+    if ( job->done != NULL )
+    {
+        job->done ( job->xfer.status, job->context );
+    }
+
+    /* Free the job   */
+    myTail++;
+
+    i2c_queue_next ();
+}
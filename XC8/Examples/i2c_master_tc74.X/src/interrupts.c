@@ -22,7 +22,10 @@
  *
  * @author      Manuel Caballero
  * @date        17/February/2024
- * @version     17/February/2024   The ORIGIN
+ * @version     18/October/2026    Timer2 millisecond tick
+ *              18/October/2026    I2C master is driven by the MSSP interrupt
+ *              18/October/2026    Tx is driven by the EUSART ring buffer driver
+ *              17/February/2024   The ORIGIN
  * @pre         N/A.
  * @warning     N/A
  */
@@ -38,29 +41,38 @@ void __interrupt() ISR ( void )
         IOCBFbits.IOCBF0 = 0U;
     }
     
-    /* EUSART. Tx	 */
-	if ( ( PIE1bits.TXIE == 1U ) && ( TXSTAbits.TXEN == 1UL ) )
-	{        
-        /* Wait until Transmit Shift Register Status is empty  */
-        while ( TXSTAbits.TRMT ==  0U );
+    /* Timer2. Millisecond tick	 */
+	if ( ( PIE1bits.TMR2IE == 1U ) && ( PIR1bits.TMR2IF == 1U ) )
+	{
+        /* Clear Timer2 Interrupt flag  */
+        PIR1bits.TMR2IF = 0U;
         
-		/* Stop transmitting data when that character is found */
-		if ( *myPtr  == '\n' )
-		{            
-            /* Disable transmission    */
-			TXSTAbits.TXEN  =   0UL;
-            
-            /* Enable interrupts    */
-            INTCONbits.IOCIE    =   1U; // Enable the interrupt-on-change
-            INTCONbits.PEIE     =   0U; // Disable all active peripheral interrupts
-		}
-		else
-		{
-			TXREG	 =	 *myPtr;
-            myPtr++;
-		}
+        tick_isr ();
+	}
+    
+    /* MSSP. I2C master	 */
+	if ( ( PIE1bits.SSPIE == 1U ) && ( PIR1bits.SSPIF == 1U ) )
+	{
+        /* Clear MSSP Interrupt flag  */
+        PIR1bits.SSPIF = 0U;
         
-        /* Clear Tx Interrupt flag  */
-        PIR1bits.TXIF = 0U; 
+        /* Run the next phase of the I2C transaction  */
+        i2c_master_isr ();
+	}
+    
+    /* MSSP. Bus collision	 */
+	if ( ( PIE2bits.BCLIE == 1U ) && ( PIR2bits.BCLIF == 1U ) )
+	{
+        /* Clear Bus Collision Interrupt flag  */
+        PIR2bits.BCLIF = 0U;
+        
+        i2c_master_bcl_isr ();
+	}
+    
+    /* EUSART. Tx	 */
+	if ( ( PIE1bits.TXIE == 1U ) && ( PIR1bits.TXIF == 1U ) )
+	{
+        /* Load the next byte from the Tx ring buffer ( no waiting on TRMT )    */
+        eusart_tx_isr ();
 	}
 }
\ No newline at end of file
@@ -3,15 +3,25 @@
  * @details     This example shows how to work with the internal peripheral: I2C as master.
  * 
  *              Every time the switch S3 is pushed, the external I2C sensor TC74 is read and its
- *              temperature value is sent through the EUSART.
+ *              temperature value is sent through the EUSART, together with the data-ready checks,
+ *              the I2C bus time used and the bus time saved against a GetConfig spin loop.
  * 
- *              The microcontroller is in SLEEP mode the rest of the time.
+ *              The microcontroller is in SLEEP mode the rest of the time, also while the TC74 is
+ *              converting ( WDT wake-up ).
  *
  * @return      N/A
  *
  * @author      Manuel Caballero (aqueronteblog@gmail.com)
  * @date        17/February/2024
- * @version     17/February/2024    The ORIGIN
+ * @version     18/October/2026     The error report gives its cause ( tc74_acq_get_error() ), data-ready timeout included
+ *              18/October/2026     The report is sent through an EUSART Tx descriptor, no longer cut to the ring buffer size
+ *              18/October/2026     TC74 acquisition state machine, SLEEP while the TC74 converts
+ *              18/October/2026     I2C bus speed set by I2C0_FREQUENCY
+ *              18/October/2026     I2C job queue
+ *              18/October/2026     I2C timeouts in milliseconds ( Timer2 tick ), per-phase I2C errors
+ *              18/October/2026     I2C transactions are run by the SSPIF interrupt
+ *              18/October/2026     Transmission through the EUSART Tx ring buffer driver
+ *              17/February/2024    The ORIGIN
  * @pre         This project was tested on a PIC16F1937 using a PICDEM 2 Plus.
  * @warning     N/A
  * @pre         This code belongs to AqueronteBlog. 
@@ -26,7 +36,7 @@
 
 // CONFIG1
 #pragma config FOSC = INTOSC    // Oscillator Selection (INTOSC oscillator: I/O function on CLKIN pin)
-#pragma config WDTE = OFF       // Watchdog Timer Enable (WDT disabled)
+#pragma config WDTE = SWDTEN    // Watchdog Timer Enable (WDT controlled by the SWDTEN bit in the WDTCON register)
 #pragma config PWRTE = OFF      // Power-up Timer Enable (PWRT disabled)
 #pragma config MCLRE = ON       // MCLR Pin Function Select (MCLR/VPP pin function is MCLR)
 #pragma config CP = OFF         // Flash Program Memory Code Protection (Program memory code protection is disabled)
@@ -51,24 +61,29 @@
 #include "../inc/board.h"
 #include "../inc/functions.h"
 #include "../inc/interrupts.h"
+#include "../inc/eusart.h"
+#include "../inc/i2c_master.h"
+#include "../inc/tick.h"
+#include "../inc/i2c_queue.h"
+#include "../inc/tc74_acq.h"
 #include "../../../../../Drivers/TC74/inc/TC74.h"
 
 /**@brief Constants.
  */
-#define I2C0_FREQUENCY   		100000U	/*!< I2C frequency */
-#define I2C_MASTER_TIMEOUT_MS	500		/*!< I2C master communication timeout */
+#define I2C0_FREQUENCY   		100000UL	/*!< I2C frequency. TC74: 100kHz max. */
+#define I2C_MASTER_TIMEOUT_MS	500U	/*!< I2C master communication timeout ( ms ) */
 #define ACK_CHECK_EN        	0x01    /*!< I2C master will check ack from slave*/
 #define ACK_CHECK_DIS       	0x00    /*!< I2C master will not check ack from slave */
 #define ACK_VAL             	0x00    /*!< I2C ack value */
 #define NACK_VAL            	0x01    /*!< I2C nack value */
 
-#define EUSART_BUFF 16  /*!< EUSART buffer */      
+#define EUSART_BUFF 80  /*!< EUSART buffer, sent through a Tx descriptor ( not limited by EUSART_TX_BUFF_SIZE ) */      
 
 
 /**@brief Variables.
  */
 volatile uint8_t    myState;    /*!< State that indicates when to perform the next action */
-volatile uint8_t    *myPtr;     /*!< Pointer to point out myMessage   */
+i2c_master_status_t myI2C_status;   /*!< Result of the last I2C transaction ( per-phase error ) */
 
 /**@brief Function prototypes.
  */
@@ -80,13 +95,22 @@ static i2c_status_t	i2c_write	( uint8_t dev_addr, uint8_t* i2c_buff, uint32_t le
   */
 static i2c_status_t	i2c_read	( uint8_t dev_addr, uint8_t* i2c_buff, uint32_t length );
 
+/** I2C blocking transaction.
+  */
+static i2c_status_t	i2c_wait	( i2c_master_xfer_t* xfer );
+
 
 /**@brief Function for application main entry.
  */
 void main(void) {
     uint8_t my_message[EUSART_BUFF] = {0};
+    uint8_t my_length   =   0U;
+    eusart_tx_desc_t my_tx = { NULL, 0U, NULL, 0U };
     
-    TC74_data_t     myTC74_param = { 0 };	
+    TC74_data_t         myTC74_param = { 0 };	
+    tc74_acq_stats_t    myTC74_stats = { 0 };
+    tc74_acq_error_t    myTC74_error = TC74_ACQ_ERR_NONE;
+    i2c_master_status_t myTC74_i2c_status = I2C_MASTER_SUCCESS;
 	TC74_status_t   err = TC74_SUCCESS;
 	
 	/* Configure I2C for external peripheral: TC74	*/
@@ -99,8 +123,24 @@ void main(void) {
     conf_CLK        ();
     conf_GPIO       ();
     conf_eusart     ();
+    eusart_tx_init  ();
     conf_master_i2c ();
+    i2c_master_init ();
+    i2c_queue_init  ();
+    tc74_acq_init   ( &myTC74_i2c );
+    tick_init       ();
     conf_ioc        ();
+    conf_WDT        ();
+    
+    /* Bus speed. The TC74 is a Standard mode device, other slaves can run at 400kHz/1MHz    */
+    (void)i2c_master_set_speed ( I2C_MASTER_F_OSC, I2C0_FREQUENCY );
+    
+    /* Enable interrupts. The I2C transactions are run by the MSSP interrupt    */
+    INTCONbits.PEIE     =   1U; // Enable all active peripheral interrupts
+    INTCONbits.GIE      =   1U; // Enable all active interrupts
+    
+    /* Start the tick, the I2C timeouts are measured in milliseconds    */
+    tick_start ();
     
     /* Disable TC74  */
     myTC74_param.config.standby =   CONFIG_STANDBY_STANDBY;
@@ -109,64 +149,93 @@ void main(void) {
     /* Enable interrupts    */
     INTCONbits.IOCIE    =   1U; // Enable the interrupt-on-change
     INTCONbits.PEIE     =   0U; // Disable all active peripheral interrupts
-    INTCONbits.GIE      =   1U; // Enable all active interrupts
+    tick_stop ();
        
     /* Reset the variables  */
     myState =   0U;
     
     while ( 1U )
     {
-        /* Check if an interrupt is triggered by TMR2 or TMR6    */
+        /* Check if an interrupt is triggered by IOC    */
         if ( myState != 0U )
         {
             /* D5 LED on    */
             LATB    |=  D5;
             
-            /* TC74. Enabled  */
-            myTC74_param.config.standby =   CONFIG_STANDBY_NORMAL;
-            err =   TC74_SetConfig ( &myTC74_i2c, myTC74_param.config.standby );
-            
-            /* TC74. Wait until the data is ready */
-            do{
-                myTC74_param.config.data_ready  =   CONFIG_DATA_READY_NOT_READY;
-                err =   TC74_GetConfig ( &myTC74_i2c, &myTC74_param.config );
-            }while( myTC74_param.config.data_ready == CONFIG_DATA_READY_NOT_READY );
-            
-            /* TC74. Get temperature  */
-            err =   TC74_GetTemperature ( &myTC74_i2c, &myTC74_param.raw_temperature );
-            
-            /* TC74. Disabled  */
-            myTC74_param.config.standby =   CONFIG_STANDBY_STANDBY;
-            err =   TC74_SetConfig  ( &myTC74_i2c, myTC74_param.config.standby );
-            
-            /* Pack the message  */
-            sprintf ((char*)my_message, "Temp = %d C\r\n", (int8_t)( myTC74_param.raw_temperature ));
-            
-           /* Transmit data over the EUSART	 */
-			myPtr    =   &my_message[0];
+            /* Enable interrupts    */
+            INTCONbits.IOCIE    =   0U; // Disable the interrupt-on-change
+            INTCONbits.PEIE     =   1U; // Enable all active peripheral interrupts
+            tick_start ();
             
             /* Reset variables	 */
 			myState	 =	 0U;
             
-            /* Enable interrupts    */
-            INTCONbits.IOCIE    =   0U; // Disable the interrupt-on-change
+            /* TC74. Enabled, it starts converting  */
+            (void)tc74_acq_start ();
+        }
+        else if ( ( tc74_acq_get_state () == TC74_ACQ_CONVERTING ) && ( eusart_tx_busy () == 0U ) )
+        {
+            /* Sleep mode while the TC74 is converting. The WDT wakes the uC up after TC74_ACQ_WAIT_MS    */
+            INTCONbits.PEIE     =   0U; // Disable all active peripheral interrupts
+            tick_stop ();
+            WDTCONbits.SWDTEN   =   1U;
+            
+            SLEEP();
+            
+            WDTCONbits.SWDTEN   =   0U;
             INTCONbits.PEIE     =   1U; // Enable all active peripheral interrupts
+            tick_start ();
             
-            /* Enables the EUSART transmit interrupt	 */
-			PIE1bits.TXIE = 1UL;
+            /* TC74. One data-ready check and temperature read  */
+            (void)tc74_acq_run ();
+        }
+        else if ( ( tc74_acq_get_state () == TC74_ACQ_DONE ) || ( tc74_acq_get_state () == TC74_ACQ_ERROR ) )
+        {
+            /* Pack the message  */
+            tc74_acq_get_stats ( &myTC74_stats );
             
-            /* Disables receiver and enable transmission    */
-            RCSTAbits.CREN  =   0U;
-            TXSTAbits.TXEN  =   1UL;
+            if ( tc74_acq_get_state () == TC74_ACQ_DONE )
+            {
+                myTC74_param.raw_temperature    =   (uint8_t)tc74_acq_get_temperature ();
+                my_length   =   (uint8_t)sprintf ((char*)my_message, "Temp = %d C, polls = %u, bus = %u us, saved = %lu us\r\n", (int8_t)( myTC74_param.raw_temperature ), myTC74_stats.polls, myTC74_stats.bus_us, (unsigned long)myTC74_stats.saved_bus_us );
+            }
+            else
+            {
+                /* Cause of the error: The I2C batch status, or the blocking TC74_SetConfig() one ( myI2C_status ).
+                   TC74_ACQ_ERR_NOT_READY is the data-ready timeout, the I2C accesses were fine   */
+                myTC74_error    =   tc74_acq_get_error ( &myTC74_i2c_status );
+                if ( ( myTC74_error == TC74_ACQ_ERR_START ) || ( myTC74_error == TC74_ACQ_ERR_STANDBY ) )
+                {
+                    myTC74_i2c_status   =   myI2C_status;
+                }
+                
+                (void)tc74_acq_get_temperature ();
+                my_length   =   (uint8_t)sprintf ((char*)my_message, "TC74 error = %u, I2C = %u\r\n", myTC74_error, myTC74_i2c_status );
+            }
+            
+            /* Transmit data over the EUSART. The ISR sends the whole message straight from my_message, it is not
+               packed again before eusart_tx_busy() is 0 ( IOC disabled until then )	 */
+            my_tx.data      =   &my_message[0];
+            my_tx.length    =   my_length;
+            (void)eusart_send ( &my_tx );
             
             /* D5 LED off    */
             LATB    &=  ~D5;
         }
-        else
+        else if ( eusart_tx_busy () == 0U )
         {
-            /* Sleep mode */
+            /* Enable interrupts    */
+            INTCONbits.IOCIE    =   1U; // Enable the interrupt-on-change
+            INTCONbits.PEIE     =   0U; // Disable all active peripheral interrupts
+            tick_stop ();
+            
+            /* Sleep mode. F_OSC is stopped, so the EUSART must be idle first */
             SLEEP();
         }
+        else
+        {
+            /* Wait until the message is transmitted   */
+        }
     }
 }
 
@@ -174,7 +243,7 @@ void main(void) {
 
 /**
  * @brief       i2c_status_t i2c_read ( uint8_t , uint8_t* , uint32_t )
- * @details     [todo]I2C read fucntion.
+ * @details     I2C read fucntion. Blocking wrapper of the I2C master driver.
  *
  *
  * @param[in]    dev_addr: 	Device address.
@@ -187,152 +256,34 @@ void main(void) {
  *
  * @author      Manuel Caballero
  * @date        17/February/2024
- * @version     23/February/2024   Timeouts were added.
+ * @version     18/October/2026    Timeouts in milliseconds, per-phase errors in myI2C_status
+ *              18/October/2026    The transaction is run by the SSPIF interrupt
+ *              23/February/2024   Timeouts were added.
  *              17/February/2024   The ORIGIN
- * @pre         N/A
- * @warning     The timeouts are traced as a common error, not as an individual errors.
+ * @pre         The read phase starts with a repeated START if the last transaction kept the bus.
+ * @warning     The TC74 driver only understands I2C_SUCCESS/I2C_FAILURE, the error of each phase
+ *              is kept in myI2C_status.
  */
 static i2c_status_t i2c_read ( uint8_t dev_addr, uint8_t* i2c_buff, uint32_t length )
 {
-    uint8_t     i   =   0U;
-    uint32_t    timeout1    =   0UL;
-          
-    /* Generate a repeated START condition   */
-    SSPCON2bits.RSEN =   1U;
-    
-    /* Wait until the repeated START condition is completed or timeout */
-    while ( ( SSPCON2bits.RSEN  ==  1U ) && ( timeout1 < 0x3232 ) )
-    {
-        timeout1++;
-    }
-    
-    /* Wait for completion of the START condition or timeout */
-    timeout1    =   0UL;
-    while ( ( PIR1bits.SSPIF  ==  0U ) && ( timeout1 < 0x3232 ) )
-    {
-        timeout1++;
-    }
-	PIR1bits.SSPIF  =  0U;
-    
-    /* Wait until the buffer is free or timeout */
-    timeout1    =   0UL;
-    while( ( SSPSTATbits.BF == 1U ) && ( timeout1 < 0x3232 ) )
-    {
-        timeout1++;
-    }
-    
-    /* Send the I2C slave address. Read option   */
-    SSPBUF  =   (uint8_t)( ( dev_addr << 1U ) | 0x01 );
-    
-    /* Wait until the buffer is free or timeout */
-    timeout1    =   0UL;
-    while( ( SSPSTATbits.BF == 1U ) && ( timeout1 < 0x3232 ) )
-    {
-        timeout1++;
-    }
-    
-    /* Wait for the I2C address is sent or timeout */
-    timeout1    =   0UL;
-    while ( ( PIR1bits.SSPIF  ==  0U ) && ( timeout1 < 0x3232 ) )
-    {
-        timeout1++;
-    }
-    
-    /* Get data from I2C slave  */
-    for ( i = 0U; i < ( length ); i++ )
-    {
-        /* Enable Receive mode for I2C */
-        SSPCON2bits.RCEN    =   1U;
-        
-        /* Wait for Receive mode is enabled or timeout */
-        timeout1    =   0UL;
-        while ( ( SSPCON2bits.RCEN  ==  1U ) && ( timeout1 < 0x3232 ) )
-        {
-            timeout1++;
-        }
-        
-        /* Wait for Receive mode is enabled or timeout */
-        timeout1    =   0UL;
-        while ( ( PIR1bits.SSPIF  ==  0U ) && ( timeout1 < 0x3232 ) )
-        {
-            timeout1++;
-        }
-        PIR1bits.SSPIF  =  0U;
-        
-        /* Wait for buffer full or timeout */
-        timeout1    =   0UL;
-        while( ( SSPSTATbits.BF == 0U ) && ( timeout1 < 0x3232 ) )
-        {
-            timeout1++;
-        }
-        
-        /* Read data    */
-        i2c_buff[i] =   SSPBUF;
-        
-        /* ACK/NACK and Initiate Acknowledge sequence    */
-        if ( ( i - ( length - 1 ) ) == 0U )
-        {
-            /* Send a NACK - End of communication   */
-            SSPCON2bits.ACKDT   =   1U; 
-        }
-        else
-        {
-            /* Send a ACK - Communication in progress   */
-            SSPCON2bits.ACKDT   =   0U;
-        }
-        SSPCON2bits.ACKEN   =   1U; 
-        
-        /* Wait for ACK/NACK to be completed or timeout */
-        timeout1    =   0UL;
-        while ( ( SSPCON2bits.ACKEN  ==  1U ) && ( timeout1 < 0x3232 ) )
-        {
-            timeout1++;
-        }
-        
-        /* Wait for ACK/NACK complete or timeout */
-        timeout1    =   0UL;
-        while ( ( PIR1bits.SSPIF  ==  0U ) && ( timeout1 < 0x3232 ) )
-        {
-            timeout1++;
-        }
-        PIR1bits.SSPIF  =  0U;
-
-    }
+    i2c_master_xfer_t   xfer;
     
-    /* Generate a STOP condition    */
-    SSPCON2bits.PEN =   1U;
+    xfer.address    =   dev_addr;
+    xfer.tx_buff    =   NULL;
+    xfer.tx_length  =   0U;
+    xfer.rx_buff    =   i2c_buff;
+    xfer.rx_length  =   (uint8_t)length;
+    xfer.stop       =   I2C_MASTER_STOP;
+    xfer.done       =   NULL;
     
-    /* Wait for STOP condition to be completed or timeout */
-    timeout1    =   0UL;
-    while ( ( SSPCON2bits.PEN  ==  1U ) && ( timeout1 < 0x323 ) )
-    {
-        timeout1++;
-    }
-        
-    /* Wait until STOP condition is generated   */
-    timeout1    =   0UL;
-    while ( ( PIR1bits.SSPIF ==   0U ) && ( timeout1 < 0x323 ) )
-    {
-        timeout1++;
-    }
-    PIR1bits.SSPIF  =  0U;
-    
-    
-    if ( timeout1 < 0x323 )
-	{
-		return I2C_SUCCESS;
-	}
-	else
-	{
-		return I2C_FAILURE;
-	}
+    return i2c_wait ( &xfer );
 }
 
 
 
 /**
  * @brief       i2c_status_t i2c_write ( uint8_t , uint8_t* , uint32_t , i2c_stop_bit_t )
- * @details     [todo]I2C write function.
+ * @details     I2C write function. Blocking wrapper of the I2C master driver.
  *
  *
  * @param[in]    dev_addr: 			Device address.
@@ -347,104 +298,86 @@ static i2c_status_t i2c_read ( uint8_t dev_addr, uint8_t* i2c_buff, uint32_t len
  *
  * @author      Manuel Caballero
  * @date        17/February/2024
- * @version     23/February/2024   Timeouts were added.
+ * @version     18/October/2026    Timeouts in milliseconds, per-phase errors in myI2C_status
+ *              18/October/2026    The transaction is run by the SSPIF interrupt
+ *              23/February/2024   Timeouts were added.
  *              17/February/2024   The ORIGIN
  * @pre         N/A
- * @warning     The timeouts are traced as a common error, not as an individual errors.
+ * @warning     The TC74 driver only understands I2C_SUCCESS/I2C_FAILURE, the error of each phase
+ *              is kept in myI2C_status.
  */
 static i2c_status_t i2c_write ( uint8_t dev_addr, uint8_t* i2c_buff, uint32_t length, i2c_stop_bit_t i2c_generate_stop )
 {
-    uint8_t     i   =   0U;
-    uint32_t    timeout1    =   0UL;
+    i2c_master_xfer_t   xfer;
     
-    /* Generate a START condition   */
-    SSPCON2bits.SEN =   1U;
+    xfer.address    =   dev_addr;
+    xfer.tx_buff    =   i2c_buff;
+    xfer.tx_length  =   (uint8_t)length;
+    xfer.rx_buff    =   NULL;
+    xfer.rx_length  =   0U;
+    xfer.done       =   NULL;
     
-    /* Wait until START condition is generated or timeout   */
-    while( SSPCON2bits.SEN == 1U && ( timeout1 < 0x3232 ) )
-    {
-        timeout1++;
-    }
-    
-    /* Wait for completion of the START condition or timeout */
-    timeout1    =   0UL;
-    while ( ( PIR1bits.SSPIF  ==  0U ) && ( timeout1 < 0x3232 ) )
+    if ( i2c_generate_stop == I2C_STOP_BIT )
     {
-        timeout1++;
+        xfer.stop   =   I2C_MASTER_STOP;
     }
-    PIR1bits.SSPIF  =  0U;
-    
-    /* Wait for buffer to be free or timeout */
-    timeout1    =   0UL;
-    while( ( SSPSTATbits.BF == 1U ) && ( timeout1 < 0x3232 ) )
+    else
     {
-        timeout1++;
+        xfer.stop   =   I2C_MASTER_NO_STOP;
     }
     
-    /* Send the I2C slave address. Write option   */
-    SSPBUF  =   (uint8_t)( ( dev_addr << 1U ) & 0xFE );
-   
-    /* Wait for buffer to be free or timeout */
-    timeout1    =   0UL;
-    while( ( SSPSTATbits.BF == 1U ) && ( timeout1 < 0x3232 ) )
-    {
-        timeout1++;
-    }
+    return i2c_wait ( &xfer );
+}
+
+
+
+/**
+ * @brief       i2c_status_t i2c_wait ( i2c_master_xfer_t* )
+ * @details     It submits an I2C transaction and waits until the ISR completes it. Every phase is
+ *              limited to I2C_MASTER_PHASE_TIMEOUT_MS, the whole transaction to I2C_MASTER_TIMEOUT_MS.
+ *
+ *
+ * @param[in]    xfer: 		Transaction.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      Status of the transaction
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    Timeouts in milliseconds instead of loop iterations
+ *              18/October/2026    The ORIGIN
+ * @pre         Peripheral interrupts must be enabled and the tick running.
+ * @warning     The uC cannot enter SLEEP while waiting, the MSSP is clocked by F_OSC in master mode.
+ */
+static i2c_status_t i2c_wait ( i2c_master_xfer_t* xfer )
+{
+    uint16_t    start   =   0U;
     
-    /* Wait for address to be transmitted  */
-    timeout1    =   0UL;
-    while ( ( PIR1bits.SSPIF  ==  0U ) && ( timeout1 < 0x3232 ) )
+    if ( i2c_master_submit ( xfer ) != I2C_MASTER_SUCCESS )
     {
-        timeout1++;
+        myI2C_status    =   I2C_MASTER_BUSY;
+        return I2C_FAILURE;
     }
-    PIR1bits.SSPIF  =  0U;
-
     
-    /* Data to be transmitted   */
-    for ( i = 0U; i < length; i++ )
+    /* Wait until the transaction is completed or timeout  */
+    start   =   tick_get_ms ();
+    while ( ( xfer->status == I2C_MASTER_BUSY ) && ( tick_elapsed_ms ( start ) < I2C_MASTER_TIMEOUT_MS ) )
     {
-        /* Send data    */
-        SSPBUF  =   i2c_buff[i];
-        
-        /* Wait for buffer to be free or timeout */
-        timeout1    =   0UL;
-        while( ( SSPSTATbits.BF == 1U ) && ( timeout1 < 0x3232 ) )
-        {
-            timeout1++;
-        }
-        
-        /* Wait for data to be transmitted or timeout */
-        timeout1    =   0UL;
-        while ( ( PIR1bits.SSPIF  ==  0U ) && ( timeout1 < 0x3232 ) )
-        {
-            timeout1++;
-        }
-        PIR1bits.SSPIF  =  0U;
+        /* A stuck phase fails the transaction straight away  */
+        i2c_master_poll ();
     }
     
-    if ( i2c_generate_stop == I2C_STOP_BIT )
+    if ( xfer->status == I2C_MASTER_BUSY )
     {
-        /* Generate a STOP condition    */
-        SSPCON2bits.PEN =   1U;
-    
-        /* Wait until STOP condition is generated or timeout   */
-        timeout1    =   0UL;
-        while ( SSPCON2bits.PEN ==   1U && ( timeout1 < 0x3232 ) )
-        {
-            timeout1++;
-        }
-
-        /* Wait until STOP condition is completed or timeout   */
-        timeout1    =   0UL;
-        while ( ( PIR1bits.SSPIF  ==  0U ) && ( timeout1 < 0x323 ) )
-        {
-            timeout1++;
-        }
-        PIR1bits.SSPIF  =  0U;
+        /* Timeout: Release the bus  */
+        i2c_master_abort ();
     }
     
+    myI2C_status    =   xfer->status;
     
-	if ( timeout1 < 0x323 )
+    if ( xfer->status == I2C_MASTER_SUCCESS )
 	{
 		return I2C_SUCCESS;
 	}
@@ -0,0 +1,419 @@
+/**
+ * @brief       tc74_acq.c
+ * @details     TC74 acquisition state machine sources.
+ *
+ *              The bus time is estimated from the number of bits of every transaction at
+ *              I2C_MASTER_F_SCL. The savings are estimated against the old GetConfig spin loop,
+ *              which runs back-to-back read transactions for as long as the uC sleeps here.
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero (aqueronteblog@gmail.com)
+ * @date        18/October/2026
+ * @version     18/October/2026    The first error of a reading is kept ( tc74_acq_get_error() )
+ *              18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+#include "../inc/tc74_acq.h"
+
+
+/**@brief Constants.
+ */
+static const uint8_t myCmdRWCR  =   TC74_ACQ_CMD_RWCR;  /*!<   Command: Read configuration   */
+static const uint8_t myCmdRTR   =   TC74_ACQ_CMD_RTR;   /*!<   Command: Read temperature     */
+
+
+/**@brief Variables.
+ */
+static TC74_i2c_comm_t*             myComm;         /*!<   TC74 I2C interface                   */
+static tc74_acq_state_t             myAcqState;     /*!<   Acquisition state                    */
+static uint8_t                      myConfig;       /*!<   Configuration register read          */
+static uint8_t                      myRaw;          /*!<   Temperature register read            */
+static int8_t                       myTemperature;  /*!<   Last temperature ( C )               */
+static uint8_t                      myPolls;        /*!<   Data-ready checks                    */
+static uint16_t                     myBusBits;      /*!<   Bus bits used by the reading         */
+static volatile i2c_master_status_t myBatchStatus;  /*!<   First error of the I2C batch         */
+static tc74_acq_stats_t             myStats;        /*!<   Statistics of the last reading       */
+static tc74_acq_error_t             myError;        /*!<   First error of the reading           */
+static i2c_master_status_t          myErrorStatus;  /*!<   I2C status of TC74_ACQ_ERR_READ      */
+
+
+/**@brief Function prototypes.
+ */
+static void tc74_acq_done       ( i2c_master_status_t status, void* context );
+static void tc74_acq_standby    ( tc74_acq_state_t state );
+static void tc74_acq_error      ( tc74_acq_error_t error, i2c_master_status_t status );
+
+
+/**
+ * @brief       void tc74_acq_init ( TC74_i2c_comm_t* )
+ * @details     It resets the acquisition state machine.
+ *
+ *
+ * @param[in]    comm:      TC74 I2C interface.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         i2c_queue_init() must be called first.
+ * @warning     N/A
+ */
+void tc74_acq_init ( TC74_i2c_comm_t* comm )
+{
+    myComm          =   comm;
+    myAcqState      =   TC74_ACQ_IDLE;
+    myTemperature   =   0;
+    myPolls         =   0U;
+    myBusBits       =   0U;
+    myError         =   TC74_ACQ_ERR_NONE;
+    myErrorStatus   =   I2C_MASTER_SUCCESS;
+
+    myStats.polls           =   0U;
+    myStats.bus_us          =   0U;
+    myStats.saved_polls     =   0U;
+    myStats.saved_bus_us    =   0UL;
+}
+
+
+/**
+ * @brief       tc74_acq_state_t tc74_acq_start ( void )
+ * @details     It starts a new reading: the TC74 leaves standby and starts converting.
+ *
+ *
+ * @param[in]    N/A.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      TC74_ACQ_CONVERTING: The uC must sleep TC74_ACQ_WAIT_MS, TC74_ACQ_ERROR: I2C error
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         Peripheral interrupts must be enabled and the tick running.
+ * @warning     N/A
+ */
+tc74_acq_state_t tc74_acq_start ( void )
+{
+    myPolls         =   0U;
+    myBusBits       =   TC74_ACQ_WRITE_BITS;
+    myError         =   TC74_ACQ_ERR_NONE;
+    myErrorStatus   =   I2C_MASTER_SUCCESS;
+
+    if ( TC74_SetConfig ( myComm, CONFIG_STANDBY_NORMAL ) == TC74_SUCCESS )
+    {
+        myAcqState  =   TC74_ACQ_CONVERTING;
+    }
+    else
+    {
+        tc74_acq_error ( TC74_ACQ_ERR_START, I2C_MASTER_SUCCESS );
+        myAcqState  =   TC74_ACQ_ERROR;
+    }
+
+    return myAcqState;
+}
+
+
+/**
+ * @brief       tc74_acq_state_t tc74_acq_run ( void )
+ * @details     It must be called every time the uC wakes up after TC74_ACQ_WAIT_MS. The configuration
+ *              and the temperature are read in one I2C batch, so the data-ready check costs a single
+ *              bus access. The TC74 is sent back to standby when the reading is finished.
+ *
+ *
+ * @param[in]    N/A.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      TC74_ACQ_CONVERTING: Not ready yet, sleep again, TC74_ACQ_DONE: Temperature ready,
+ *              TC74_ACQ_ERROR: I2C error or data never ready
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         Peripheral interrupts must be enabled and the tick running.
+ * @warning     N/A
+ */
+tc74_acq_state_t tc74_acq_run ( void )
+{
+    i2c_master_status_t status  =   I2C_MASTER_SUCCESS;
+
+    if ( myAcqState != TC74_ACQ_CONVERTING )
+    {
+        return myAcqState;
+    }
+
+    /* Configuration + temperature, one batch ( repeated START, single STOP )   */
+    myBatchStatus   =   I2C_MASTER_SUCCESS;
+    myConfig        =   0U;
+    myRaw           =   0U;
+
+    status  =   i2c_queue_submit ( myComm->i2c.address, &myCmdRWCR, 1U, &myConfig, 1U, tc74_acq_done, NULL );
+    if ( status == I2C_MASTER_SUCCESS )
+    {
+        status  =   i2c_queue_submit ( myComm->i2c.address, &myCmdRTR,  1U, &myRaw,    1U, tc74_acq_done, NULL );
+    }
+    if ( status == I2C_MASTER_SUCCESS )
+    {
+        status  =   i2c_queue_run ();
+    }
+
+    if ( status != I2C_MASTER_SUCCESS )
+    {
+        tc74_acq_error ( TC74_ACQ_ERR_READ, status );
+        tc74_acq_standby ( TC74_ACQ_ERROR );
+        return myAcqState;
+    }
+
+    /* Wait until the batch is completed. A stuck phase fails it within I2C_MASTER_PHASE_TIMEOUT_MS   */
+    while ( i2c_queue_busy () == 1U )
+    {
+        i2c_master_poll ();
+    }
+
+    myPolls++;
+    myBusBits  +=   ( 2U * TC74_ACQ_READ_BITS );
+
+    if ( myBatchStatus != I2C_MASTER_SUCCESS )
+    {
+        tc74_acq_error ( TC74_ACQ_ERR_READ, myBatchStatus );
+        tc74_acq_standby ( TC74_ACQ_ERROR );
+    }
+    else if ( ( myConfig & TC74_ACQ_DATA_RDY_MSK ) == TC74_ACQ_DATA_RDY_MSK )
+    {
+        myTemperature   =   (int8_t)myRaw;
+        tc74_acq_standby ( TC74_ACQ_DONE );
+    }
+    else if ( myPolls >= TC74_ACQ_MAX_POLLS )
+    {
+        /* Timeout: The I2C batch was fine, the data never got ready  */
+        tc74_acq_error ( TC74_ACQ_ERR_NOT_READY, I2C_MASTER_SUCCESS );
+        tc74_acq_standby ( TC74_ACQ_ERROR );
+    }
+    else
+    {
+        /* Not ready yet, sleep again   */
+    }
+
+    return myAcqState;
+}
+
+
+/**
+ * @brief       tc74_acq_state_t tc74_acq_get_state ( void )
+ * @details     It returns the acquisition state.
+ *
+ *
+ * @param[in]    N/A.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      Acquisition state
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+tc74_acq_state_t tc74_acq_get_state ( void )
+{
+    return myAcqState;
+}
+
+
+/**
+ * @brief       int8_t tc74_acq_get_temperature ( void )
+ * @details     It returns the last temperature and sets the state machine idle.
+ *
+ *
+ * @param[in]    N/A.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      Temperature ( C )
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+int8_t tc74_acq_get_temperature ( void )
+{
+    myAcqState  =   TC74_ACQ_IDLE;
+
+    return myTemperature;
+}
+
+
+/**
+ * @brief       void tc74_acq_get_stats ( tc74_acq_stats_t* )
+ * @details     It returns the statistics of the last reading.
+ *
+ *
+ * @param[in]    N/A.
+ *
+ * @param[out]   stats:     Polls, bus time used and estimated savings.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+void tc74_acq_get_stats ( tc74_acq_stats_t* stats )
+{
+    *stats  =   myStats;
+}
+
+
+/**
+ * @brief       tc74_acq_error_t tc74_acq_get_error ( i2c_master_status_t* )
+ * @details     It returns the cause of TC74_ACQ_ERROR, the first error of the last reading.
+ *
+ *
+ * @param[in]    N/A.
+ *
+ * @param[out]   status:    I2C status of the failed batch ( TC74_ACQ_ERR_READ ), I2C_MASTER_SUCCESS otherwise.
+ *
+ *
+ * @return      Cause of the error, TC74_ACQ_ERR_NONE if the reading did not fail
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     TC74_ACQ_ERR_START and TC74_ACQ_ERR_STANDBY come from the blocking TC74_SetConfig(), its
+ *              I2C status is kept by the I2C read/write functions of the application.
+ */
+tc74_acq_error_t tc74_acq_get_error ( i2c_master_status_t* status )
+{
+    *status =   myErrorStatus;
+
+    return myError;
+}
+
+
+/**
+ * @brief       void tc74_acq_standby ( tc74_acq_state_t )
+ * @details     It sends the TC74 back to standby, ends the reading and updates the statistics.
+ *
+ *              A spin loop would have run one GetConfig every TC74_ACQ_READ_BITS bus bits during
+ *              the time the uC was sleeping ( myPolls x TC74_ACQ_WAIT_MS ).
+ *
+ *
+ * @param[in]    state:     Final state.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+static void tc74_acq_standby ( tc74_acq_state_t state )
+{
+    uint32_t    spin_polls;
+
+    if ( TC74_SetConfig ( myComm, CONFIG_STANDBY_STANDBY ) != TC74_SUCCESS )
+    {
+        tc74_acq_error ( TC74_ACQ_ERR_STANDBY, I2C_MASTER_SUCCESS );
+        state   =   TC74_ACQ_ERROR;
+    }
+    myBusBits  +=   TC74_ACQ_WRITE_BITS;
+
+    /* Statistics   */
+    spin_polls  =   ( (uint32_t)myPolls * TC74_ACQ_WAIT_MS * 1000UL ) / TC74_ACQ_BUS_US( TC74_ACQ_READ_BITS );
+
+    myStats.polls   =   myPolls;
+    myStats.bus_us  =   (uint16_t)TC74_ACQ_BUS_US( myBusBits );
+
+    if ( spin_polls > myPolls )
+    {
+        myStats.saved_polls     =   (uint16_t)( spin_polls - myPolls );
+        myStats.saved_bus_us    =   (uint32_t)myStats.saved_polls * TC74_ACQ_BUS_US( TC74_ACQ_READ_BITS );
+    }
+    else
+    {
+        myStats.saved_polls     =   0U;
+        myStats.saved_bus_us    =   0UL;
+    }
+
+    myAcqState  =   state;
+}
+
+
+/**
+ * @brief       void tc74_acq_error ( tc74_acq_error_t , i2c_master_status_t )
+ * @details     It keeps the first error of the reading.
+ *
+ *
+ * @param[in]    error:     Cause of the error.
+ * @param[in]    status:    I2C status ( TC74_ACQ_ERR_READ ).
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+static void tc74_acq_error ( tc74_acq_error_t error, i2c_master_status_t status )
+{
+    if ( myError == TC74_ACQ_ERR_NONE )
+    {
+        myError         =   error;
+        myErrorStatus   =   status;
+    }
+}
+
+
+/**
+ * @brief       void tc74_acq_done ( i2c_master_status_t , void* )
+ * @details     I2C job completion callback. It keeps the first error of the batch.
+ *
+ *
+ * @param[in]    status:    Job status.
+ * @param[in]    context:   N/A.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     It is called from the interrupt context.
+ */
+static void tc74_acq_done ( i2c_master_status_t status, void* context )
+{
+    (void)context;
+
+    if ( ( status != I2C_MASTER_SUCCESS ) && ( myBatchStatus == I2C_MASTER_SUCCESS ) )
+    {
+        myBatchStatus   =   status;
+    }
+}
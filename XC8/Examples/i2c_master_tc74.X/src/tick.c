@@ -0,0 +1,200 @@
+/**
+ * @brief       tick.c
+ * @details     Monotonic millisecond tick ( Timer2 ) sources.
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero (aqueronteblog@gmail.com)
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+#include "../inc/tick.h"
+
+
+/**@brief Variables.
+ */
+static volatile uint16_t myTickMs;      /*!<   Milliseconds counter, it is only written by the ISR    */
+
+
+/**
+ * @brief       void tick_init ( void )
+ * @details     It configures the Timer2 as the tick source. The timer is not started.
+ *
+ *              Timer2
+ *                  - TMR2 matches PR2 every TICK_PERIOD_MS
+ *                  - Prescaler and PR2 computed at compile time ( TICK_T2CKPS, TICK_PR2 )
+ *                  - Postscaler 1:1
+ *                  - Timer2 interrupt enabled
+ *
+ *
+ * @param[in]    N/A.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+void tick_init ( void )
+{
+    /* Stops Timer2 */
+    T2CONbits.TMR2ON    =   0U;
+
+    /* Prescaler */
+    T2CONbits.T2CKPS    =   TICK_T2CKPS;
+
+    /* 1:1 Postscaler */
+    T2CONbits.T2OUTPS   =   0b0000;
+
+    /* Timer2 matches every TICK_PERIOD_MS ( TMR2 = PR2 )  */
+    TMR2    =   0U;
+    PR2     =   (uint8_t)TICK_PR2;
+
+    /* Reset the counter    */
+    myTickMs    =   0U;
+
+    /* Clear Timer2 interrupt flag */
+    PIR1bits.TMR2IF =   0U;
+
+    /* Timer2 interrupt enabled */
+    PIE1bits.TMR2IE =   1U;
+}
+
+
+/**
+ * @brief       void tick_start ( void )
+ * @details     It starts the tick.
+ *
+ *
+ * @param[in]    N/A.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         Peripheral interrupts must be enabled for the counter to advance.
+ * @warning     N/A
+ */
+void tick_start ( void )
+{
+    T2CONbits.TMR2ON    =   1U;
+}
+
+
+/**
+ * @brief       void tick_stop ( void )
+ * @details     It stops the tick, the counter keeps its value. It must be called before SLEEP so no
+ *              pending Timer2 flag is left.
+ *
+ *
+ * @param[in]    N/A.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+void tick_stop ( void )
+{
+    T2CONbits.TMR2ON    =   0U;
+    PIR1bits.TMR2IF     =   0U;
+}
+
+
+/**
+ * @brief       uint16_t tick_get_ms ( void )
+ * @details     It returns the milliseconds counter ( it wraps around every ~65s ).
+ *
+ *              The 16-bit counter is read twice until both reads match, so no interrupt
+ *              masking is needed.
+ *
+ *
+ * @param[in]    N/A.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      Milliseconds counter
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+uint16_t tick_get_ms ( void )
+{
+    uint16_t ms =   0U;
+
+    do{
+        ms  =   myTickMs;
+    }while( ms != myTickMs );
+
+    return ms;
+}
+
+
+/**
+ * @brief       uint16_t tick_elapsed_ms ( uint16_t )
+ * @details     It returns the milliseconds elapsed since start ( wrap around safe ).
+ *
+ *
+ * @param[in]    start:     Value returned by tick_get_ms().
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      Elapsed milliseconds
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+uint16_t tick_elapsed_ms ( uint16_t start )
+{
+    return (uint16_t)( tick_get_ms () - start );
+}
+
+
+/**
+ * @brief       void tick_isr ( void )
+ * @details     Timer2 interrupt handler. It must be called from ISR() when TMR2IE and TMR2IF are set,
+ *              once TMR2IF is cleared.
+ *
+ *
+ * @param[in]    N/A.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+void tick_isr ( void )
+{
+    myTickMs    +=  TICK_PERIOD_MS;
+}
@@ -6,7 +6,8 @@
  *
  * @author      Manuel Caballero (aqueronteblog@gmail.com)
  * @date        17/February/2024
- * @version     17/February/2024    The ORIGIN
+ * @version     18/October/2026     Timer1 interrupt ( tickless scheduler )
+ *              17/February/2024    The ORIGIN
  * @pre         N/A
  * @warning     N/A
  */
@@ -14,6 +15,7 @@
 #define INTERRUPTS_H_
 
 #include "board.h"
+#include "tickless.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -22,7 +22,8 @@
  *
  * @author      Manuel Caballero
  * @date        17/February/2024
- * @version     17/February/2024   The ORIGIN
+ * @version     18/October/2026    Timer1 overflow, time base of the tickless scheduler
+ *              17/February/2024   The ORIGIN
  * @pre         N/A.
  * @warning     N/A
  */
@@ -38,4 +39,14 @@ void __interrupt() ISR ( void )
         /* Clear the interrupt flag   */
         IOCBFbits.IOCBF0 = 0U;
     }
+    
+    /* Check if Timer1 Overflow interrupt is enabled and Timer1 Overflow occurred */
+    if ( ( PIE1bits.TMR1IE == 1U  ) && ( PIR1bits.TMR1IF == 1U ) )
+    {        
+        /* Clear the interrupt flag   */
+        PIR1bits.TMR1IF = 0U;
+        
+        /* Time base of the tickless scheduler    */
+        tls_isr ();
+    }
 }
\ No newline at end of file
@@ -4,13 +4,18 @@
  * 
  *              Every time the switch S3 is pushed, D5 changes its state.
  * 
+ *              The switch is debounced by a one-shot task of the tickless scheduler ( tickless.h ): D5 only
+ *              changes if S3 is still pushed 30ms after the edge. Timer1 ( 32.768kHz crystal ) wakes the uC
+ *              up for that deadline only, there is no periodic wake-up.
+ * 
  *              The microcontroller is in SLEEP mode the rest of the time.
  *
  * @return      N/A
  *
  * @author      Manuel Caballero (aqueronteblog@gmail.com)
  * @date        17/February/2024
- * @version     17/February/2024    The ORIGIN
+ * @version     18/October/2026     Debounce by the tickless scheduler
+ *              17/February/2024    The ORIGIN
  * @pre         This project was tested on a PIC16F1937 using a PICDEM 2 Plus.
  * @warning     N/A
  * @pre         This code belongs to AqueronteBlog. 
@@ -50,15 +55,25 @@
 #include "../inc/board.h"
 #include "../inc/functions.h"
 #include "../inc/interrupts.h"
+#include "../inc/tickless.h"
 
 /**@brief Constants.
  */
+#define TASK_DEBOUNCE   0U          /*!<   S3 debounce task    */
 
 
 /**@brief Variables.
  */
 volatile uint8_t myState;
 
+/**@brief Function prototypes.
+ */
+static void debounce_task   ( void );
+
+static tls_task_t   myTasks[]   =   {
+    [TASK_DEBOUNCE] = { .run = debounce_task }
+};
+
 /**@brief Function for application main entry.
  */
 void main(void) {
@@ -68,27 +83,65 @@ void main(void) {
     
     /* Enable interrupts    */
     INTCONbits.IOCIE    =   1U; // Enable the interrupt-on-change
-    INTCONbits.PEIE     =   0U; // Disable all active peripheral interrupts
+    INTCONbits.PEIE     =   1U; // Enable all active peripheral interrupts ( Timer1 )
     INTCONbits.GIE      =   1U; // Enable all active interrupts
+    
+    /* Tickless scheduler: Timer1 and the 32.768kHz crystal */
+    tls_init ( &myTasks[0], sizeof( myTasks )/sizeof( myTasks[0] ) );
        
     /* Reset the variables  */
     myState =   0U;
     
     while ( 1U )
     {
-        /* Check if an interrupt is triggered by TMR2 or TMR6    */
+        /* Run the tasks which are due  */
+        tls_dispatch ();
+        
+        /* Sleep mode until the next deadline, unless an interrupt is pending */
+        INTCONbits.GIE  =   0U;
+        if ( myState == 0U )
+        {
+            tls_idle ();
+        }
+        INTCONbits.GIE  =   1U;
+        
+        /* Check if an interrupt is triggered by S3    */
         if ( myState != 0U )
         {
-            /* Change the state of D5 LED    */
-            LATB    ^=  D5;
+            /* Check S3 again in 30ms    */
+            tls_start ( &myTasks[TASK_DEBOUNCE], TLS_MS( 30U ), 0UL );
             
             /* Reset the variable  */
             myState =   0U;
         }
-        else
-        {
-            /* Sleep mode */
-            SLEEP();
-        }
+    }
+}
+
+
+
+/**
+ * @brief       void debounce_task ( void )
+ * @details     S3 debounce task, D5 changes its state if S3 is still pushed.
+ *
+ * @param[in]    N/A.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      N/A.
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026   The ORIGIN
+ * @pre         N/A
+ * @warning     N/A.
+ */
+static void debounce_task ( void )
+{
+    /* S3 is pushed: RB0 = 0    */
+    if ( ( PORTB & S3 ) == 0U )
+    {
+        /* Change the state of D5 LED    */
+        LATB    ^=  D5;
     }
 }
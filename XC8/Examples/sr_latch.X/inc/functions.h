@@ -6,7 +6,8 @@
  *
  * @author      Manuel Caballero (aqueronteblog@gmail.com)
  * @date        27/March/2024
- * @version     27/March/2024    The ORIGIN
+ * @version     18/October/2026  Timer4 is not used any more, software timers ( swtimer.h )
+ *              27/March/2024    The ORIGIN
  * @pre         N/A
  * @warning     N/A
  */
@@ -24,7 +25,6 @@ extern "C" {
  */
 void conf_clk       ( void );
 void conf_gpio      ( void );
-void conf_Timer4    ( void );
 void conf_sr_latch  ( void );
 
 
@@ -6,7 +6,8 @@
  *
  * @author      Manuel Caballero (aqueronteblog@gmail.com)
  * @date        27/March/2024
- * @version     27/March/2024    The ORIGIN
+ * @version     18/October/2026  Timer2 ticks the software timers ( swtimer.h )
+ *              27/March/2024    The ORIGIN
  * @pre         N/A
  * @warning     N/A
  */
@@ -14,6 +15,7 @@
 #define INTERRUPTS_H_
 
 #include "board.h"
+#include "swtimer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -22,6 +24,7 @@ extern "C" {
 
 /**@brief Subroutine prototypes.
  */
+void __interrupt() ISR ( void );
 
 
 /**@brief Constants.
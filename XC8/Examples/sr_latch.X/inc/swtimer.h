@@ -0,0 +1,109 @@
+/**
+ * @brief       swtimer.h
+ * @details     Software timers ( hashed timer wheel on Timer2 ) header.
+ *
+ *              Timer2 interrupts every SWT_TICK_MS and the ISR only counts the tick. The wheel is advanced
+ *              by swt_process() from the main loop, one slot per tick, and the callbacks of the expired
+ *              timers are called from there, so they can take their time and use any function.
+ *
+ *              A timer started for d ticks is linked into slot ( cursor + d ) % SWT_SLOTS with
+ *              rounds = ( d - 1 ) / SWT_SLOTS, the turns of the wheel left before it expires:
+ *
+ *                  - swt_start(), swt_stop(): O(1), doubly linked list of the slot.
+ *                  - swt_process(): O(1) per timer in the current slot. The timers with rounds left are
+ *                                   only decremented, none if every timeout is <= SWT_SLOTS ticks.
+ *
+ *              The timers ( swt_timer_t ) are allocated by the user ( static storage ), there is no limit on
+ *              the number of timers apart from the RAM. A periodic timer is restarted on the tick it expires,
+ *              so its period does not drift if swt_process() runs late. If swt_process() is not called for a
+ *              while the ticks are kept ( up to 255 ) and processed at once.
+ *
+ *              Example:
+ *
+ *                  static swt_timer_t  myDebounce;
+ *
+ *                  void debounce_cb ( swt_timer_t* timer ) { ... }
+ *
+ *                  swt_init    ();
+ *                  swt_start   ( &myDebounce, SWT_MS( 20U ), 0U, debounce_cb );
+ *
+ *                  while ( 1U ) { swt_process (); ... }
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero (aqueronteblog@gmail.com)
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         Timer2 is used by the module, Timer1/4/6 and the CCP modules are left free.
+ * @warning     Timer2 is clocked by F_OSC, the ticks do not run in SLEEP mode.
+ */
+#ifndef SWTIMER_H_
+#define SWTIMER_H_
+
+#include "board.h"
+#include "timer_calc.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**@brief Constants.
+ */
+#ifndef SWT_F_OSC
+#define SWT_F_OSC       1000000UL       /*!<   F_OSC set by conf_clk()    */
+#endif
+
+#ifndef SWT_TICK_MS
+#define SWT_TICK_MS     10U             /*!<   Tick period                */
+#endif
+
+#ifndef SWT_SLOTS_SHIFT
+#define SWT_SLOTS_SHIFT 4U              /*!<   SWT_SLOTS = 2^SWT_SLOTS_SHIFT    */
+#endif
+
+#define SWT_SLOTS       ( 1U << SWT_SLOTS_SHIFT )
+#define SWT_SLOTS_MASK  ( SWT_SLOTS - 1U )
+
+/**@brief Ticks for a given time in ms ( rounded up ).
+ */
+#define SWT_MS( ms )    ( (uint16_t)( ( (uint32_t)(ms) + ( SWT_TICK_MS - 1UL ) ) / SWT_TICK_MS ) )
+
+
+/**@brief Timer.
+ */
+typedef struct swt_timer swt_timer_t;
+
+typedef void ( *swt_cb_t )( swt_timer_t* timer );
+
+struct swt_timer{
+  swt_timer_t*  next;               /*!<   Next timer in the slot                                   */
+  swt_timer_t*  prev;               /*!<   Previous timer in the slot                               */
+  uint16_t      rounds;             /*!<   Turns of the wheel left                                  */
+  uint16_t      period;             /*!<   Ticks, 0: One-shot timer                                 */
+  swt_cb_t      cb;                 /*!<   Callback, called from swt_process()                      */
+  uint8_t       slot;               /*!<   Slot ( SWT_SLOTS: Expired ), valid if active             */
+  uint8_t       active;             /*!<   1: Running or expired and not dispatched yet             */
+};
+
+
+/**@brief Function prototypes.
+ */
+void     swt_init       ( void );
+void     swt_start      ( swt_timer_t* timer, uint16_t ticks, uint16_t period, swt_cb_t cb );
+void     swt_stop       ( swt_timer_t* timer );
+uint8_t  swt_active     ( const swt_timer_t* timer );
+void     swt_process    ( void );
+void     swt_isr        ( void );
+
+
+/**@brief Variables.
+ */
+
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* SWTIMER_H_ */
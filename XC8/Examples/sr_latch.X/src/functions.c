@@ -147,51 +147,3 @@ void conf_sr_latch ( void )
     /* SR Latch is ENABLED    */
     SRCON0bits.SRLEN    =   1U;
 }
-
-
-/**
- * @brief       void conf_Timer4 ( void )
- * @details     It configures the Timer4.
- *              
- *              TMR4_flag ( TMR4 = PR4 ) = ( 1/( f_Timer4_OSC/4 ) )Prescaler
- * 
- *              Timer4
- *                  - FOSC = 1MHz
- *                  - TMR2 overflows every 65.28ms
- *                  - PR4 = [ TMR4_flag / ( 4Prescaler( 1/f_Timer4_OSC ) ] = [ 65.28ms / ( 64*4( 1/1000000 ) ] = 255
- *                  - TMR4 Flag enabled every ~ 0.26s: 65.28ms*Postcaler = 65.28ms*4 ~ 0.26s
- *                  - Timer4 interrupt disabled
- * 
- * @param[in]    N/A.
- *
- * @param[out]   N/A.
- *
- *
- * @return      N/A
- *
- * @author      Manuel Caballero
- * @date        29/March/2024
- * @version     29/March/2024    The ORIGIN
- * @pre         Error = 100*( 0.26 - 0.26112 )/0.26 ~ 0.43%
- * @warning     N/A
- */
-void conf_Timer4 ( void )
-{
-    /* Stops Timer4 */
-    T4CONbits.TMR4ON   =  0U;
-        
-    /* Prescaler is 64 */
-    T4CONbits.T4CKPS   =  0b11;
-    
-    /* 1:4 Postscaler */
-    T4CONbits.T4OUTPS   =  0b0011;
-    
-    /* Timer4 overflows every 65.28ms ( TMR4 = PR4 )  */
-    PR4    =   255U;
-    
-    /* Clear Timer4 interrupt flag */
-    PIR3bits.TMR4IF   =   0U;
-    
-    /* Timer4 interrupt disabled */
-    PIE3bits.TMR4IE   =   0U;
-}
\ No newline at end of file
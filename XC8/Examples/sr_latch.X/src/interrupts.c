@@ -6,8 +6,36 @@
  *
  * @author      Manuel Caballero (aqueronteblog@gmail.com)
  * @date        27/March/2024
- * @version     27/March/2024    The ORIGIN
+ * @version     18/October/2026  Timer2 interrupt ( software timers )
+ *              27/March/2024    The ORIGIN
  * @pre         N/A
  * @warning     N/A
  */
-#include "../inc/interrupts.h"
\ No newline at end of file
+#include "../inc/interrupts.h"
+
+
+/**
+ * @brief       void ISR ()
+ * @details     Interrupt subroutine. 
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026   The ORIGIN
+ * @pre         N/A.
+ * @warning     N/A
+ */
+void __interrupt() ISR ( void )
+{
+    /* Check if Timer2 interrupt is enabled and TMR2 = PR2 occurred */
+    if ( ( PIE1bits.TMR2IE == 1U  ) && ( PIR1bits.TMR2IF == 1U ) )
+    {        
+        /* Clear the interrupt flag   */
+        PIR1bits.TMR2IF = 0U;
+        
+        /* One more tick for the software timers   */
+        swt_isr ();
+    }
+}
\ No newline at end of file
@@ -9,13 +9,15 @@
  *                  - S = 0, R = 1 --> Q = 0, #Q = 1.
  *              
  *              The SR Latch is controlled by software using the SRPS and SRPR bits in SRCON0 register.
- *              Both bits change their values by the Timer4 every 0.26s.
+ *              Both bits change their values every 0.26s by a software timer ( swtimer.h, Timer2 ticks every
+ *              10ms ), the callback is called from the main loop. Timer4 is left free.
  *
  * @return      N/A
  *
  * @author      Manuel Caballero (aqueronteblog@gmail.com)
  * @date        27/March/2024
- * @version     27/March/2024    The ORIGIN
+ * @version     18/October/2026  Software timer instead of the blocking delay_260ms() ( Timer4 )
+ *              27/March/2024    The ORIGIN
  * @pre         This project was tested on a PIC16F1937 using a PICDEM 2 Plus.
  * @warning     N/A
  * @pre         This code belongs to AqueronteBlog. 
@@ -55,52 +57,56 @@
 #include "../inc/board.h"
 #include "../inc/functions.h"
 #include "../inc/interrupts.h"
+#include "../inc/swtimer.h"
 
 /**@brief Constants.
  */
 
 /**@brief Variables.
  */
+static swt_timer_t  mySRtimer;      /* SR Latch, 0.26s                      */
+static uint8_t      myQ;            /* SR Latch state: 1: Q = 1, 0: Q = 0   */
 
 /**@brief Function prototypes.
  */
-/** Delay function.
-  */
-void delay_260ms ( void );
+static void sr_latch_toggle ( swt_timer_t* timer );
 
 /**@brief Function for application main entry.
  */
 void main(void) { 
     conf_clk        ();
     conf_gpio       ();
-    conf_Timer4     ();
     conf_sr_latch   ();
+    swt_init        ();
+    
+    /* SR Latch. Set = 1, Reset = 0 --> Q = 1, #Q = 0   */
+    SRCON0bits.SRPS =   1U;
+    SRCON0bits.SRPR =   0U;
+    myQ             =   1U;
        
-    /* Disable interrupts    */
-    INTCONbits.PEIE =   0U; // Disable all active peripheral interrupts
-    INTCONbits.GIE  =   0U; // Disable all active interrupts
+    /* Enable interrupts    */
+    INTCONbits.PEIE =   1U; // Enable all active peripheral interrupts
+    INTCONbits.GIE  =   1U; // Enable all active interrupts
+    
+    /* The SR Latch changes its state every 0.26s */
+    swt_start ( &mySRtimer, SWT_MS( 260U ), SWT_MS( 260U ), sr_latch_toggle );
        
     while ( 1U )
     {
-        /* SR Latch. Set = 1, Reset = 0 --> Q = 1, #Q = 0   */
-        SRCON0bits.SRPS =   1U;
-        SRCON0bits.SRPR =   0U;
-        delay_260ms ();
-        
-        /* SR Latch. Set = 0, Reset = 1 --> Q = 0, #Q = 1   */
-        SRCON0bits.SRPS =   0U;
-        SRCON0bits.SRPR =   1U;
-        delay_260ms ();
+        /* Dispatch the expired software timers    */
+        swt_process ();
     }
 }
 
 
 
 /**
- * @brief       void delay_260ms ( void )
- * @details     260ms delay function by Timer4 module (polling mode).
+ * @brief       void sr_latch_toggle ( swt_timer_t* )
+ * @details     Software timer callback, it changes the state of the SR Latch.
+ *
+ *              The state is kept in myQ, SRPS and SRPR are read as 0.
  *
- * @param[in]    N/A.
+ * @param[in]    timer: Expired software timer.
  *
  * @param[out]   N/A.
  *
@@ -108,22 +114,25 @@ void main(void) {
  * @return      N/A.
  *
  * @author      Manuel Caballero
- * @date        29/March/2024
- * @version     29/March/2024   The ORIGIN
+ * @date        18/October/2026
+ * @version     18/October/2026   The ORIGIN
  * @pre         N/A
  * @warning     N/A.
  */
-void delay_260ms ( void )
+static void sr_latch_toggle ( swt_timer_t* timer )
 {
-    /* Start timer4 */
-    T4CONbits.TMR4ON   =  1U;
-    
-    /* Check if Timer4 Overflow is triggered by polling */
-    while ( PIR3bits.TMR4IF == 0U );
-    
-    /* Clear the interrupt flag   */
-    PIR3bits.TMR4IF = 0U;
-    
-    /* Stop timer4 */
-    T4CONbits.TMR4ON   =  0U;
+    if ( myQ == 1U )
+    {
+        /* SR Latch. Set = 0, Reset = 1 --> Q = 0, #Q = 1   */
+        SRCON0bits.SRPS =   0U;
+        SRCON0bits.SRPR =   1U;
+        myQ             =   0U;
+    }
+    else
+    {
+        /* SR Latch. Set = 1, Reset = 0 --> Q = 1, #Q = 0   */
+        SRCON0bits.SRPS =   1U;
+        SRCON0bits.SRPR =   0U;
+        myQ             =   1U;
+    }
 }
@@ -0,0 +1,394 @@
+/**
+ * @brief       swtimer.c
+ * @details     Software timers ( hashed timer wheel on Timer2 ) sources.
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero (aqueronteblog@gmail.com)
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+#include "../inc/swtimer.h"
+
+
+/**@brief Constants.
+ */
+#define SWT_DUE     SWT_SLOTS       /*!<   List of the expired timers, not dispatched yet    */
+
+/**@brief Timer2: Prescaler, postscaler and PR2 for SWT_TICK_MS.
+ */
+TIMER_CALC_T2_DEFINE( SWT_T2, SWT_F_OSC/4UL, SWT_TICK_MS, 1000UL );
+
+
+/**@brief Variables.
+ */
+static swt_timer_t*     mySlot[SWT_SLOTS + 1U];     /*!<   Slots of the wheel and list of the expired timers   */
+static uint8_t          myCursor;                   /*!<   Current slot                                        */
+static volatile uint8_t myPending;                  /*!<   Ticks not processed yet ( ISR )                     */
+
+
+/**@brief Function prototypes.
+ */
+static void swt_link    ( swt_timer_t* timer, uint8_t slot );
+static void swt_unlink  ( swt_timer_t* timer );
+static void swt_arm     ( swt_timer_t* timer, uint16_t ticks );
+
+
+
+/**
+ * @brief       void swt_init ( void )
+ * @details     It configures the Timer2 as the tick source and starts it. Every timer is dropped.
+ *
+ *              Timer2
+ *                  - TMR2 matches PR2 every SWT_TICK_MS
+ *                  - Prescaler, postscaler and PR2 worked out at compile time ( TIMER_CALC_T2_DEFINE( SWT_T2, ... ) )
+ *                  - Timer2 interrupt enabled
+ *
+ *
+ * @param[in]    N/A.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         Peripheral interrupts must be enabled for the ticks to be counted.
+ * @warning     The timers started before swt_init() must not be used again without swt_start().
+ */
+void swt_init ( void )
+{
+    uint8_t i   =   0U;
+
+    /* Stops Timer2 */
+    T2CONbits.TMR2ON    =   0U;
+
+    /* Prescaler and postscaler */
+    T2CONbits.T2CKPS    =   SWT_T2_CKPS;
+    T2CONbits.T2OUTPS   =   SWT_T2_OUTPS;
+
+    /* Timer2 flag every SWT_TICK_MS ( TMR2 = PR2 )  */
+    TMR2    =   0U;
+    PR2     =   SWT_T2_PR;
+
+    /* Empty wheel  */
+    for ( i = 0U; i <= SWT_SLOTS; i++ )
+    {
+        mySlot[i]   =   NULL;
+    }
+
+    myCursor    =   0U;
+    myPending   =   0U;
+
+    /* Clear Timer2 interrupt flag */
+    PIR1bits.TMR2IF =   0U;
+
+    /* Timer2 interrupt enabled */
+    PIE1bits.TMR2IE =   1U;
+
+    /* Start Timer2 */
+    T2CONbits.TMR2ON    =   1U;
+}
+
+
+/**
+ * @brief       void swt_start ( swt_timer_t* , uint16_t , uint16_t , swt_cb_t )
+ * @details     It starts a timer, it is restarted if it is already running.
+ *
+ *
+ * @param[in]    timer:     Timer.
+ * @param[in]    ticks:     First timeout in ticks, SWT_MS(). 0 is taken as 1.
+ * @param[in]    period:    Period in ticks after the first timeout. 0: One-shot timer.
+ * @param[in]    cb:        Callback, called from swt_process() when the timer expires.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         It must not be called from an ISR.
+ * @warning     N/A
+ */
+void swt_start ( swt_timer_t* timer, uint16_t ticks, uint16_t period, swt_cb_t cb )
+{
+    swt_stop ( timer );
+
+    timer->period   =   period;
+    timer->cb       =   cb;
+
+    swt_arm ( timer, ticks );
+}
+
+
+/**
+ * @brief       void swt_stop ( swt_timer_t* )
+ * @details     It stops a timer. Nothing is done if it is not running.
+ *
+ *
+ * @param[in]    timer:     Timer.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         It must not be called from an ISR.
+ * @warning     N/A
+ */
+void swt_stop ( swt_timer_t* timer )
+{
+    if ( timer->active == 1U )
+    {
+        swt_unlink ( timer );
+        timer->active   =   0U;
+    }
+}
+
+
+/**
+ * @brief       uint8_t swt_active ( const swt_timer_t* )
+ * @details     It checks if a timer is running.
+ *
+ *
+ * @param[in]    timer:     Timer.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      1: Running, 0: Stopped or expired
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+uint8_t swt_active ( const swt_timer_t* timer )
+{
+    return timer->active;
+}
+
+
+/**
+ * @brief       void swt_process ( void )
+ * @details     It advances the wheel by the ticks counted since the last call and calls the callbacks of the
+ *              expired timers. It must be called from the main loop.
+ *
+ *              The expired timers are moved to a list first, so the callbacks can start or stop any timer,
+ *              the expired ones included.
+ *
+ *
+ * @param[in]    N/A.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    GIE is saved and restored around the tick count
+ *              18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+void swt_process ( void )
+{
+    swt_timer_t*    timer   =   NULL;
+    swt_timer_t*    next    =   NULL;
+    uint8_t         gie     =   0U;
+
+    while ( myPending != 0U )
+    {
+        /* One tick is consumed, the interrupt state of the caller is kept   */
+        gie             =   INTCONbits.GIE;
+        INTCONbits.GIE  =   0U;
+        myPending--;
+        INTCONbits.GIE  =   gie;
+
+        myCursor    =   (uint8_t)( ( myCursor + 1U ) & SWT_SLOTS_MASK );
+
+        /* Current slot: Expired timers to the due list, one turn less for the rest   */
+        for ( timer = mySlot[myCursor]; timer != NULL; timer = next )
+        {
+            next    =   timer->next;
+
+            if ( timer->rounds == 0U )
+            {
+                swt_unlink ( timer );
+                swt_link ( timer, SWT_DUE );
+            }
+            else
+            {
+                timer->rounds--;
+            }
+        }
+
+        /* Dispatch: periodic timers are restarted from this tick, then the callback is called    */
+        while ( mySlot[SWT_DUE] != NULL )
+        {
+            timer   =   mySlot[SWT_DUE];
+
+            swt_unlink ( timer );
+
+            if ( timer->period != 0U )
+            {
+                swt_arm ( timer, timer->period );
+            }
+            else
+            {
+                timer->active   =   0U;
+            }
+
+            if ( timer->cb != NULL )
+            {
+                timer->cb ( timer );
+            }
+        }
+    }
+}
+
+
+/**
+ * @brief       void swt_isr ( void )
+ * @details     Timer2 interrupt handler. It must be called from ISR() when TMR2IE and TMR2IF are set,
+ *              once TMR2IF is cleared.
+ *
+ *
+ * @param[in]    N/A.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     The tick is lost if 255 ticks are pending already.
+ */
+void swt_isr ( void )
+{
+    if ( myPending != 0xFFU )
+    {
+        myPending++;
+    }
+}
+
+
+
+/**
+ * @brief       void swt_link ( swt_timer_t* , uint8_t )
+ * @details     It links a timer at the head of a slot.
+ *
+ *
+ * @param[in]    timer:     Timer.
+ * @param[in]    slot:      Slot, SWT_DUE included.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         The timer must not be linked.
+ * @warning     N/A
+ */
+static void swt_link ( swt_timer_t* timer, uint8_t slot )
+{
+    timer->slot =   slot;
+    timer->prev =   NULL;
+    timer->next =   mySlot[slot];
+
+    if ( mySlot[slot] != NULL )
+    {
+        mySlot[slot]->prev  =   timer;
+    }
+
+    mySlot[slot]    =   timer;
+}
+
+
+/**
+ * @brief       void swt_unlink ( swt_timer_t* )
+ * @details     It unlinks a timer from its slot.
+ *
+ *
+ * @param[in]    timer:     Timer.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         The timer must be linked.
+ * @warning     N/A
+ */
+static void swt_unlink ( swt_timer_t* timer )
+{
+    if ( timer->prev != NULL )
+    {
+        timer->prev->next   =   timer->next;
+    }
+    else
+    {
+        mySlot[timer->slot] =   timer->next;
+    }
+
+    if ( timer->next != NULL )
+    {
+        timer->next->prev   =   timer->prev;
+    }
+
+    timer->next =   NULL;
+    timer->prev =   NULL;
+}
+
+
+/**
+ * @brief       void swt_arm ( swt_timer_t* , uint16_t )
+ * @details     It links a timer into the slot it expires in, ticks from the current one.
+ *
+ *
+ * @param[in]    timer:     Timer.
+ * @param[in]    ticks:     Timeout in ticks, 0 is taken as 1.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         The timer must not be linked.
+ * @warning     N/A
+ */
+static void swt_arm ( swt_timer_t* timer, uint16_t ticks )
+{
+    if ( ticks == 0U )
+    {
+        ticks   =   1U;
+    }
+
+    timer->rounds   =   (uint16_t)( ( ticks - 1U ) >> SWT_SLOTS_SHIFT );
+    timer->active   =   1U;
+
+    swt_link ( timer, (uint8_t)( ( myCursor + ticks ) & SWT_SLOTS_MASK ) );
+}
@@ -6,7 +6,9 @@
  *
  * @author      Manuel Caballero (aqueronteblog@gmail.com)
  * @date        31/January/2024
- * @version     31/January/2024    The ORIGIN
+ * @version     18/October/2026    Timer0 is configured by the tick service ( ptick.h )
+ *              18/October/2026    Timer0 settings worked out by timer_calc.h
+ *              31/January/2024    The ORIGIN
  * @pre         N/A
  * @warning     N/A
  */
@@ -24,10 +26,10 @@ extern "C" {
  */
 void conf_CLK       ( void );
 void conf_GPIO      ( void );
-void conf_Timer0    ( void );
 
 /**@brief Constants.
  */
+#define F_OSC   125000UL    /*!<   conf_CLK(): HFINTOSC = 125kHz, PTICK_F_CLK = F_OSC/4 ( ptick.h )    */
 
 
 
@@ -100,50 +100,4 @@ void conf_GPIO ( void )
     
     /* RA4 as an input pin */
     TRISA   |=  S2;
-}
-
-
-/**
- * @brief       void conf_Timer0 ( void )
- * @details     It configures the Timer0.
- *              
- *              Timer0_overflow = 4( 1/f_Timer0_OSC )( 256 - TMR0)Prescaler
- * 
- *              Timer0
- *                  - Overflow every 0.5s
- *                  - TMR0 = 256 - [ Timer0_overflow / ( Prescaler*4( 1/f_Timer0_OSC ) ] = 256 - [ 0.5 / ( 256*4( 1/125000 ) ] ~ 195
- *                  - Timer0 interrupt overflows enabled
- * 
- * @param[in]    N/A.
- *
- * @param[out]   N/A.
- *
- *
- * @return      N/A
- *
- * @author      Manuel Caballero
- * @date        31/January/2024
- * @version     31/January/2024    The ORIGIN
- * @pre         Error = 100*( 0.5079 0.5 )/0.5 = 1.58%
- * @warning     N/A
- */
-void conf_Timer0 ( void )
-{
-    /* Prescaler is assigned to the Timer0 module */
-    OPTION_REGbits.PSA   =  0U;
-    
-    /* Prescaler Rate Select bits: 256 */
-    OPTION_REGbits.PS   =  0b111;
-    
-    /* Internal instruction cycle clock (FOSC/4) */
-    OPTION_REGbits.TMR0CS   =  0U;
-    
-    /* Timer0 overflows every 0.5s  */
-    TMR0    =   195U;
-    
-    /* Clear Timer0 interrupt flag */
-    INTCONbits.TMR0IF   =   0U;
-    
-    /* Timer0 interrupt enabled */
-    INTCONbits.TMR0IE   =   1U;
 }
\ No newline at end of file
@@ -22,7 +22,9 @@
  *
  * @author      Manuel Caballero
  * @date        31/January/2024
- * @version     31/January/2024   The ORIGIN
+ * @version     18/October/2026   Timer0 is not reloaded any more, drift-free tick ( ptick_isr() )
+ *              18/October/2026   0.5s tick: Timer0 overflows added to a phase accumulator ( ptick.h )
+ *              31/January/2024   The ORIGIN
  * @pre         N/A.
  * @warning     N/A
  */
@@ -31,13 +33,13 @@ void __interrupt() ISR ( void )
     /* Check if Timer0 Overflow interrupt is enabled and Timer0 Overflow occurred */
     if ( ( INTCONbits.TMR0IE == 1U  ) && ( INTCONbits.TMR0IF == 1U ) )
     {        
-        /* Update the variable  */
-        myState =   1U;
-        
-        /* Reload Timer0, it overflows every 0.5s  */
-        TMR0    =   195U;
-        
         /* Clear the interrupt flag   */
         INTCONbits.TMR0IF = 0U;
+        
+        /* Update the variable every 0.5s ( free-running Timer0, phase accumulator )  */
+        if ( ptick_isr () == 1U )
+        {
+            myState =   1U;
+        }
     }
 }
\ No newline at end of file
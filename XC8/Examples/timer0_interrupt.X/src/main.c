@@ -4,12 +4,17 @@
  * 
  *              Timer0 will overflows every 500ms generating an interrupt, making D5 LED 
  *              change its state.
+ * 
+ *              Timer0 is free-running and the 500ms tick is kept by the tick service ( ptick.h ), so
+ *              the interrupt latency does not add any drift. The statistics ( myStats ) project the
+ *              drift a TMR0 reload would have over 24h ( myDrift24h, ms ).
  *
  * @return      N/A
  *
  * @author      Manuel Caballero (aqueronteblog@gmail.com)
  * @date        31/January/2024
- * @version     31/January/2024    The ORIGIN
+ * @version     18/October/2026    Drift-free tick ( ptick.h )
+ *              31/January/2024    The ORIGIN
  * @pre         This project was tested on a PIC16F1937 using a PICDEM 2 Plus.
  * @warning     N/A
  * @pre         The Timer0 interrupt cannot wake the processor from Sleep since the timer is frozen during Sleep
@@ -46,6 +51,7 @@
 #include "../inc/board.h"
 #include "../inc/functions.h"
 #include "../inc/interrupts.h"
+#include "../inc/ptick.h"
 
 /**@brief Constants.
  */
@@ -54,13 +60,15 @@
 /**@brief Variables.
  */
 volatile uint8_t myState;
+ptick_stats_t    myStats;       /* Tick statistics, check them with the debugger            */
+uint32_t         myDrift24h;    /* Drift of a TMR0 reload over 24h, ms ( projected )        */
 
 /**@brief Function for application main entry.
  */
 void main(void) {
     conf_CLK    ();
     conf_GPIO   ();
-    conf_Timer0 ();
+    ptick_init  ();
     
     
     /* Enable interrupts    */
@@ -78,6 +86,10 @@ void main(void) {
             /* Change the state of D5 LED    */
             LATB    ^=  D5;
             
+            /* Update the statistics    */
+            ptick_get_stats ( &myStats );
+            myDrift24h  =   ptick_drift_24h_ms ( &myStats );
+            
             /* Reset the variable  */
             myState =   0U;
         }
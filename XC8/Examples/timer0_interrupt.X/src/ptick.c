@@ -0,0 +1,250 @@
+/**
+ * @brief       ptick.c
+ * @details     Drift-free periodic tick ( Timer0 or Timer1 ) sources.
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero (aqueronteblog@gmail.com)
+ * @date        18/October/2026
+ * @version     18/October/2026    Timer0: Jitter budget checked at compile time ( PTICK_JITTER_MS )
+ *              18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+#include "../inc/ptick.h"
+
+
+/**@brief Constants.
+ */
+#if ( PTICK_TIMER == PTICK_TIMER0 )
+TIMER_CALC_ASSERT( ptick_t0, PTICK_COUNTS >= 256UL );                                           /*!<   One tick at most per overflow    */
+TIMER_CALC_ASSERT( ptick_jitter, PTICK_T0_OVF <= PTICK_JITTER_COUNTS );                         /*!<   Jitter within the budget         */
+#elif ( PTICK_TIMER == PTICK_TIMER1 )
+TIMER_CALC_ASSERT( ptick_t1, ( PTICK_COUNTS <= 65536UL ) && ( ( PTICK_COUNTS & 0xFFUL ) == 0UL ) );     /*!<   TMR1L reload = 0x00    */
+#else
+#error "PTICK_TIMER must be PTICK_TIMER0 or PTICK_TIMER1"
+#endif
+
+
+/**@brief Variables.
+ */
+#if ( PTICK_TIMER == PTICK_TIMER0 )
+static uint32_t         myPhase;        /*!<   Counts accumulated towards the next tick ( ISR )    */
+#endif
+static ptick_stats_t    myStats;        /*!<   Statistics ( ISR )                                  */
+
+
+/**
+ * @brief       void ptick_init ( void )
+ * @details     It configures and starts the timer of the tick service, the statistics are reset.
+ *
+ *              Timer0 ( PTICK_TIMER0 )
+ *                  - Internal instruction cycle clock ( F_OSC/4 )
+ *                  - Prescaler worked out at compile time ( PTICK_T0_PSA, PTICK_T0_PS )
+ *                  - Free-running, overflow every PTICK_T0_OVF counts
+ *                  - Timer0 interrupt enabled
+ *
+ *              Timer1 ( PTICK_TIMER1 )
+ *                  - Clock source as configured by the user
+ *                  - Prescaler 1:1
+ *                  - [TMR1H, TMR1L] = [PTICK_T1_TMR1H, 0x00], overflow every PTICK_COUNTS counts
+ *                  - Timer1 overflow interrupt enabled
+ *
+ *
+ * @param[in]    N/A.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         Peripheral interrupts ( PEIE, Timer1 ) and global interrupts must be enabled for the tick
+ *              to run.
+ * @warning     N/A
+ */
+void ptick_init ( void )
+{
+#if ( PTICK_TIMER == PTICK_TIMER0 )
+    /* Timer0 interrupt disabled    */
+    INTCONbits.TMR0IE   =   0U;
+
+    /* Internal instruction cycle clock ( F_OSC/4 )    */
+    OPTION_REGbits.TMR0CS   =   0U;
+
+    /* Prescaler   */
+    OPTION_REGbits.PSA  =   PTICK_T0_PSA;
+    OPTION_REGbits.PS   =   PTICK_T0_PS;
+
+    /* Reset the phase accumulator, Timer0 is not written again   */
+    myPhase =   0UL;
+    TMR0    =   0U;
+#else
+    /* Stop Timer1 */
+    T1CONbits.TMR1ON    =   0U;
+
+    /* Timer1 interrupt disabled    */
+    PIE1bits.TMR1IE =   0U;
+
+    /* 1:1 Prescale value, writing TMR1H/TMR1L does not lose any prescaler count   */
+    T1CONbits.T1CKPS    =   0b00;
+
+    /* Timer1 overflows every PTICK_COUNTS counts    */
+    TMR1H   =   PTICK_T1_TMR1H;
+    TMR1L   =   0x00U;
+#endif
+
+    /* Reset the statistics */
+    myStats.ticks       =   0UL;
+    myStats.latency_sum =   0UL;
+    myStats.latency_max =   0U;
+
+#if ( PTICK_TIMER == PTICK_TIMER0 )
+    /* Clear Timer0 interrupt flag and enable its interrupt  */
+    INTCONbits.TMR0IF   =   0U;
+    INTCONbits.TMR0IE   =   1U;
+#else
+    /* Clear Timer1 overflow flag and enable its interrupt   */
+    PIR1bits.TMR1IF =   0U;
+    PIE1bits.TMR1IE =   1U;
+
+    /* Start Timer1 */
+    T1CONbits.TMR1ON    =   1U;
+#endif
+}
+
+
+/**
+ * @brief       uint8_t ptick_isr ( void )
+ * @details     Timer interrupt handler. It must be called from ISR() when TMR0IF ( PTICK_TIMER0 ) or TMR1IF
+ *              ( PTICK_TIMER1 ) is set, once the flag is cleared.
+ *
+ *              Timer0: The counts of the overflow are added to the phase accumulator.
+ *              Timer1: The reload is added to TMR1H, the counts elapsed since the overflow are kept.
+ *
+ *
+ * @param[in]    N/A.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      1: A tick is due, 0: No tick yet
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+uint8_t ptick_isr ( void )
+{
+    uint16_t latency    =   0U;
+
+#if ( PTICK_TIMER == PTICK_TIMER0 )
+    /* Counts elapsed since the overflow ( prescaler resolution )   */
+    latency =   (uint16_t)( (uint16_t)TMR0 << PTICK_T0_K );
+
+    myPhase +=  PTICK_T0_OVF;
+
+    if ( myPhase < PTICK_COUNTS )
+    {
+        return 0U;
+    }
+
+    myPhase -=  PTICK_COUNTS;
+#else
+    uint8_t tmr1h   =   0U;
+    uint8_t tmr1l   =   0U;
+
+    /* Do not write TMR1H if TMR1L is about to carry   */
+    while ( TMR1L >= PTICK_T1_GUARD );
+
+    /* Counts elapsed since the overflow   */
+    tmr1l   =   TMR1L;
+    tmr1h   =   TMR1H;
+    latency =   (uint16_t)( ( (uint16_t)tmr1h << 8U ) | tmr1l );
+
+    /* Reload: TMR1L keeps counting    */
+    TMR1H   +=  PTICK_T1_TMR1H;
+#endif
+
+    /* Update the statistics    */
+    myStats.ticks++;
+    myStats.latency_sum +=  latency;
+
+    if ( latency > myStats.latency_max )
+    {
+        myStats.latency_max =   latency;
+    }
+
+    return 1U;
+}
+
+
+/**
+ * @brief       void ptick_get_stats ( ptick_stats_t* )
+ * @details     It gets a copy of the statistics.
+ *
+ *
+ * @param[in]    N/A.
+ *
+ * @param[out]   stats:     Statistics since ptick_init().
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     Interrupts are disabled during the copy.
+ */
+void ptick_get_stats ( ptick_stats_t* stats )
+{
+    uint8_t gie =   INTCONbits.GIE;
+
+    INTCONbits.GIE  =   0U;
+    *stats          =   myStats;
+    INTCONbits.GIE  =   gie;
+}
+
+
+/**
+ * @brief       uint32_t ptick_drift_24h_ms ( const ptick_stats_t* )
+ * @details     It projects the average latency of the statistics to a 24h run: The drift a clock based on
+ *              an overwriting reload would have, in ms.
+ *
+ *                  drift_24h = ( latency_sum / ticks ) * PTICK_MS_PER_COUNT_24H
+ *
+ *              The average is kept in 1/16 counts, so no 64-bit arithmetic is needed.
+ *
+ *
+ * @param[in]    stats:     Statistics, ptick_get_stats().
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      Projected drift in ms over 24h, 0 if there is no tick yet
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         latency_sum must be below 2^28 counts and 16*average*PTICK_MS_PER_COUNT_24H below 2^32.
+ * @warning     N/A
+ */
+uint32_t ptick_drift_24h_ms ( const ptick_stats_t* stats )
+{
+    uint32_t avg_q4 =   0UL;
+
+    if ( stats->ticks == 0UL )
+    {
+        return 0UL;
+    }
+
+    /* Average latency: 1/16 counts */
+    avg_q4  =   ( ( stats->latency_sum << 4U ) + ( stats->ticks >> 1U ) ) / stats->ticks;
+
+    return ( ( avg_q4 * PTICK_MS_PER_COUNT_24H ) + 8UL ) >> 4U;
+}
@@ -6,7 +6,9 @@
  *
  * @author      Manuel Caballero (aqueronteblog@gmail.com)
  * @date        09/February/2024
- * @version     09/February/2024    The ORIGIN
+ * @version     18/October/2026     The 0.5s period is set by the tick service ( ptick.h )
+ *              18/October/2026     Timer1 settings worked out by timer_calc.h
+ *              09/February/2024    The ORIGIN
  * @pre         N/A
  * @warning     N/A
  */
@@ -14,6 +16,7 @@
 #define FUNCTIONS_H_
 
 #include "board.h"
+#include "timer_calc.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -30,6 +33,11 @@ void conf_ccpm      ( void );
 
 /**@brief Constants.
  */
+#define F_T1OSC     32768UL     /*!<   Timer1 crystal oscillator ( T1OSI/T1OSO ) = 32.768kHz    */
+
+/**@brief Timer1: Start-up delay, 1/32s ( T1_START_xxx ).
+ */
+TIMER_CALC_T1_DEFINE( T1_START, F_T1OSC, 1UL, 32UL );
 
 
 
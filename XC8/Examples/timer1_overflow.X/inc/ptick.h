@@ -0,0 +1,143 @@
+/**
+ * @brief       ptick.h
+ * @details     Drift-free periodic tick ( Timer0 or Timer1 ) header.
+ *
+ *              Reloading the timer by overwriting it ( TMR0 = x ) or stopping, reloading and restarting it
+ *              loses every count elapsed since the overflow ( interrupt latency, main loop delay ) and,
+ *              for Timer0, the prescaler count as well. The error is added every period, so a clock based
+ *              on the tick drifts. The tick service never loses a count:
+ *
+ *                  - PTICK_TIMER0: Timer0 is never written, it is free-running. Every overflow adds
+ *                                  256*Prescaler counts to a phase accumulator and a tick is due when it
+ *                                  reaches PTICK_COUNTS ( the remainder is kept ). The prescaler is the
+ *                                  largest one with an overflow no longer than the period ( one tick at
+ *                                  most per overflow ) and than the jitter budget ( PTICK_JITTER_MS ).
+ *                                  Jitter: One overflow ( PTICK_T0_OVF ), no drift. A lower budget means
+ *                                  more interrupts: 0.5s at 31.25kHz, 50ms budget -> 1:4, an overflow
+ *                                  every 32.8ms ( the period alone would give 1:32, 262ms of jitter ).
+ *
+ *                  - PTICK_TIMER1: Timer1 keeps running and the reload is added to TMR1H ( TMR1H += x )
+ *                                  while TMR1L keeps counting. PTICK_COUNTS must be a multiple of 256, the
+ *                                  reload waits if TMR1L is about to carry ( PTICK_T1_GUARD ) so the
+ *                                  addition is safe for any latency shorter than the period. No jitter,
+ *                                  no drift.
+ *
+ *              The only error left is the rounding of PTICK_COUNTS ( PTICK_QUANT_PPM, 0ppm for 0.5s at
+ *              31.25kHz or 32.768kHz ) plus the clock source tolerance.
+ *
+ *              Statistics ( ptick_get_stats() ): The counts elapsed since the overflow are measured at
+ *              every tick. They are the counts an overwriting reload would have lost, ptick_drift_24h_ms()
+ *              projects them to a 24h run:
+ *
+ *                  drift_24h = ( latency_sum / ticks ) * PTICK_TICKS_24H / PTICK_F_CLK
+ *
+ *              Example: PTICK_TIMER1, 0.5s at 32.768kHz, 20 counts of latency on average ( ~610us, the
+ *              wake-up from SLEEP plus the ISR ) are 105s/day of drift with the old reload, 0s with
+ *              the tick service.
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero (aqueronteblog@gmail.com)
+ * @date        18/October/2026
+ * @version     18/October/2026    Timer0 prescaler capped by the jitter budget ( PTICK_JITTER_MS )
+ *              18/October/2026    The ORIGIN
+ * @pre         Timer1: The clock source ( crystal on T1OSI/T1OSO ) must be configured and stable before
+ *              ptick_init() is called. It must be slow compared to F_OSC/4 ( e.g. 32.768kHz ).
+ * @warning     The timer is owned by the tick service, it must not be written by anybody else.
+ */
+#ifndef PTICK_H_
+#define PTICK_H_
+
+#include "board.h"
+#include "timer_calc.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**@brief Constants.
+ */
+#define PTICK_TIMER0        0U              /*!<   Timer0, F_OSC/4                          */
+#define PTICK_TIMER1        1U              /*!<   Timer1, any clock source, Prescaler 1    */
+
+#ifndef PTICK_TIMER
+#define PTICK_TIMER         PTICK_TIMER1    /*!<   Timer used by the tick service           */
+#endif
+
+#ifndef PTICK_F_CLK
+#define PTICK_F_CLK         32768UL         /*!<   Timer clock: T1OSC crystal = 32.768kHz   */
+#endif
+
+#ifndef PTICK_NUM
+#define PTICK_NUM           1UL             /*!<   Period = PTICK_NUM/PTICK_DEN seconds     */
+#endif
+
+#ifndef PTICK_DEN
+#define PTICK_DEN           2UL
+#endif
+
+#ifndef PTICK_JITTER_MS
+#define PTICK_JITTER_MS     50UL            /*!<   Timer0: Jitter budget, ms ( one overflow at most )   */
+#endif
+
+#define PTICK_COUNTS        TIMER_CALC_COUNTS( PTICK_F_CLK, PTICK_NUM, PTICK_DEN )      /*!<   Timer counts per tick    */
+#define PTICK_TICKS_24H     ( ( 86400UL * PTICK_DEN ) / PTICK_NUM )                      /*!<   Ticks in 24h             */
+
+/**@brief Rounding error of PTICK_COUNTS in ppm, it is the only drift of the tick service.
+ */
+#define PTICK_QUANT_PPM     ( ( ( ( ( PTICK_COUNTS * PTICK_DEN ) > ( PTICK_F_CLK * PTICK_NUM ) ) ? ( ( PTICK_COUNTS * PTICK_DEN ) - ( PTICK_F_CLK * PTICK_NUM ) ) : \
+                                                                                                 ( ( PTICK_F_CLK * PTICK_NUM ) - ( PTICK_COUNTS * PTICK_DEN ) ) ) * 1000000UL ) / ( PTICK_F_CLK * PTICK_NUM ) )
+
+/**@brief Drift in ms over 24h for 1 count lost every tick.
+ */
+#define PTICK_MS_PER_COUNT_24H  ( ( ( PTICK_TICKS_24H * 1000UL ) + ( PTICK_F_CLK / 2UL ) ) / PTICK_F_CLK )
+
+/**@brief Timer0: Jitter budget in counts and the longest overflow allowed, the lower of the period and the budget.
+ */
+#define PTICK_JITTER_COUNTS ( ( PTICK_F_CLK * PTICK_JITTER_MS ) / 1000UL )
+#define PTICK_T0_LIMIT      ( ( PTICK_JITTER_COUNTS < PTICK_COUNTS ) ? PTICK_JITTER_COUNTS : PTICK_COUNTS )
+
+/**@brief Timer0: Prescaler 2^PTICK_T0_K, the largest one with 256*Prescaler <= PTICK_T0_LIMIT.
+ */
+#define PTICK_T0_K          ( ( PTICK_T0_LIMIT >= 65536UL ) ? 8U : ( PTICK_T0_LIMIT >= 32768UL ) ? 7U : ( PTICK_T0_LIMIT >= 16384UL ) ? 6U : \
+                              ( PTICK_T0_LIMIT >= 8192UL ) ? 5U : ( PTICK_T0_LIMIT >= 4096UL ) ? 4U : ( PTICK_T0_LIMIT >= 2048UL ) ? 3U : \
+                              ( PTICK_T0_LIMIT >= 1024UL ) ? 2U : ( PTICK_T0_LIMIT >= 512UL ) ? 1U : 0U )
+#define PTICK_T0_PRESC      ( 1UL << PTICK_T0_K )
+#define PTICK_T0_PSA        ( ( PTICK_T0_K == 0U ) ? 1U : 0U )
+#define PTICK_T0_PS         ( ( PTICK_T0_K == 0U ) ? 0U : ( PTICK_T0_K - 1U ) )
+#define PTICK_T0_OVF        ( 256UL * PTICK_T0_PRESC )                                   /*!<   Counts per overflow    */
+
+/**@brief Timer1: TMR1H reload ( TMR1L = 0x00 ).
+ */
+#define PTICK_T1_TMR1H      ( (uint8_t)( ( 65536UL - PTICK_COUNTS ) >> 8U ) )
+#define PTICK_T1_GUARD      0xFCU           /*!<   TMR1H is not written while TMR1L >= PTICK_T1_GUARD    */
+
+
+/**@brief Statistics.
+ */
+typedef struct{
+  uint32_t  ticks;                  /*!<   Ticks since ptick_init()                                             */
+  uint32_t  latency_sum;            /*!<   Counts elapsed since the overflow, sum of every tick                 */
+  uint16_t  latency_max;            /*!<   Counts elapsed since the overflow, worst case                        */
+} ptick_stats_t;
+
+
+/**@brief Function prototypes.
+ */
+void     ptick_init             ( void );
+uint8_t  ptick_isr              ( void );
+void     ptick_get_stats        ( ptick_stats_t* stats );
+uint32_t ptick_drift_24h_ms     ( const ptick_stats_t* stats );
+
+
+/**@brief Variables.
+ */
+
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* PTICK_H_ */
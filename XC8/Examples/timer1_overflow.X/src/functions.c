@@ -129,12 +129,10 @@ void conf_gpio ( void )
  *               TMR1_flag = ( ( 65536 - TMR1 )/( f_Timer1_OSC ) )Prescaler
  * 
  *              Timer1
- *                  - TMR1 overflows every 0.5s
- *                  - 1:1 Prescale
  *                  - Crystal oscillator on T1OSI/T1OSO pins = 32.768kHz
- *                  - [TMR1H, TMR1L] = [ TMR1_flag / ( Prescaler( 1/f_Timer2_OSC ) ] = 65536 - [ 0.5 / ( 1( 1/32.768kHz ) ] = 49152 (0xC000) [TMR1H = 0xC0, TMR1L = 0x00]
- *                  - Timer1 overflow interrupt enable
- *                  - Stabilization for Timer1 external crystal is done
+ *                  - Stabilization for Timer1 external crystal is done ( 1/32s, T1_START_xxx )
+ *                  - Timer1 is left stopped, the 0.5s period is set by the tick service, ptick_init():
+ *                    1:1 Prescale, [TMR1H, TMR1L] = 65536 - [ 0.5 / ( 1( 1/32.768kHz ) ] = 49152 (0xC000) [TMR1H = 0xC0, TMR1L = 0x00]
  * 
  * @param[in]    N/A.
  *
@@ -145,7 +143,9 @@ void conf_gpio ( void )
  *
  * @author      Manuel Caballero
  * @date        11/April/2024
- * @version     11/April/2024    The ORIGIN
+ * @version     18/October/2026  The period is set by the tick service ( ptick.h )
+ *              18/October/2026  Prescaler and TMR1 worked out by timer_calc.h
+ *              11/April/2024    The ORIGIN
  * @pre         N/A 
  * @warning     N/A
  */
@@ -160,15 +160,15 @@ void conf_timer1 ( void )
     /* Dedicated Timer1 oscillator circuit enabled   */
     T1CONbits.T1OSCEN    =   1U;
     
-    /* Timer1 1:1 Prescale value   */
-    T1CONbits.T1CKPS    =   0b00;
+    /* Timer1 Prescale value   */
+    T1CONbits.T1CKPS    =   T1_START_CKPS;
     
     /* Do not synchronize external clock input   */
     T1CONbits.nT1SYNC    =   1U;
     
-    /* Delay to ensure a safe start-up and stabilization     */
-    TMR1H   =   0xFC;
-    TMR1L   =   0x00;
+    /* Delay to ensure a safe start-up and stabilization ( 1/32s )     */
+    TMR1H   =   T1_START_TMR1H;
+    TMR1L   =   T1_START_TMR1L;
        
     /* Clear Timer1 overflow flag   */
     PIR1bits.TMR1IF =   0U;
@@ -185,13 +185,6 @@ void conf_timer1 ( void )
     /* Stop Timer1 */
     T1CONbits.TMR1ON    =   0U;
     
-    /* Timer1 overflows every 0.5s  */
-    TMR1H   =   0xC0;
-    TMR1L   =   0x00;
-    
     /* Clear Timer1 overflow flag   */
     PIR1bits.TMR1IF =   0U;
-    
-    /* Interrupt Timer1 overflow enabled   */
-    PIE1bits.TMR1IE =   1U;
 }
\ No newline at end of file
@@ -22,7 +22,8 @@
  *
  * @author      Manuel Caballero
  * @date        09/February/2024
- * @version     09/February/2024   The ORIGIN
+ * @version     18/October/2026    Timer1 reloaded in the ISR without losing counts ( ptick_isr() )
+ *              09/February/2024   The ORIGIN
  * @pre         N/A.
  * @warning     N/A
  */
@@ -31,10 +32,13 @@ void __interrupt() ISR ( void )
     /* Check if Timer1 Overflow interrupt is enabled and Timer1 Overflow occurred */
     if ( ( PIE1bits.TMR1IE == 1U  ) && ( PIR1bits.TMR1IF == 1U ) )
     {        
-        /* Update the variable  */
-        myFlag  =   1U;
-        
         /* Clear the interrupt flag   */
         PIR1bits.TMR1IF = 0U;
+        
+        /* Reload Timer1 ( TMR1H += 0xC0 ), it overflows every 0.5s  */
+        if ( ptick_isr () == 1U )
+        {
+            myFlag  =   1U;
+        }
     }
 }
\ No newline at end of file
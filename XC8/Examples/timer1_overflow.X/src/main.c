@@ -7,11 +7,18 @@
  * 
  *              The microcontroller is in sleep mode the rest of the time.
  * 
+ *              Timer1 is never stopped, the reload is added to TMR1H in the ISR by the tick service
+ *              ( ptick.h ), so neither the wake-up, the interrupt latency nor the main loop add any
+ *              drift. The statistics ( myStats ) project the drift the former stop/reload/restart
+ *              would have over 24h ( myDrift24h, ms ).
+ * 
  * @return      N/A
  *
  * @author      Manuel Caballero (aqueronteblog@gmail.com)
  * @date        11/April/2024
- * @version     11/April/2024    The ORIGIN
+ * @version     18/October/2026  Drift-free tick ( ptick.h )
+ *              18/October/2026  TMR1 reload worked out by timer_calc.h
+ *              11/April/2024    The ORIGIN
  * @pre         This project was tested on a PIC16F1937 using a PICDEM 2 Plus.
  * @warning     N/A
  * @pre         This code belongs to AqueronteBlog. 
@@ -51,6 +58,7 @@
 #include "../inc/board.h"
 #include "../inc/functions.h"
 #include "../inc/interrupts.h"
+#include "../inc/ptick.h"
 
 /**@brief Constants.
  */
@@ -59,6 +67,8 @@
 /**@brief Variables.
  */
 volatile uint8_t    myFlag;         /* Flag that indicates either if the Timer overflows    */
+ptick_stats_t       myStats;        /* Tick statistics, check them with the debugger        */
+uint32_t            myDrift24h;     /* Drift of the former reload over 24h, ms ( projected ) */
 
 /**@brief Function prototypes.
  */
@@ -78,28 +88,22 @@ void main(void) {
     /* Reset variables  */
     myFlag  =   0U;
     
-    /* Start Timer1 */
-    T1CONbits.TMR1ON   =  1U;
+    /* Start Timer1, it overflows every 0.5s  */
+    ptick_init ();
         
     while ( 1U )
     {
         if ( myFlag ==  1U )
         {
-            /* Stop Timer1 */
-            T1CONbits.TMR1ON   =  0U;
-            
             /* Change the D5 LED state  */
             LATB    ^=  D5;
             
-            /* Timer1 overflows every 0.5s  */
-            TMR1H   =   0xC0;
-            TMR1L   =   0x00;
+            /* Update the statistics    */
+            ptick_get_stats ( &myStats );
+            myDrift24h  =   ptick_drift_24h_ms ( &myStats );
     
             /* Clear flag   */
             myFlag  =   0U;
-            
-            /* Start Timer1 */
-            T1CONbits.TMR1ON   =  1U;
         }
         else
         {
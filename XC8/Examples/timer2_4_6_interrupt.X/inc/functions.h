@@ -6,7 +6,9 @@
  *
  * @author      Manuel Caballero (aqueronteblog@gmail.com)
  * @date        09/February/2024
- * @version     09/February/2024    The ORIGIN
+ * @version     18/October/2026     Timer2 is configured by the software timers ( swtimer.h )
+ *              18/October/2026     Timer2/4/6 settings worked out by timer_calc.h
+ *              09/February/2024    The ORIGIN
  * @pre         N/A
  * @warning     N/A
  */
@@ -24,12 +26,10 @@ extern "C" {
  */
 void conf_CLK       ( void );
 void conf_GPIO      ( void );
-void conf_Timer2    ( void );
-void conf_Timer4    ( void );
-void conf_Timer6    ( void );
 
 /**@brief Constants.
  */
+#define F_OSC   125000UL    /*!<   conf_CLK(): HFINTOSC = 125kHz, SWT_F_OSC ( swtimer.h )    */
 
 
 
@@ -6,7 +6,8 @@
  *
  * @author      Manuel Caballero (aqueronteblog@gmail.com)
  * @date        09/February/2024
- * @version     09/February/2024    The ORIGIN
+ * @version     18/October/2026     Timer2 ticks the software timers ( swtimer.h )
+ *              09/February/2024    The ORIGIN
  * @pre         N/A
  * @warning     N/A
  */
@@ -14,6 +15,7 @@
 #define INTERRUPTS_H_
 
 #include "board.h"
+#include "swtimer.h"
 
 #ifdef __cplusplus
 extern "C" {
@@ -32,7 +34,6 @@ void __interrupt() ISR ( void );
 
 /**@brief Variables.
  */
-extern volatile uint8_t myState;
 
 
 #ifdef __cplusplus
@@ -0,0 +1,210 @@
+/**
+ * @brief       timer_calc.h
+ * @details     Compile-time timer period calculator header ( PIC16F1937: Timer0, Timer1, Timer2/4/6 ).
+ *
+ *              The period is given as a fraction of a second, num/den ( e.g. 1, 2 for 0.5s ), and the
+ *              clock of the timer in Hz:
+ *
+ *                  counts = round( f_clk * num / den )
+ *
+ *                  - Timer0:     counts = Prescaler*( 256 - TMR0 ), Prescaler: 1 ( PSA = 1 ), 2 to 256
+ *                  - Timer1:     counts = Prescaler*( 65536 - TMR1 ), Prescaler: 1, 2, 4, 8
+ *                  - Timer2/4/6: counts = Prescaler*Postscaler*( PR + 1 ), Prescaler: 1, 4, 16, 64,
+ *                                Postscaler: 1 to 16
+ *
+ *              TIMER_CALC_Tx_DEFINE( name, ... ) tries every prescaler ( and postscaler ) combination
+ *              and keeps the one with the lowest error, ties go to the smallest prescaler/postscaler.
+ *              The search is unrolled into the enumerators of name, so it is done by the compiler and
+ *              nothing is computed at run time. The build fails ( negative array size ) if the period
+ *              cannot be reached.
+ *
+ *              Example: Timer2, 0.5s at F_OSC = 125kHz ( f_clk = F_OSC/4 )
+ *
+ *                  TIMER_CALC_T2_DEFINE( myT2, 125000UL/4UL, 1UL, 2UL );
+ *
+ *                  T2CONbits.T2CKPS    =   myT2_CKPS;
+ *                  T2CONbits.T2OUTPS   =   myT2_OUTPS;
+ *                  PR2                 =   myT2_PR;
+ *
+ *              Result: Prescaler 1:4, Postscaler 1:16, PR2 = 243 ( 15616 counts, 0.49971s ).
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero (aqueronteblog@gmail.com)
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         f_clk * num must fit in 32 bits.
+ * @warning     N/A
+ */
+#ifndef TIMER_CALC_H_
+#define TIMER_CALC_H_
+
+#include "board.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+
+/**@brief Constants.
+ */
+#define TIMER_CALC_NONE     0x7FFF      /*!<   Error of a combination which does not fit    */
+
+/**@brief Timer counts for a period of num/den seconds ( rounded ).
+ */
+#define TIMER_CALC_COUNTS( f_clk, num, den )    ( ( ( (uint32_t)(f_clk) * (uint32_t)(num) ) + ( (uint32_t)(den) / 2UL ) ) / (uint32_t)(den) )
+
+/**@brief Timer ticks ( rounded ) for a divider d, and their error in counts ( TIMER_CALC_NONE if ticks is not 1 to max ).
+ */
+#define TIMER_CALC_TICKS( n, d )                ( ( (n) + ( (uint32_t)(d) / 2UL ) ) / (uint32_t)(d) )
+#define TIMER_CALC_ERR( n, d, max )             ( ( ( TIMER_CALC_TICKS( n, d ) == 0UL ) || ( TIMER_CALC_TICKS( n, d ) > (max) ) ) ? TIMER_CALC_NONE : \
+                                                  (int)( ( (n) > ( (uint32_t)(d) * TIMER_CALC_TICKS( n, d ) ) ) ? ( (n) - ( (uint32_t)(d) * TIMER_CALC_TICKS( n, d ) ) ) : \
+                                                                                                          ( ( (uint32_t)(d) * TIMER_CALC_TICKS( n, d ) ) - (n) ) ) )
+
+/**@brief Search step k: error of the candidate, lowest error and best candidate so far.
+ */
+#define TIMER_CALC_FIRST( name, err )           name##_e0 = (err), name##_m0 = name##_e0, name##_c0 = 0
+#define TIMER_CALC_STEP( name, k, prev, err )   name##_e##k = (err), \
+                                                name##_m##k = ( name##_e##k < name##_m##prev ) ? name##_e##k : name##_m##prev, \
+                                                name##_c##k = ( name##_e##k < name##_m##prev ) ? k : name##_c##prev
+
+/**@brief Build error if cond is 0.
+ */
+#define TIMER_CALC_ASSERT( name, cond )         typedef char name##_unreachable[ ( cond ) ? 1 : -1 ]
+
+
+/**@brief Timer0, f_clk = F_OSC/4: name_PSA, name_PS ( OPTION_REG ) and name_TMR0 ( the overflow happens after 256 - TMR0 counts ).
+ *        Candidate k: Prescaler 2^k.
+ */
+#define TIMER_CALC_T0_DEFINE( name, f_clk, num, den )   \
+    enum{ \
+        TIMER_CALC_FIRST( name, TIMER_CALC_ERR( TIMER_CALC_COUNTS( f_clk, num, den ), 1UL, 256UL ) ), \
+        TIMER_CALC_STEP( name, 1, 0, TIMER_CALC_ERR( TIMER_CALC_COUNTS( f_clk, num, den ), 2UL, 256UL ) ), \
+        TIMER_CALC_STEP( name, 2, 1, TIMER_CALC_ERR( TIMER_CALC_COUNTS( f_clk, num, den ), 4UL, 256UL ) ), \
+        TIMER_CALC_STEP( name, 3, 2, TIMER_CALC_ERR( TIMER_CALC_COUNTS( f_clk, num, den ), 8UL, 256UL ) ), \
+        TIMER_CALC_STEP( name, 4, 3, TIMER_CALC_ERR( TIMER_CALC_COUNTS( f_clk, num, den ), 16UL, 256UL ) ), \
+        TIMER_CALC_STEP( name, 5, 4, TIMER_CALC_ERR( TIMER_CALC_COUNTS( f_clk, num, den ), 32UL, 256UL ) ), \
+        TIMER_CALC_STEP( name, 6, 5, TIMER_CALC_ERR( TIMER_CALC_COUNTS( f_clk, num, den ), 64UL, 256UL ) ), \
+        TIMER_CALC_STEP( name, 7, 6, TIMER_CALC_ERR( TIMER_CALC_COUNTS( f_clk, num, den ), 128UL, 256UL ) ), \
+        TIMER_CALC_STEP( name, 8, 7, TIMER_CALC_ERR( TIMER_CALC_COUNTS( f_clk, num, den ), 256UL, 256UL ) ), \
+        name##_PRESC    = ( 1 << name##_c8 ), \
+        name##_PSA      = ( name##_c8 == 0 ) ? 1 : 0, \
+        name##_PS       = ( name##_c8 == 0 ) ? 0 : ( name##_c8 - 1 ), \
+        name##_TMR0     = (int)( 256UL - TIMER_CALC_TICKS( TIMER_CALC_COUNTS( f_clk, num, den ), ( 1UL << name##_c8 ) ) ), \
+        name##_ERROR    = name##_m8 \
+    }; \
+    TIMER_CALC_ASSERT( name, name##_m8 != TIMER_CALC_NONE )
+
+
+/**@brief Timer1: name_CKPS ( T1CON ), name_TMR1H and name_TMR1L ( the overflow happens after 65536 - TMR1 counts ).
+ *        Candidate k: Prescaler 2^k.
+ */
+#define TIMER_CALC_T1_DEFINE( name, f_clk, num, den )   \
+    enum{ \
+        TIMER_CALC_FIRST( name, TIMER_CALC_ERR( TIMER_CALC_COUNTS( f_clk, num, den ), 1UL, 65536UL ) ), \
+        TIMER_CALC_STEP( name, 1, 0, TIMER_CALC_ERR( TIMER_CALC_COUNTS( f_clk, num, den ), 2UL, 65536UL ) ), \
+        TIMER_CALC_STEP( name, 2, 1, TIMER_CALC_ERR( TIMER_CALC_COUNTS( f_clk, num, den ), 4UL, 65536UL ) ), \
+        TIMER_CALC_STEP( name, 3, 2, TIMER_CALC_ERR( TIMER_CALC_COUNTS( f_clk, num, den ), 8UL, 65536UL ) ), \
+        name##_PRESC    = ( 1 << name##_c3 ), \
+        name##_CKPS     = name##_c3, \
+        name##_TMR1H    = (int)( ( ( 65536UL - TIMER_CALC_TICKS( TIMER_CALC_COUNTS( f_clk, num, den ), ( 1UL << name##_c3 ) ) ) >> 8U ) & 0xFFUL ), \
+        name##_TMR1L    = (int)( ( 65536UL - TIMER_CALC_TICKS( TIMER_CALC_COUNTS( f_clk, num, den ), ( 1UL << name##_c3 ) ) ) & 0xFFUL ), \
+        name##_ERROR    = name##_m3 \
+    }; \
+    TIMER_CALC_ASSERT( name, name##_m3 != TIMER_CALC_NONE )
+
+
+/**@brief Timer2/4/6, f_clk = F_OSC/4: name_CKPS, name_OUTPS ( TxCON ) and name_PR ( PRx ).
+ *        Candidate k: Prescaler 4^( k/16 ), Postscaler ( k%16 ) + 1.
+ */
+#define TIMER_CALC_T2_DEFINE( name, f_clk, num, den )   \
+    enum{ \
+        TIMER_CALC_FIRST( name, TIMER_CALC_ERR( TIMER_CALC_COUNTS( f_clk, num, den ), 1UL, 256UL ) ), \
+        TIMER_CALC_STEP( name, 1, 0, TIMER_CALC_ERR( TIMER_CALC_COUNTS( f_clk, num, den ), 2UL, 256UL ) ), \
+        TIMER_CALC_STEP( name, 2, 1, TIMER_CALC_ERR( TIMER_CALC_COUNTS( f_clk, num, den ), 3UL, 256UL ) ), \
+        TIMER_CALC_STEP( name, 3, 2, TIMER_CALC_ERR( TIMER_CALC_COUNTS( f_clk, num, den ), 4UL, 256UL ) ), \
+        TIMER_CALC_STEP( name, 4, 3, TIMER_CALC_ERR( TIMER_CALC_COUNTS( f_clk, num, den ), 5UL, 256UL ) ), \
+        TIMER_CALC_STEP( name, 5, 4, TIMER_CALC_ERR( TIMER_CALC_COUNTS( f_clk, num, den ), 6UL, 256UL ) ), \
+        TIMER_CALC_STEP( name, 6, 5, TIMER_CALC_ERR( TIMER_CALC_COUNTS( f_clk, num, den ), 7UL, 256UL ) ), \
+        TIMER_CALC_STEP( name, 7, 6, TIMER_CALC_ERR( TIMER_CALC_COUNTS( f_clk, num, den ), 8UL, 256UL ) ), \
+        TIMER_CALC_STEP( name, 8, 7, TIMER_CALC_ERR( TIMER_CALC_COUNTS( f_clk, num, den ), 9UL, 256UL ) ), \
+        TIMER_CALC_STEP( name, 9, 8, TIMER_CALC_ERR( TIMER_CALC_COUNTS( f_clk, num, den ), 10UL, 256UL ) ), \
+        TIMER_CALC_STEP( name, 10, 9, TIMER_CALC_ERR( TIMER_CALC_COUNTS( f_clk, num, den ), 11UL, 256UL ) ), \
+        TIMER_CALC_STEP( name, 11, 10, TIMER_CALC_ERR( TIMER_CALC_COUNTS( f_clk, num, den ), 12UL, 256UL ) ), \
+        TIMER_CALC_STEP( name, 12, 11, TIMER_CALC_ERR( TIMER_CALC_COUNTS( f_clk, num, den ), 13UL, 256UL ) ), \
+        TIMER_CALC_STEP( name, 13, 12, TIMER_CALC_ERR( TIMER_CALC_COUNTS( f_clk, num, den ), 14UL, 256UL ) ), \
+        TIMER_CALC_STEP( name, 14, 13, TIMER_CALC_ERR( TIMER_CALC_COUNTS( f_clk, num, den ), 15UL, 256UL ) ), \
+        TIMER_CALC_STEP( name, 15, 14, TIMER_CALC_ERR( TIMER_CALC_COUNTS( f_clk, num, den ), 16UL, 256UL ) ), \
+        TIMER_CALC_STEP( name, 16, 15, TIMER_CALC_ERR( TIMER_CALC_COUNTS( f_clk, num, den ), 4UL, 256UL ) ), \
+        TIMER_CALC_STEP( name, 17, 16, TIMER_CALC_ERR( TIMER_CALC_COUNTS( f_clk, num, den ), 8UL, 256UL ) ), \
+        TIMER_CALC_STEP( name, 18, 17, TIMER_CALC_ERR( TIMER_CALC_COUNTS( f_clk, num, den ), 12UL, 256UL ) ), \
+        TIMER_CALC_STEP( name, 19, 18, TIMER_CALC_ERR( TIMER_CALC_COUNTS( f_clk, num, den ), 16UL, 256UL ) ), \
+        TIMER_CALC_STEP( name, 20, 19, TIMER_CALC_ERR( TIMER_CALC_COUNTS( f_clk, num, den ), 20UL, 256UL ) ), \
+        TIMER_CALC_STEP( name, 21, 20, TIMER_CALC_ERR( TIMER_CALC_COUNTS( f_clk, num, den ), 24UL, 256UL ) ), \
+        TIMER_CALC_STEP( name, 22, 21, TIMER_CALC_ERR( TIMER_CALC_COUNTS( f_clk, num, den ), 28UL, 256UL ) ), \
+        TIMER_CALC_STEP( name, 23, 22, TIMER_CALC_ERR( TIMER_CALC_COUNTS( f_clk, num, den ), 32UL, 256UL ) ), \
+        TIMER_CALC_STEP( name, 24, 23, TIMER_CALC_ERR( TIMER_CALC_COUNTS( f_clk, num, den ), 36UL, 256UL ) ), \
+        TIMER_CALC_STEP( name, 25, 24, TIMER_CALC_ERR( TIMER_CALC_COUNTS( f_clk, num, den ), 40UL, 256UL ) ), \
+        TIMER_CALC_STEP( name, 26, 25, TIMER_CALC_ERR( TIMER_CALC_COUNTS( f_clk, num, den ), 44UL, 256UL ) ), \
+        TIMER_CALC_STEP( name, 27, 26, TIMER_CALC_ERR( TIMER_CALC_COUNTS( f_clk, num, den ), 48UL, 256UL ) ), \
+        TIMER_CALC_STEP( name, 28, 27, TIMER_CALC_ERR( TIMER_CALC_COUNTS( f_clk, num, den ), 52UL, 256UL ) ), \
+        TIMER_CALC_STEP( name, 29, 28, TIMER_CALC_ERR( TIMER_CALC_COUNTS( f_clk, num, den ), 56UL, 256UL ) ), \
+        TIMER_CALC_STEP( name, 30, 29, TIMER_CALC_ERR( TIMER_CALC_COUNTS( f_clk, num, den ), 60UL, 256UL ) ), \
+        TIMER_CALC_STEP( name, 31, 30, TIMER_CALC_ERR( TIMER_CALC_COUNTS( f_clk, num, den ), 64UL, 256UL ) ), \
+        TIMER_CALC_STEP( name, 32, 31, TIMER_CALC_ERR( TIMER_CALC_COUNTS( f_clk, num, den ), 16UL, 256UL ) ), \
+        TIMER_CALC_STEP( name, 33, 32, TIMER_CALC_ERR( TIMER_CALC_COUNTS( f_clk, num, den ), 32UL, 256UL ) ), \
+        TIMER_CALC_STEP( name, 34, 33, TIMER_CALC_ERR( TIMER_CALC_COUNTS( f_clk, num, den ), 48UL, 256UL ) ), \
+        TIMER_CALC_STEP( name, 35, 34, TIMER_CALC_ERR( TIMER_CALC_COUNTS( f_clk, num, den ), 64UL, 256UL ) ), \
+        TIMER_CALC_STEP( name, 36, 35, TIMER_CALC_ERR( TIMER_CALC_COUNTS( f_clk, num, den ), 80UL, 256UL ) ), \
+        TIMER_CALC_STEP( name, 37, 36, TIMER_CALC_ERR( TIMER_CALC_COUNTS( f_clk, num, den ), 96UL, 256UL ) ), \
+        TIMER_CALC_STEP( name, 38, 37, TIMER_CALC_ERR( TIMER_CALC_COUNTS( f_clk, num, den ), 112UL, 256UL ) ), \
+        TIMER_CALC_STEP( name, 39, 38, TIMER_CALC_ERR( TIMER_CALC_COUNTS( f_clk, num, den ), 128UL, 256UL ) ), \
+        TIMER_CALC_STEP( name, 40, 39, TIMER_CALC_ERR( TIMER_CALC_COUNTS( f_clk, num, den ), 144UL, 256UL ) ), \
+        TIMER_CALC_STEP( name, 41, 40, TIMER_CALC_ERR( TIMER_CALC_COUNTS( f_clk, num, den ), 160UL, 256UL ) ), \
+        TIMER_CALC_STEP( name, 42, 41, TIMER_CALC_ERR( TIMER_CALC_COUNTS( f_clk, num, den ), 176UL, 256UL ) ), \
+        TIMER_CALC_STEP( name, 43, 42, TIMER_CALC_ERR( TIMER_CALC_COUNTS( f_clk, num, den ), 192UL, 256UL ) ), \
+        TIMER_CALC_STEP( name, 44, 43, TIMER_CALC_ERR( TIMER_CALC_COUNTS( f_clk, num, den ), 208UL, 256UL ) ), \
+        TIMER_CALC_STEP( name, 45, 44, TIMER_CALC_ERR( TIMER_CALC_COUNTS( f_clk, num, den ), 224UL, 256UL ) ), \
+        TIMER_CALC_STEP( name, 46, 45, TIMER_CALC_ERR( TIMER_CALC_COUNTS( f_clk, num, den ), 240UL, 256UL ) ), \
+        TIMER_CALC_STEP( name, 47, 46, TIMER_CALC_ERR( TIMER_CALC_COUNTS( f_clk, num, den ), 256UL, 256UL ) ), \
+        TIMER_CALC_STEP( name, 48, 47, TIMER_CALC_ERR( TIMER_CALC_COUNTS( f_clk, num, den ), 64UL, 256UL ) ), \
+        TIMER_CALC_STEP( name, 49, 48, TIMER_CALC_ERR( TIMER_CALC_COUNTS( f_clk, num, den ), 128UL, 256UL ) ), \
+        TIMER_CALC_STEP( name, 50, 49, TIMER_CALC_ERR( TIMER_CALC_COUNTS( f_clk, num, den ), 192UL, 256UL ) ), \
+        TIMER_CALC_STEP( name, 51, 50, TIMER_CALC_ERR( TIMER_CALC_COUNTS( f_clk, num, den ), 256UL, 256UL ) ), \
+        TIMER_CALC_STEP( name, 52, 51, TIMER_CALC_ERR( TIMER_CALC_COUNTS( f_clk, num, den ), 320UL, 256UL ) ), \
+        TIMER_CALC_STEP( name, 53, 52, TIMER_CALC_ERR( TIMER_CALC_COUNTS( f_clk, num, den ), 384UL, 256UL ) ), \
+        TIMER_CALC_STEP( name, 54, 53, TIMER_CALC_ERR( TIMER_CALC_COUNTS( f_clk, num, den ), 448UL, 256UL ) ), \
+        TIMER_CALC_STEP( name, 55, 54, TIMER_CALC_ERR( TIMER_CALC_COUNTS( f_clk, num, den ), 512UL, 256UL ) ), \
+        TIMER_CALC_STEP( name, 56, 55, TIMER_CALC_ERR( TIMER_CALC_COUNTS( f_clk, num, den ), 576UL, 256UL ) ), \
+        TIMER_CALC_STEP( name, 57, 56, TIMER_CALC_ERR( TIMER_CALC_COUNTS( f_clk, num, den ), 640UL, 256UL ) ), \
+        TIMER_CALC_STEP( name, 58, 57, TIMER_CALC_ERR( TIMER_CALC_COUNTS( f_clk, num, den ), 704UL, 256UL ) ), \
+        TIMER_CALC_STEP( name, 59, 58, TIMER_CALC_ERR( TIMER_CALC_COUNTS( f_clk, num, den ), 768UL, 256UL ) ), \
+        TIMER_CALC_STEP( name, 60, 59, TIMER_CALC_ERR( TIMER_CALC_COUNTS( f_clk, num, den ), 832UL, 256UL ) ), \
+        TIMER_CALC_STEP( name, 61, 60, TIMER_CALC_ERR( TIMER_CALC_COUNTS( f_clk, num, den ), 896UL, 256UL ) ), \
+        TIMER_CALC_STEP( name, 62, 61, TIMER_CALC_ERR( TIMER_CALC_COUNTS( f_clk, num, den ), 960UL, 256UL ) ), \
+        TIMER_CALC_STEP( name, 63, 62, TIMER_CALC_ERR( TIMER_CALC_COUNTS( f_clk, num, den ), 1024UL, 256UL ) ), \
+        name##_PRESC    = ( 1 << ( 2 * ( name##_c63 >> 4 ) ) ), \
+        name##_CKPS     = ( name##_c63 >> 4 ), \
+        name##_OUTPS    = ( name##_c63 & 0x0F ), \
+        name##_PR       = (int)( TIMER_CALC_TICKS( TIMER_CALC_COUNTS( f_clk, num, den ), (uint32_t)name##_PRESC * (uint32_t)( name##_OUTPS + 1 ) ) - 1UL ), \
+        name##_ERROR    = name##_m63 \
+    }; \
+    TIMER_CALC_ASSERT( name, name##_m63 != TIMER_CALC_NONE )
+
+
+
+/**@brief Function prototypes.
+ */
+
+
+
+/**@brief Variables.
+ */
+
+
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif /* TIMER_CALC_H_ */
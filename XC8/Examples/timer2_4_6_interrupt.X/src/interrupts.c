@@ -22,31 +22,20 @@
  *
  * @author      Manuel Caballero
  * @date        09/February/2024
- * @version     09/February/2024   The ORIGIN
+ * @version     18/October/2026   Timer2 ticks the software timers, Timer4/6 are free
+ *              09/February/2024   The ORIGIN
  * @pre         N/A.
  * @warning     N/A
  */
 void __interrupt() ISR ( void )
 {
-    /* Check if Timer2 Overflow interrupt is enabled and Timer2 Overflow occurred */
+    /* Check if Timer2 interrupt is enabled and TMR2 = PR2 occurred */
     if ( ( PIE1bits.TMR2IE == 1U  ) && ( PIR1bits.TMR2IF == 1U ) )
     {        
-        /* Update the variable  */
-        myState |=   0b01;
-        
-        
         /* Clear the interrupt flag   */
         PIR1bits.TMR2IF = 0U;
-    }
-    
-    /* Check if Timer6 Overflow interrupt is enabled and Timer6 Overflow occurred */
-    if ( ( PIE3bits.TMR6IE == 1U  ) && ( PIR3bits.TMR6IF == 1U ) )
-    {        
-        /* Update the variable  */
-        myState |=   0b10;
-        
         
-        /* Clear the interrupt flag   */
-        PIR3bits.TMR6IF = 0U;
+        /* One more tick for the software timers   */
+        swt_isr ();
     }
 }
\ No newline at end of file
@@ -2,15 +2,19 @@
  * @brief       main.c
  * @details     This example shows how to work with the internal peripheral: Timer2/4/6.
  * 
- *              Timer1 will generate an interrupt every 0.5s changing the state of the D5 LED.
- *              Timer2 will change the state of the D4 LED every 1s by polling.
- *              Timer6 will generate an interrupt every 1.5s changing the state of the D3 LED.
+ *              Timer2 ticks the software timers ( swtimer.h ) every 10ms, the three LEDs share it:
+ *                  - A software timer changes the state of the D5 LED every 0.5s.
+ *                  - A software timer changes the state of the D4 LED every 1s.
+ *                  - A software timer changes the state of the D3 LED every 1.5s.
+ * 
+ *              The callbacks are called from the main loop. Timer4 and Timer6 are left free ( PWM ).
  *
  * @return      N/A
  *
  * @author      Manuel Caballero (aqueronteblog@gmail.com)
  * @date        09/February/2024
- * @version     09/February/2024    The ORIGIN
+ * @version     18/October/2026     The LEDs are driven by software timers on Timer2
+ *              09/February/2024    The ORIGIN
  * @pre         This project was tested on a PIC16F1937 using a PICDEM 2 Plus.
  * @warning     N/A
  * @pre         The Timer2/4/6 interrupt cannot wake the processor from Sleep since the timer is frozen during Sleep
@@ -47,6 +51,7 @@
 #include "../inc/board.h"
 #include "../inc/functions.h"
 #include "../inc/interrupts.h"
+#include "../inc/swtimer.h"
 
 /**@brief Constants.
  */
@@ -54,65 +59,71 @@
 
 /**@brief Variables.
  */
-volatile uint8_t myState;   // BIT0 -> D5 LED | BIT1 -> D3 LED
+static swt_timer_t  myD5timer;      /* D5 LED, 0.5s     */
+static swt_timer_t  myD4timer;      /* D4 LED, 1s       */
+static swt_timer_t  myD3timer;      /* D3 LED, 1.5s     */
+
+/**@brief Function prototypes.
+ */
+static void led_toggle  ( swt_timer_t* timer );
 
 /**@brief Function for application main entry.
  */
 void main(void) {
     conf_CLK    ();
     conf_GPIO   ();
-    conf_Timer2 ();
-    conf_Timer4 ();
-    conf_Timer6 ();
+    swt_init    ();
     
     /* Enable interrupts    */
     INTCONbits.PEIE =   1U; // Enables all active peripheral interrupts
     INTCONbits.GIE  =   1U; // Enables all active interrupts
     
-    /* Start timers */
-    T2CONbits.TMR2ON   =  1U;
-    T4CONbits.TMR4ON   =  1U;
-    T6CONbits.TMR6ON   =  1U;
-    
-    /* Reset the variables  */
-    myState =   0U;
+    /* Start the software timers    */
+    swt_start ( &myD5timer, SWT_MS( 500U ), SWT_MS( 500U ), led_toggle );
+    swt_start ( &myD4timer, SWT_MS( 1000U ), SWT_MS( 1000U ), led_toggle );
+    swt_start ( &myD3timer, SWT_MS( 1500U ), SWT_MS( 1500U ), led_toggle );
     
     while ( 1U )
     {
-        /* Check if an interrupt is triggered by TMR2 or TMR6    */
-        if ( myState != 0U )
-        {
-            /* Check if TMR2 interrupt is triggered */
-            if ( ( myState & 0b01 ) != 0U )
-            {
-                /* Change the state of D5 LED    */
-                LATB    ^=  D5;
-            
-                /* Reset the variable  */
-                myState &=   ~0b01;
-            }
-            
-            /* Check if TMR6 interrupt is triggered */
-            if ( ( myState & 0b10 ) != 0U )
-            {
-                /* Change the state of D3 LED    */
-                LATB    ^=  D3;
-            
-                /* Reset the variable  */
-                myState &=   ~0b10;
-            }
-        }
-        else
-        {
-            /* Check if Timer4 Overflow is triggered by polling */
-            if ( PIR3bits.TMR4IF == 1U )
-            {        
-                /* Change the state of D4 LED    */
-                LATB    ^=  D4;
-            
-                /* Clear the interrupt flag   */
-                PIR3bits.TMR4IF = 0U;
-            }
-        }
+        /* Dispatch the expired software timers    */
+        swt_process ();
+    }
+}
+
+
+
+/**
+ * @brief       void led_toggle ( swt_timer_t* )
+ * @details     Software timer callback, it changes the state of the LED of the timer.
+ *
+ * @param[in]    timer: Expired software timer.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      N/A.
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026   The ORIGIN
+ * @pre         N/A
+ * @warning     N/A.
+ */
+static void led_toggle ( swt_timer_t* timer )
+{
+    if ( timer == &myD5timer )
+    {
+        /* Change the state of D5 LED    */
+        LATB    ^=  D5;
+    }
+    else if ( timer == &myD4timer )
+    {
+        /* Change the state of D4 LED    */
+        LATB    ^=  D4;
+    }
+    else
+    {
+        /* Change the state of D3 LED    */
+        LATB    ^=  D3;
     }
 }
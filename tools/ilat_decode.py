@@ -0,0 +1,135 @@
+#!/usr/bin/env python3
+"""
+@brief      ilat_decode.py
+@details    Host decoder of the ISR latency and duration dump ( ilat.h, ilat_dump() ).
+
+            The dump is read from a file ( e.g. captured by a terminal ) or straight from a serial port
+            ( pyserial ). Every frame found is checked and printed, one line per source, times in us:
+
+                python3 ilat_decode.py dump.bin --names TMR4,AD,TX,TMR2
+                python3 ilat_decode.py --port /dev/ttyUSB0                  ( XC8 adc_an0.X, 19200 baud )
+                python3 ilat_decode.py --port /dev/ttyUSB0 --baud 115200    ( XC32 UART.X )
+
+            Frame ( little-endian ):
+
+                'I' 'L' 'A' 'T', version ( 1 ), tick size ( 2 | 4 ), sources, bins, bin shift, tick Hz ( u32 )
+                Per source: id ( u8 ), n ( u32 ), lat_min, lat_max ( tick ), lat_sum ( u32 ),
+                            dur_min, dur_max ( tick ), dur_sum ( u32 ), hist[bins] ( u16 )
+                Checksum ( u8 ): Every byte after the magic adds up to 0
+
+@author     Manuel Caballero (aqueronteblog@gmail.com)
+@date       18/October/2026
+@version    18/October/2026    Default baud rate 19200 ( adc_an0.X ), usage of UART.X at 115200
+            18/October/2026    The ORIGIN
+"""
+import argparse
+import struct
+import sys
+
+MAGIC = b"ILAT"
+VERSION = 1
+
+
+def parse(data, pos):
+    """It decodes the frame which starts at data[pos] ( magic ). It returns ( frame, next position )."""
+    p = pos + len(MAGIC)
+    version, tick, sources, bins, shift, hz = struct.unpack_from("<5BI", data, p)
+    if version != VERSION or tick not in (2, 4):
+        raise ValueError("unknown frame version %d / tick size %d" % (version, tick))
+
+    size = 9 + sources * (1 + 4 + 4 * tick + 8 + 2 * bins) + 1
+    if p + size > len(data):
+        raise EOFError("truncated frame")
+    if sum(data[p:p + size]) & 0xFF:
+        raise ValueError("bad checksum")
+
+    t = "H" if tick == 2 else "I"
+    fmt = "<BI%s%sI%s%sI%dH" % (t, t, t, t, bins)
+    q = p + 9
+    rows = []
+    for _ in range(sources):
+        f = struct.unpack_from(fmt, data, q)
+        q += struct.calcsize(fmt)
+        rows.append({
+            "id": f[0], "n": f[1],
+            "lat_min": f[2], "lat_max": f[3], "lat_sum": f[4],
+            "dur_min": f[5], "dur_max": f[6], "dur_sum": f[7],
+            "hist": list(f[8:]),
+        })
+
+    return {"hz": hz, "shift": shift, "bins": bins, "rows": rows}, p + size
+
+
+def bin_label(k, shift, bins):
+    """Duration range of the bin k, ticks."""
+    if k == 0:
+        return "<%d" % (1 << shift)
+    if k == bins - 1:
+        return ">=%d" % (1 << (shift + k - 1))
+    return "%d-%d" % (1 << (shift + k - 1), (1 << (shift + k)) - 1)
+
+
+def show(frame, names, out):
+    us = 1e6 / frame["hz"]
+    out.write("tick = %.3f us ( %d Hz )\n" % (us, frame["hz"]))
+    out.write("%-8s %10s %10s %10s %10s %10s %10s %10s\n" %
+              ("source", "n", "lat min", "lat mean", "lat max", "dur min", "dur mean", "dur max"))
+    for r in frame["rows"]:
+        name = names[r["id"]] if r["id"] < len(names) else str(r["id"])
+        if r["n"] == 0:
+            out.write("%-8s %10d %10s\n" % (name, 0, "-"))
+            continue
+        out.write("%-8s %10d %10.1f %10.1f %10.1f %10.1f %10.1f %10.1f\n" % (
+            name, r["n"],
+            r["lat_min"] * us, r["lat_sum"] * us / r["n"], r["lat_max"] * us,
+            r["dur_min"] * us, r["dur_sum"] * us / r["n"], r["dur_max"] * us))
+        hist = "  ".join("%s:%d" % (bin_label(k, frame["shift"], frame["bins"]), h)
+                         for k, h in enumerate(r["hist"]) if h)
+        out.write("%-8s histogram ( ticks ) %s\n" % ("", hist))
+
+
+def decode(data, names, out):
+    """It decodes every frame in data. It returns the bytes which may start a frame not complete yet."""
+    pos = data.find(MAGIC)
+    while pos >= 0:
+        try:
+            frame, nxt = parse(data, pos)
+        except (EOFError, struct.error):
+            return data[pos:]
+        except ValueError as e:
+            out.write("skipped frame: %s\n" % e)
+            nxt = pos + 1
+        else:
+            show(frame, names, out)
+        pos = data.find(MAGIC, nxt)
+    return data[-(len(MAGIC) - 1):]
+
+
+def main():
+    ap = argparse.ArgumentParser(description="ISR latency and duration dump decoder ( ilat.h )")
+    ap.add_argument("file", nargs="?", help="dump file ( binary )")
+    ap.add_argument("--port", help="serial port, it is read until Ctrl+C")
+    ap.add_argument("--baud", type=int, default=19200)
+    ap.add_argument("--names", default="", help="source names in id order, comma separated")
+    args = ap.parse_args()
+    names = [n for n in args.names.split(",") if n]
+
+    if args.port:
+        import serial
+        rest = b""
+        with serial.Serial(args.port, args.baud, timeout=0.5) as s:
+            try:
+                while True:
+                    rest = decode(rest + s.read(256), names, sys.stdout)
+                    sys.stdout.flush()
+            except KeyboardInterrupt:
+                pass
+    elif args.file:
+        with open(args.file, "rb") as f:
+            decode(f.read(), names, sys.stdout)
+    else:
+        decode(sys.stdin.buffer.read(), names, sys.stdout)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,73 @@
+/**
+ * @brief       pic16_sfr.c
+ * @details     Host model of the PIC16F1937: SFR definitions, SLEEP and data EEPROM.
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero (aqueronteblog@gmail.com)
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+#define PIC16_SFR_DEFINE
+#include "xc.h"
+
+
+/**@brief Variables.
+ */
+void ( *pic16_sleep_hook ) ( void );        /*!<   What happens in SLEEP, NULL: Nothing    */
+
+static uint8_t  myEeprom[256];              /*!<   Data EEPROM                             */
+
+
+
+/**
+ * @brief       void pic16_sleep ( void )
+ * @details     SLEEP instruction: pic16_sleep_hook() is called, the core goes on when it returns.
+ *
+ *
+ * @param[in]    N/A.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+void pic16_sleep ( void )
+{
+    if ( pic16_sleep_hook != NULL )
+    {
+        pic16_sleep_hook ();
+    }
+}
+
+
+/**
+ * @brief       uint8_t eeprom_read ( uint8_t ), void eeprom_write ( uint8_t , uint8_t )
+ * @details     Data EEPROM.
+ *
+ *
+ * @return      The byte read
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+uint8_t eeprom_read ( uint8_t addr )
+{
+    return myEeprom[addr];
+}
+
+void eeprom_write ( uint8_t addr, uint8_t value )
+{
+    myEeprom[addr]  =   value;
+}
@@ -0,0 +1,13 @@
+/**
+ * @brief       pic16f1937.h
+ * @details     Host model: the registers are in xc.h.
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero (aqueronteblog@gmail.com)
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+#include <xc.h>
@@ -0,0 +1,240 @@
+/**
+ * @brief       xc.h
+ * @details     Host model of the PIC16F1937 registers used by the host tests ( tools/test ). Every SFR is
+ *              a plain variable, defined once by pic16_sfr.c. The bit fields are 8 bits wide: a test reads
+ *              back exactly what the module under test wrote.
+ *
+ *              SLEEP() calls pic16_sleep(), the test sets pic16_sleep_hook to model what happens while
+ *              the core is stopped ( e.g. an ADC conversion and its ADIF wake-up ).
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero (aqueronteblog@gmail.com)
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         Host build only ( tools/test/Makefile ).
+ * @warning     N/A
+ */
+#ifndef PIC16_XC_H_
+#define PIC16_XC_H_
+
+#include <stdint.h>
+#include <stdio.h>
+
+#ifndef __XC8
+#define __XC8   1
+#endif
+
+#ifdef PIC16_SFR_DEFINE
+#define PIC16_SFR   volatile
+#else
+#define PIC16_SFR   extern volatile
+#endif
+
+
+/**@brief Core.
+ */
+extern void ( *pic16_sleep_hook ) ( void );
+void pic16_sleep    ( void );
+
+#define SLEEP()             pic16_sleep ()
+#define NOP()               do{ }while ( 0 )
+#define CLRWDT()            do{ }while ( 0 )
+#define __interrupt(...)
+#define __eeprom
+#define __delay_us( x )     do{ }while ( 0 )
+#define __delay_ms( x )     do{ }while ( 0 )
+
+uint8_t eeprom_read     ( uint8_t addr );
+void    eeprom_write    ( uint8_t addr, uint8_t value );
+
+
+/**@brief Special function registers.
+ */
+typedef struct { unsigned SPLLEN : 8; unsigned IRCF : 8; unsigned SCS : 8; } OSCCONbits_t;
+PIC16_SFR OSCCONbits_t OSCCONbits;
+PIC16_SFR uint8_t OSCCON;
+typedef struct { unsigned HFIOFR : 8; unsigned T1OSCR : 8; unsigned OSTS : 8; unsigned PLLR : 8; unsigned LFIOFR : 8; unsigned HFIOFL : 8; unsigned MFIOFR : 8; unsigned HFIOFS : 8; } OSCSTATbits_t;
+PIC16_SFR OSCSTATbits_t OSCSTATbits;
+PIC16_SFR uint8_t OSCSTAT;
+typedef struct { unsigned SPEN : 8; unsigned RX9 : 8; unsigned SREN : 8; unsigned CREN : 8; unsigned ADDEN : 8; unsigned FERR : 8; unsigned OERR : 8; unsigned RX9D : 8; } RCSTAbits_t;
+PIC16_SFR RCSTAbits_t RCSTAbits;
+PIC16_SFR uint8_t RCSTA;
+typedef struct { unsigned CSRC : 8; unsigned TX9 : 8; unsigned TXEN : 8; unsigned SYNC : 8; unsigned SENDB : 8; unsigned BRGH : 8; unsigned TRMT : 8; unsigned TX9D : 8; } TXSTAbits_t;
+PIC16_SFR TXSTAbits_t TXSTAbits;
+PIC16_SFR uint8_t TXSTA;
+typedef struct { unsigned ABDOVF : 8; unsigned RCIDL : 8; unsigned SCKP : 8; unsigned BRG16 : 8; unsigned WUE : 8; unsigned ABDEN : 8; } BAUDCONbits_t;
+PIC16_SFR BAUDCONbits_t BAUDCONbits;
+PIC16_SFR uint8_t BAUDCON;
+typedef struct { unsigned TMR1GIF : 8; unsigned ADIF : 8; unsigned RCIF : 8; unsigned TXIF : 8; unsigned SSPIF : 8; unsigned CCP1IF : 8; unsigned TMR2IF : 8; unsigned TMR1IF : 8; } PIR1bits_t;
+PIC16_SFR PIR1bits_t PIR1bits;
+PIC16_SFR uint8_t PIR1;
+typedef struct { unsigned TMR1GIE : 8; unsigned ADIE : 8; unsigned RCIE : 8; unsigned TXIE : 8; unsigned SSPIE : 8; unsigned CCP1IE : 8; unsigned TMR2IE : 8; unsigned TMR1IE : 8; } PIE1bits_t;
+PIC16_SFR PIE1bits_t PIE1bits;
+PIC16_SFR uint8_t PIE1;
+typedef struct { unsigned OSFIF : 8; unsigned C2IF : 8; unsigned C1IF : 8; unsigned EEIF : 8; unsigned BCLIF : 8; unsigned LCDIF : 8; unsigned CCP2IF : 8; } PIR2bits_t;
+PIC16_SFR PIR2bits_t PIR2bits;
+PIC16_SFR uint8_t PIR2;
+typedef struct { unsigned OSFIE : 8; unsigned C2IE : 8; unsigned C1IE : 8; unsigned EEIE : 8; unsigned BCLIE : 8; unsigned LCDIE : 8; unsigned CCP2IE : 8; } PIE2bits_t;
+PIC16_SFR PIE2bits_t PIE2bits;
+PIC16_SFR uint8_t PIE2;
+typedef struct { unsigned CCP5IF : 8; unsigned CCP4IF : 8; unsigned CCP3IF : 8; unsigned TMR6IF : 8; unsigned TMR4IF : 8; } PIR3bits_t;
+PIC16_SFR PIR3bits_t PIR3bits;
+PIC16_SFR uint8_t PIR3;
+typedef struct { unsigned CCP5IE : 8; unsigned CCP4IE : 8; unsigned CCP3IE : 8; unsigned TMR6IE : 8; unsigned TMR4IE : 8; } PIE3bits_t;
+PIC16_SFR PIE3bits_t PIE3bits;
+PIC16_SFR uint8_t PIE3;
+typedef struct { unsigned GIE : 8; unsigned PEIE : 8; unsigned TMR0IE : 8; unsigned INTE : 8; unsigned IOCIE : 8; unsigned TMR0IF : 8; unsigned INTF : 8; unsigned IOCIF : 8; } INTCONbits_t;
+PIC16_SFR INTCONbits_t INTCONbits;
+PIC16_SFR uint8_t INTCON;
+typedef struct { unsigned WCOL : 8; unsigned SSPOV : 8; unsigned SSPEN : 8; unsigned CKP : 8; unsigned SSPM : 8; } SSPCON1bits_t;
+PIC16_SFR SSPCON1bits_t SSPCON1bits;
+PIC16_SFR uint8_t SSPCON1;
+typedef struct { unsigned GCEN : 8; unsigned ACKSTAT : 8; unsigned ACKDT : 8; unsigned ACKEN : 8; unsigned RCEN : 8; unsigned PEN : 8; unsigned RSEN : 8; unsigned SEN : 8; } SSPCON2bits_t;
+PIC16_SFR SSPCON2bits_t SSPCON2bits;
+PIC16_SFR uint8_t SSPCON2;
+typedef struct { unsigned ACKTIM : 8; unsigned PCIE : 8; unsigned SCIE : 8; unsigned BOEN : 8; unsigned SDAHT : 8; unsigned SBCDE : 8; unsigned AHEN : 8; unsigned DHEN : 8; } SSPCON3bits_t;
+PIC16_SFR SSPCON3bits_t SSPCON3bits;
+PIC16_SFR uint8_t SSPCON3;
+typedef struct { unsigned SMP : 8; unsigned CKE : 8; unsigned D_nA : 8; unsigned P : 8; unsigned S : 8; unsigned R_nW : 8; unsigned UA : 8; unsigned BF : 8; } SSPSTATbits_t;
+PIC16_SFR SSPSTATbits_t SSPSTATbits;
+PIC16_SFR uint8_t SSPSTAT;
+typedef struct { unsigned TMR1CS : 8; unsigned T1CKPS : 8; unsigned T1OSCEN : 8; unsigned nT1SYNC : 8; unsigned TMR1ON : 8; } T1CONbits_t;
+PIC16_SFR T1CONbits_t T1CONbits;
+PIC16_SFR uint8_t T1CON;
+typedef struct { unsigned TMR1GE : 8; unsigned T1GPOL : 8; unsigned T1GTM : 8; unsigned T1GSPM : 8; unsigned T1GGO_nDONE : 8; unsigned T1GVAL : 8; unsigned T1GSS : 8; } T1GCONbits_t;
+PIC16_SFR T1GCONbits_t T1GCONbits;
+PIC16_SFR uint8_t T1GCON;
+typedef struct { unsigned T2OUTPS : 8; unsigned TMR2ON : 8; unsigned T2CKPS : 8; } T2CONbits_t;
+PIC16_SFR T2CONbits_t T2CONbits;
+PIC16_SFR uint8_t T2CON;
+typedef struct { unsigned T4OUTPS : 8; unsigned TMR4ON : 8; unsigned T4CKPS : 8; } T4CONbits_t;
+PIC16_SFR T4CONbits_t T4CONbits;
+PIC16_SFR uint8_t T4CON;
+typedef struct { unsigned T6OUTPS : 8; unsigned TMR6ON : 8; unsigned T6CKPS : 8; } T6CONbits_t;
+PIC16_SFR T6CONbits_t T6CONbits;
+PIC16_SFR uint8_t T6CON;
+typedef struct { unsigned nWPUEN : 8; unsigned INTEDG : 8; unsigned TMR0CS : 8; unsigned TMR0SE : 8; unsigned PSA : 8; unsigned PS : 8; } OPTION_REGbits_t;
+PIC16_SFR OPTION_REGbits_t OPTION_REGbits;
+PIC16_SFR uint8_t OPTION_REG;
+typedef struct { unsigned CHS : 8; unsigned GO_nDONE : 8; unsigned GO : 8; unsigned ADON : 8; } ADCON0bits_t;
+PIC16_SFR ADCON0bits_t ADCON0bits;
+PIC16_SFR uint8_t ADCON0;
+typedef struct { unsigned ADFM : 8; unsigned ADCS : 8; unsigned ADNREF : 8; unsigned ADPREF : 8; } ADCON1bits_t;
+PIC16_SFR ADCON1bits_t ADCON1bits;
+PIC16_SFR uint8_t ADCON1;
+typedef struct { unsigned FVREN : 8; unsigned FVRRDY : 8; unsigned TSEN : 8; unsigned TSRNG : 8; unsigned CDAFVR : 8; unsigned ADFVR : 8; } FVRCONbits_t;
+PIC16_SFR FVRCONbits_t FVRCONbits;
+PIC16_SFR uint8_t FVRCON;
+typedef struct { unsigned DACEN : 8; unsigned DACLPS : 8; unsigned DACOE : 8; unsigned DACPSS : 8; unsigned DACNSS : 8; } DACCON0bits_t;
+PIC16_SFR DACCON0bits_t DACCON0bits;
+PIC16_SFR uint8_t DACCON0;
+typedef struct { unsigned DACR : 8; } DACCON1bits_t;
+PIC16_SFR DACCON1bits_t DACCON1bits;
+PIC16_SFR uint8_t DACCON1;
+typedef struct { unsigned P1M : 8; unsigned DC1B : 8; unsigned CCP1M : 8; } CCP1CONbits_t;
+PIC16_SFR CCP1CONbits_t CCP1CONbits;
+PIC16_SFR uint8_t CCP1CON;
+typedef struct { unsigned P2M : 8; unsigned DC2B : 8; unsigned CCP2M : 8; } CCP2CONbits_t;
+PIC16_SFR CCP2CONbits_t CCP2CONbits;
+PIC16_SFR uint8_t CCP2CON;
+typedef struct { unsigned EEPGD : 8; unsigned CFGS : 8; unsigned LWLO : 8; unsigned FREE : 8; unsigned WRERR : 8; unsigned WREN : 8; unsigned WR : 8; unsigned RD : 8; } EECON1bits_t;
+PIC16_SFR EECON1bits_t EECON1bits;
+PIC16_SFR uint8_t EECON1;
+typedef struct { unsigned WDTPS : 8; unsigned SWDTEN : 8; } WDTCONbits_t;
+PIC16_SFR WDTCONbits_t WDTCONbits;
+PIC16_SFR uint8_t WDTCON;
+typedef struct { unsigned nTO : 8; unsigned nPD : 8; unsigned Z : 8; unsigned DC : 8; unsigned C : 8; } STATUSbits_t;
+PIC16_SFR STATUSbits_t STATUSbits;
+PIC16_SFR uint8_t STATUS;
+typedef struct { unsigned IOCBN0 : 8; unsigned IOCBN1 : 8; } IOCBNbits_t;
+PIC16_SFR IOCBNbits_t IOCBNbits;
+PIC16_SFR uint8_t IOCBN;
+typedef struct { unsigned IOCBF0 : 8; unsigned IOCBF1 : 8; } IOCBFbits_t;
+PIC16_SFR IOCBFbits_t IOCBFbits;
+PIC16_SFR uint8_t IOCBF;
+typedef struct { unsigned IOCBP0 : 8; } IOCBPbits_t;
+PIC16_SFR IOCBPbits_t IOCBPbits;
+PIC16_SFR uint8_t IOCBP;
+typedef struct { unsigned ANSA0 : 8; unsigned ANSA1 : 8; unsigned ANSA2 : 8; unsigned ANSA3 : 8; unsigned ANSA4 : 8; unsigned ANSA5 : 8; } ANSELAbits_t;
+PIC16_SFR ANSELAbits_t ANSELAbits;
+PIC16_SFR uint8_t ANSELA;
+typedef struct { unsigned VREGPM : 8; } VREGCONbits_t;
+PIC16_SFR VREGCONbits_t VREGCONbits;
+PIC16_SFR uint8_t VREGCON;
+typedef struct { unsigned CCP2SEL : 8; unsigned SRNQSEL : 8; } APFCONbits_t;
+PIC16_SFR APFCONbits_t APFCONbits;
+PIC16_SFR uint8_t APFCON;
+typedef struct { unsigned C1ON : 8; unsigned C1OUT : 8; unsigned C1POL : 8; unsigned C1OE : 8; unsigned C1SP : 8; unsigned C1HYS : 8; } CM1CON0bits_t;
+PIC16_SFR CM1CON0bits_t CM1CON0bits;
+PIC16_SFR uint8_t CM1CON0;
+typedef struct { unsigned C1INTP : 8; unsigned C1INTN : 8; unsigned C1PCH : 8; unsigned C1NCH : 8; } CM1CON1bits_t;
+PIC16_SFR CM1CON1bits_t CM1CON1bits;
+typedef struct { unsigned MC1OUT : 1; unsigned MC2OUT : 1; } CMOUTbits_t;
+PIC16_SFR CMOUTbits_t CMOUTbits;
+PIC16_SFR uint8_t CM1CON1;
+typedef struct { unsigned x : 8; } PMD0bits_t;
+PIC16_SFR PMD0bits_t PMD0bits;
+PIC16_SFR uint8_t PMD0;
+typedef struct { unsigned SRLEN : 8; unsigned SRQEN : 8; unsigned SRNQEN : 8; unsigned SRPS : 8; unsigned SRPR : 8; } SRCON0bits_t;
+PIC16_SFR SRCON0bits_t SRCON0bits;
+PIC16_SFR uint8_t SRCON0;
+PIC16_SFR uint8_t SPBRGH;
+PIC16_SFR uint8_t SPBRGL;
+PIC16_SFR uint8_t SPBRG;
+PIC16_SFR uint8_t TXREG;
+PIC16_SFR uint8_t RCREG;
+PIC16_SFR uint8_t SSPADD;
+PIC16_SFR uint8_t SSPBUF;
+PIC16_SFR uint8_t SSP1ADD;
+PIC16_SFR uint8_t TMR1H;
+PIC16_SFR uint8_t TMR1L;
+PIC16_SFR uint16_t TMR1;
+PIC16_SFR uint8_t PR2;
+PIC16_SFR uint8_t TMR2;
+PIC16_SFR uint8_t PR4;
+PIC16_SFR uint8_t TMR4;
+PIC16_SFR uint8_t PR6;
+PIC16_SFR uint8_t TMR6;
+PIC16_SFR uint8_t TMR0;
+PIC16_SFR uint8_t ADRESH;
+PIC16_SFR uint8_t ADRESL;
+PIC16_SFR uint8_t CCPR1H;
+PIC16_SFR uint8_t CCPR1L;
+PIC16_SFR uint16_t CCPR1;
+PIC16_SFR uint8_t CCPR2H;
+PIC16_SFR uint8_t CCPR2L;
+PIC16_SFR uint8_t EEADRL;
+PIC16_SFR uint8_t EEADRH;
+PIC16_SFR uint8_t EEDATL;
+PIC16_SFR uint8_t EEDATH;
+PIC16_SFR uint8_t EECON2;
+PIC16_SFR uint8_t LATA;
+PIC16_SFR uint8_t LATB;
+PIC16_SFR uint8_t LATC;
+PIC16_SFR uint8_t LATD;
+PIC16_SFR uint8_t TRISA;
+PIC16_SFR uint8_t TRISB;
+PIC16_SFR uint8_t TRISC;
+PIC16_SFR uint8_t TRISD;
+PIC16_SFR uint8_t ANSELB;
+PIC16_SFR uint8_t ANSELD;
+PIC16_SFR uint8_t ANSELE;
+PIC16_SFR uint8_t WPUB;
+PIC16_SFR uint8_t PORTA;
+PIC16_SFR uint8_t PORTB;
+PIC16_SFR uint8_t PORTC;
+PIC16_SFR uint8_t OSCTUNE;
+typedef struct { unsigned CCP5M : 8; unsigned DC5B : 8; } CCP5CONbits_t;
+PIC16_SFR CCP5CONbits_t CCP5CONbits;
+PIC16_SFR uint8_t CCP5CON;
+PIC16_SFR uint8_t CCPR5H;
+PIC16_SFR uint8_t CCPR5L;
+typedef struct { unsigned C2ON : 8; unsigned C2OUT : 8; } CM2CON0bits_t;
+PIC16_SFR CM2CON0bits_t CM2CON0bits;
+typedef struct { unsigned TRISC0 : 1; unsigned TRISC1 : 1; unsigned TRISC2 : 1; } TRISCbits_t;
+PIC16_SFR TRISCbits_t TRISCbits;
+typedef struct { unsigned TRISA4 : 1; unsigned TRISA5 : 1; } TRISAbits_t;
+PIC16_SFR TRISAbits_t TRISAbits;
+
+#endif /* PIC16_XC_H_ */
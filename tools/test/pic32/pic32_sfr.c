@@ -0,0 +1,692 @@
+/**
+ * @brief       pic32_sfr.c
+ * @details     Host model of the PIC32MX470F512H: SFR definitions, UART1 FIFOs and line, DMA channels 0 and 1,
+ *              address translation.
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero (aqueronteblog@gmail.com)
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+#define PIC32_SFR_DEFINE
+#include <string.h>
+#include "xc.h"
+#include "sys/kmem.h"
+
+
+/**@brief Constants.
+ */
+#define PIC32_U1TX_EMPTY    0xFFFFFFFFUL    /*!<   U1TXREG: Nothing written                 */
+#define PIC32_U1_TXIF       0x00000100UL    /*!<   IFS1: U1TXIF                             */
+#define PIC32_U1_RXIF       0x00000080UL    /*!<   IFS1: U1RXIF                             */
+#define PIC32_U1_EIF        0x00000040UL    /*!<   IFS1: U1EIF                              */
+
+#define PIC32_DMA_CH        2U              /*!<   DMA channels                             */
+#define PIC32_DMA_FORCE     0x100U          /*!<   Event: CFORCE of channel 0 ( + channel ) */
+#define PIC32_DMA_EVENTS    32U             /*!<   Events waiting for the DMA, max.         */
+#define PIC32_DCH_CFORCE    0x00000080UL    /*!<   DCHxECON: CFORCE                         */
+#define PIC32_DCH_CHBCIF    0x00000008UL    /*!<   DCHxINT: Block complete                  */
+#define PIC32_DCH_CHDHIF    0x00000010UL    /*!<   DCHxINT: Destination half full           */
+#define PIC32_DMA0IF        0x00000100UL    /*!<   IFS2: DMA0IF, DMA1IF is the next bit     */
+
+#define PIC32_PA_MAX        64U             /*!<   Address windows                          */
+#define PIC32_PA_WINDOW     0x10000UL       /*!<   Address window size                      */
+
+
+/**@brief Variables.
+ */
+void ( *pic32_u1tx_hook ) ( uint8_t data );     /*!<   Every byte on the Tx line, NULL: Not used   */
+pic32_u1_stats_t    pic32_u1_stats;
+
+static U1STAbits_t  myU1sta;                    /*!<   U1STA as read and written by the module     */
+static uint8_t      myOerr;                     /*!<   OERR as set by the model                    */
+static uint32_t     myU1TxReg;                  /*!<   U1TXREG, last write                         */
+static uint32_t     myU1RxReg;                  /*!<   U1RXREG, last read                          */
+
+static uint8_t      myTxFifo[PIC32_U1_FIFO];
+static uint8_t      myTxCount;
+static uint8_t      myTxOut;                    /*!<   Oldest byte of the Tx FIFO                  */
+static uint8_t      myTsr;                      /*!<   Tx shift register                           */
+static uint8_t      myTsrBusy;
+
+static uint8_t      myRxFifo[PIC32_U1_FIFO];
+static uint8_t      myRxCount;
+static uint8_t      myRxOut;                    /*!<   Oldest byte of the Rx FIFO                  */
+
+static uint16_t     myEvents[PIC32_DMA_EVENTS]; /*!<   DMA events: IRQ or PIC32_DMA_FORCE + channel */
+static uint8_t      myEventIn;
+static uint8_t      myEventCount;
+static uint8_t      myDmaBusy;                  /*!<   1: The events are being served              */
+
+static const volatile void* myKva[PIC32_PA_MAX];    /*!<   Address windows: First address       */
+static uint32_t     myKvaCount;
+
+
+/**@brief Function prototypes.
+ */
+static void pic32_u1_update ( void );
+static void pic32_dma_event ( uint16_t event );
+static void pic32_dma_run   ( void );
+static void pic32_dma_cell  ( uint8_t ch );
+
+
+
+/**
+ * @brief       void pic32_reset ( void )
+ * @details     Every register and the UART1 model back to their reset state.
+ *
+ *
+ * @param[in]    N/A.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     pic32_u1tx_hook is not changed.
+ */
+void pic32_reset ( void )
+{
+    IFS1            =   0UL;
+    IFS1SET         =   0UL;
+    IFS1CLR         =   0UL;
+    IEC1            =   0UL;
+    IEC1SET         =   0UL;
+    IEC1CLR         =   0UL;
+    IFS2            =   0UL;
+    IFS2SET         =   0UL;
+    IFS2CLR         =   0UL;
+    IEC2            =   0UL;
+    IEC2SET         =   0UL;
+    IEC2CLR         =   0UL;
+
+    (void)memset ( (void*)&pic32_dmacon, 0, sizeof ( pic32_dmacon ) );
+    (void)memset ( (void*)pic32_dch, 0, sizeof ( pic32_dch ) );
+    myEventIn       =   0U;
+    myEventCount    =   0U;
+    myDmaBusy       =   0U;
+    myKvaCount      =   0UL;
+
+    (void)memset ( &myU1sta, 0, sizeof ( myU1sta ) );
+    (void)memset ( &pic32_u1_stats, 0, sizeof ( pic32_u1_stats ) );
+    myOerr          =   0U;
+    myU1TxReg       =   PIC32_U1TX_EMPTY;
+    myU1RxReg       =   0UL;
+    myTxCount       =   0U;
+    myTxOut         =   0U;
+    myTsrBusy       =   0U;
+    myRxCount       =   0U;
+    myRxOut         =   0U;
+
+    pic32_u1_update ();
+}
+
+
+/**
+ * @brief       volatile U1STAbits_t* pic32_u1sta ( void )
+ * @details     U1STAbits: The last write to U1TXREG goes into the Tx FIFO first, so the status is up to date.
+ *
+ *
+ * @param[in]    N/A.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      U1STA
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+volatile U1STAbits_t* pic32_u1sta ( void )
+{
+    pic32_u1_update ();
+
+    return &myU1sta;
+}
+
+
+/**
+ * @brief       volatile uint32_t* pic32_u1txreg ( void )
+ * @details     U1TXREG: The previous write goes into the Tx FIFO, the new one is kept until the next access.
+ *
+ *
+ * @param[in]    N/A.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      U1TXREG
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+volatile uint32_t* pic32_u1txreg ( void )
+{
+    pic32_u1_update ();
+
+    return &myU1TxReg;
+}
+
+
+/**
+ * @brief       volatile uint32_t* pic32_u1rxreg ( void )
+ * @details     U1RXREG: It takes the oldest byte out of the Rx FIFO ( 0 if it is empty ).
+ *
+ *
+ * @param[in]    N/A.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      U1RXREG
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+volatile uint32_t* pic32_u1rxreg ( void )
+{
+    pic32_u1_update ();
+
+    myU1RxReg   =   0UL;
+    if ( myRxCount != 0U )
+    {
+        myU1RxReg   =   myRxFifo[myRxOut];
+        myRxOut     =   ( myRxOut + 1U ) % PIC32_U1_FIFO;
+        myRxCount--;
+    }
+
+    pic32_u1_update ();
+
+    return &myU1RxReg;
+}
+
+
+/**
+ * @brief       void pic32_sync ( void )
+ * @details     It applies the SET and CLR registers ( CLR first ) and sets the UART1 interrupt flags whose
+ *              condition holds:
+ *
+ *                  - U1TXIF:   UTXISEL 0b00 Tx FIFO not full, 0b01 All sent, 0b10 Tx FIFO empty.
+ *                  - U1RXIF:   URXISEL 0b00 1 byte, 0b01 4 bytes, 0b10 6 bytes in the Rx FIFO.
+ *                  - U1EIF:    OERR.
+ *
+ *
+ * @param[in]    N/A.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         It is called after every call to the module under test.
+ * @warning     N/A
+ */
+void pic32_sync ( void )
+{
+    const uint8_t   rx_level[4] =   { 1U, 4U, 6U, 6U };
+    uint8_t         tx          =   0U;
+    uint8_t         ch          =   0U;
+
+    pic32_u1_update ();
+
+    IFS1   &=  ~IFS1CLR;
+    IFS1   |=   IFS1SET;
+    IEC1   &=  ~IEC1CLR;
+    IEC1   |=   IEC1SET;
+    IFS1CLR =   0UL;
+    IFS1SET =   0UL;
+    IEC1CLR =   0UL;
+    IEC1SET =   0UL;
+
+    IFS2   &=  ~IFS2CLR;
+    IFS2   |=   IFS2SET;
+    IEC2   &=  ~IEC2CLR;
+    IEC2   |=   IEC2SET;
+    IFS2CLR =   0UL;
+    IFS2SET =   0UL;
+    IEC2CLR =   0UL;
+    IEC2SET =   0UL;
+
+    /* DMA channels: DCHxCON before DCHxECON, a forced cell needs CHEN  */
+    for ( ch = 0U; ch < PIC32_DMA_CH; ch++ )
+    {
+        pic32_dch[ch].intr     &=  ~pic32_dch[ch].intclr;
+        pic32_dch[ch].con.w    |=   pic32_dch[ch].conset;
+        pic32_dch[ch].econ.w   |=   ( pic32_dch[ch].econset & ~PIC32_DCH_CFORCE );
+
+        if ( ( pic32_dch[ch].econset & PIC32_DCH_CFORCE ) != 0UL )
+        {
+            pic32_dma_event ( (uint16_t)( PIC32_DMA_FORCE + ch ) );
+        }
+
+        pic32_dch[ch].intclr    =   0UL;
+        pic32_dch[ch].conset    =   0UL;
+        pic32_dch[ch].econset   =   0UL;
+    }
+
+    switch ( myU1sta.UTXISEL )
+    {
+        case 0b00:
+            tx  =   ( myTxCount < PIC32_U1_FIFO ) ? 1U : 0U;
+            break;
+
+        case 0b01:
+            tx  =   myU1sta.TRMT;
+            break;
+
+        default:
+            tx  =   ( myTxCount == 0U ) ? 1U : 0U;
+            break;
+    }
+
+    if ( tx == 1U )
+    {
+        IFS1   |=   PIC32_U1_TXIF;
+    }
+
+    if ( myRxCount >= rx_level[myU1sta.URXISEL] )
+    {
+        IFS1   |=   PIC32_U1_RXIF;
+    }
+
+    if ( myOerr == 1U )
+    {
+        IFS1   |=   PIC32_U1_EIF;
+    }
+}
+
+
+/**
+ * @brief       uint8_t pic32_u1_slot ( void )
+ * @details     One character time: The byte in the shift register goes out ( pic32_u1tx_hook ) and the oldest
+ *              byte of the Tx FIFO takes its place.
+ *
+ *
+ * @param[in]    N/A.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      1: A byte was sent, 0: The line was idle
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+uint8_t pic32_u1_slot ( void )
+{
+    uint8_t sent    =   0U;
+
+    pic32_u1_update ();
+
+    sent    =   myTsrBusy;
+    if ( myTsrBusy == 1U )
+    {
+        myTsrBusy   =   0U;
+        pic32_u1_stats.sent++;
+
+        if ( pic32_u1tx_hook != NULL )
+        {
+            pic32_u1tx_hook ( myTsr );
+        }
+    }
+
+    pic32_u1_update ();
+
+    return sent;
+}
+
+
+/**
+ * @brief       void pic32_u1_rx ( uint8_t )
+ * @details     A byte is received: Into the Rx FIFO, or an overrun ( OERR ) if it is full. Nothing is received
+ *              until OERR is cleared.
+ *
+ *
+ * @param[in]    data:  The byte.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+void pic32_u1_rx ( uint8_t data )
+{
+    pic32_u1_update ();
+
+    if ( myOerr == 1U )
+    {
+        pic32_u1_stats.rx_lost++;
+    }
+    else if ( myRxCount == PIC32_U1_FIFO )
+    {
+        myOerr          =   1U;
+        myU1sta.OERR    =   1U;
+        pic32_u1_stats.overruns++;
+        pic32_u1_stats.rx_lost++;
+    }
+    else
+    {
+        myRxFifo[( myRxOut + myRxCount ) % PIC32_U1_FIFO]   =   data;
+        myRxCount++;
+        pic32_dma_event ( _UART1_RX_IRQ );
+    }
+
+    pic32_u1_update ();
+}
+
+
+/**
+ * @brief       void pic32_u1_update ( void )
+ * @details     UART1 state after the last access of the module: The write to U1TXREG goes into the Tx FIFO,
+ *              the Tx FIFO feeds the idle shift register, OERR cleared discards the Rx FIFO. Then the status
+ *              bits of U1STA.
+ *
+ *
+ * @param[in]    N/A.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+static void pic32_u1_update ( void )
+{
+    if ( myU1TxReg != PIC32_U1TX_EMPTY )
+    {
+        if ( myTxCount == PIC32_U1_FIFO )
+        {
+            pic32_u1_stats.lost++;
+        }
+        else
+        {
+            myTxFifo[( myTxOut + myTxCount ) % PIC32_U1_FIFO]   =   (uint8_t)myU1TxReg;
+            myTxCount++;
+        }
+        myU1TxReg   =   PIC32_U1TX_EMPTY;
+    }
+
+    if ( ( myTsrBusy == 0U ) && ( myTxCount != 0U ) )
+    {
+        myTsr       =   myTxFifo[myTxOut];
+        myTsrBusy   =   1U;
+        myTxOut     =   ( myTxOut + 1U ) % PIC32_U1_FIFO;
+        myTxCount--;
+        pic32_dma_event ( _UART1_TX_IRQ );
+    }
+
+    if ( ( myOerr == 1U ) && ( myU1sta.OERR == 0U ) )
+    {
+        myOerr      =   0U;
+        myRxCount   =   0U;
+    }
+
+    myU1sta.OERR    =   myOerr;
+    myU1sta.URXDA   =   ( myRxCount != 0U ) ? 1U : 0U;
+    myU1sta.UTXBF   =   ( myTxCount == PIC32_U1_FIFO ) ? 1U : 0U;
+    myU1sta.TRMT    =   ( ( myTsrBusy == 0U ) && ( myTxCount == 0U ) ) ? 1U : 0U;
+}
+
+
+/**
+ * @brief       uint32_t pic32_kva_to_pa ( const volatile void* ), volatile void* pic32_pa_to_kva ( uint32_t )
+ * @details     Address translation: The physical address is the window number ( high half ) and the offset
+ *              into it. A new window is opened for an address which is not in one yet.
+ *
+ *
+ * @return      The address
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     More than PIC32_PA_MAX windows: The address 0.
+ */
+uint32_t pic32_kva_to_pa ( const volatile void* kva )
+{
+    const volatile uint8_t* p   =   (const volatile uint8_t*)kva;
+    const volatile uint8_t* w   =   NULL;
+    uint32_t                i   =   0UL;
+
+    for ( i = 0UL; i < myKvaCount; i++ )
+    {
+        w   =   (const volatile uint8_t*)myKva[i];
+        if ( ( p >= w ) && ( ( p - w ) < (ptrdiff_t)PIC32_PA_WINDOW ) )
+        {
+            return ( ( i + 1UL ) * PIC32_PA_WINDOW ) + (uint32_t)( p - w );
+        }
+    }
+
+    if ( myKvaCount == PIC32_PA_MAX )
+    {
+        return 0UL;
+    }
+
+    myKva[myKvaCount++] =   kva;
+
+    return myKvaCount * PIC32_PA_WINDOW;
+}
+
+volatile void* pic32_pa_to_kva ( uint32_t pa )
+{
+    uint32_t    i   =   pa / PIC32_PA_WINDOW;
+
+    if ( ( i == 0UL ) || ( i > myKvaCount ) )
+    {
+        return NULL;
+    }
+
+    return (volatile void*)( (const volatile uint8_t*)myKva[i - 1UL] + ( pa % PIC32_PA_WINDOW ) );
+}
+
+
+/**
+ * @brief       void pic32_dma_event ( uint16_t )
+ * @details     A start event ( IRQ ) or a forced cell for the DMA channels. It is served now, or after the
+ *              cell in progress.
+ *
+ *
+ * @param[in]    event: IRQ, or PIC32_DMA_FORCE + channel.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+static void pic32_dma_event ( uint16_t event )
+{
+    if ( myEventCount < PIC32_DMA_EVENTS )
+    {
+        myEvents[( myEventIn + myEventCount ) % PIC32_DMA_EVENTS]   =   event;
+        myEventCount++;
+    }
+
+    pic32_dma_run ();
+}
+
+
+/**
+ * @brief       void pic32_dma_run ( void )
+ * @details     It serves the events: A cell on every enabled channel started by it. An event is lost if no
+ *              channel takes it.
+ *
+ *
+ * @param[in]    N/A.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+static void pic32_dma_run ( void )
+{
+    uint16_t    event   =   0U;
+    uint8_t     ch      =   0U;
+
+    if ( myDmaBusy == 1U )
+    {
+        return;
+    }
+
+    myDmaBusy   =   1U;
+
+    while ( myEventCount != 0U )
+    {
+        event       =   myEvents[myEventIn];
+        myEventIn   =   ( myEventIn + 1U ) % PIC32_DMA_EVENTS;
+        myEventCount--;
+
+        for ( ch = 0U; ch < PIC32_DMA_CH; ch++ )
+        {
+            if ( ( pic32_dmacon.bits.ON == 0U ) || ( pic32_dch[ch].con.bits.CHEN == 0U ) )
+            {
+                continue;
+            }
+
+            if ( ( event == ( PIC32_DMA_FORCE + ch ) ) ||
+                 ( ( pic32_dch[ch].econ.bits.SIRQEN == 1U ) && ( pic32_dch[ch].econ.bits.CHSIRQ == event ) ) )
+            {
+                pic32_dma_cell ( ch );
+            }
+        }
+    }
+
+    myDmaBusy   =   0U;
+}
+
+
+/**
+ * @brief       void pic32_dma_cell ( uint8_t )
+ * @details     One cell of a channel: DCHxCSIZ bytes, the pointers wrap at DCHxSSIZ and DCHxDSIZ. The block is
+ *              complete after the larger of both or at the pattern ( PATEN ): CHBCIF, the channel is disabled
+ *              unless CHAEN. The destination half full sets CHDHIF. A flag enabled in DCHxINT sets DMAxIF.
+ *
+ *
+ * @param[in]    ch:    Channel.
+ *
+ * @param[out]   N/A.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     U1RXREG as the source reads the Rx FIFO, U1TXREG as the destination writes the Tx FIFO.
+ */
+static void pic32_dma_cell ( uint8_t ch )
+{
+    volatile pic32_dch_t*   d       =   &pic32_dch[ch];
+    volatile uint8_t*       src     =   NULL;
+    volatile uint8_t*       dst     =   NULL;
+    uint32_t                ssiz    =   ( d->ssiz == 0UL ) ? PIC32_PA_WINDOW : d->ssiz;
+    uint32_t                dsiz    =   ( d->dsiz == 0UL ) ? PIC32_PA_WINDOW : d->dsiz;
+    uint32_t                csiz    =   ( d->csiz == 0UL ) ? PIC32_PA_WINDOW : d->csiz;
+    uint32_t                i       =   0UL;
+    uint32_t                flags   =   0UL;
+    uint8_t                 b       =   0U;
+    uint8_t                 done    =   0U;
+
+    for ( i = 0UL; ( i < csiz ) && ( done == 0U ); i++ )
+    {
+        src =   (volatile uint8_t*)pic32_pa_to_kva ( d->ssa ) + d->sptr;
+        dst =   (volatile uint8_t*)pic32_pa_to_kva ( d->dsa ) + d->dptr;
+
+        /* The pointers first: Writing U1TXREG may start the next cell   */
+        d->sptr     =   ( d->sptr + 1UL ) % ssiz;
+        d->dptr     =   ( d->dptr + 1UL ) % dsiz;
+        d->count++;
+
+        if ( ( dsiz > 1UL ) && ( d->dptr == ( dsiz / 2UL ) ) )
+        {
+            flags  |=   PIC32_DCH_CHDHIF;
+        }
+
+        if ( src == (volatile uint8_t*)&myU1RxReg )
+        {
+            (void)pic32_u1rxreg ();
+            b   =   (uint8_t)myU1RxReg;
+        }
+        else
+        {
+            b   =   *src;
+        }
+
+        if ( ( d->count == ( ( ssiz > dsiz ) ? ssiz : dsiz ) ) ||
+             ( ( d->econ.bits.PATEN == 1U ) && ( b == (uint8_t)d->dat ) ) )
+        {
+            flags      |=   PIC32_DCH_CHBCIF;
+            d->sptr     =   0UL;
+            d->dptr     =   0UL;
+            d->count    =   0UL;
+            done        =   1U;
+
+            if ( d->con.bits.CHAEN == 0U )
+            {
+                d->con.bits.CHEN    =   0U;
+            }
+        }
+
+        if ( dst == (volatile uint8_t*)&myU1TxReg )
+        {
+            myU1TxReg   =   b;
+            pic32_u1_update ();
+        }
+        else
+        {
+            *dst    =   b;
+        }
+    }
+
+    d->intr    |=   flags;
+    if ( ( ( d->intr >> 16U ) & d->intr & 0xFFUL ) != 0UL )
+    {
+        IFS2   |=   ( PIC32_DMA0IF << ch );
+    }
+}
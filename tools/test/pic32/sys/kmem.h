@@ -0,0 +1,24 @@
+/**
+ * @brief       kmem.h
+ * @details     Host model of the PIC32 address translation ( tools/test ): A physical address is a window of
+ *              64 KB onto the host memory, opened by the first address translated into it.
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero (aqueronteblog@gmail.com)
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         Host build only ( tools/test/Makefile ).
+ * @warning     N/A
+ */
+#ifndef PIC32_KMEM_H_
+#define PIC32_KMEM_H_
+
+#include <stdint.h>
+
+uint32_t        pic32_kva_to_pa ( const volatile void* kva );
+volatile void*  pic32_pa_to_kva ( uint32_t pa );
+
+#define KVA_TO_PA( v )      pic32_kva_to_pa ( (const volatile void*)( v ) )
+
+#endif /* PIC32_KMEM_H_ */
@@ -0,0 +1,179 @@
+/**
+ * @brief       xc.h
+ * @details     Host model of the PIC32MX470F512H registers used by the host tests ( tools/test ). The SFRs are
+ *              plain variables, defined once by pic32_sfr.c, except the UART1 ones, which are read and written
+ *              through the model:
+ *
+ *                  - U1TXREG:   A write goes into the 8-deep Tx FIFO, lost and counted if it is full.
+ *                  - U1RXREG:   A read takes the oldest byte out of the 8-deep Rx FIFO.
+ *                  - U1STAbits: UTXBF, TRMT and URXDA are worked out on every access. Clearing OERR discards
+ *                               the Rx FIFO.
+ *
+ *              The line is modelled one character time at a time ( pic32_u1_slot() ) and the received bytes
+ *              are injected by the test ( pic32_u1_rx() ). The SET and CLR registers are plain variables as
+ *              well: pic32_sync() applies them, the test calls it after the module under test. It also sets
+ *              the UART1 interrupt flags while their condition holds ( UTXISEL, URXISEL, OERR ), as the
+ *              hardware does: A flag cleared by the ISR is set again if the condition is still true.
+ *
+ *              DMA channels 0 and 1: One cell per start event ( CHSIRQ, SIRQEN ) or per CFORCE, the pattern
+ *              match ( PATEN ), the half and block complete flags and their interrupt ( IFS2 ), auto-enable
+ *              ( CHAEN ). The UART1 start events are edges: Tx, a byte goes from the Tx FIFO into the shift
+ *              register ( one free space ), Rx, a byte comes into the Rx FIFO. An event is lost if the
+ *              channel is disabled. The addresses are translated by sys/kmem.h.
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero (aqueronteblog@gmail.com)
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         Host build only ( tools/test/Makefile ).
+ * @warning     N/A
+ */
+#ifndef PIC32_XC_H_
+#define PIC32_XC_H_
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifndef __XC32
+#define __XC32  1
+#endif
+
+#ifdef PIC32_SFR_DEFINE
+#define PIC32_SFR   volatile
+#else
+#define PIC32_SFR   extern volatile
+#endif
+
+
+/**@brief Constants.
+ */
+#define PIC32_U1_FIFO       8U              /*!<   UART1 Tx and Rx FIFO depth       */
+
+#define _UART1_RX_IRQ               39
+#define _UART1_TX_IRQ               40
+
+#define _IFS2_DMA0IF_MASK           0x00000100UL
+#define _IFS2_DMA1IF_MASK           0x00000200UL
+#define _IEC2_DMA0IE_MASK           0x00000100UL
+#define _IEC2_DMA1IE_MASK           0x00000200UL
+
+#define _DCH0CON_CHEN_MASK          0x00000080UL
+#define _DCH0ECON_CFORCE_MASK       0x00000080UL
+#define _DCH0INT_CHBCIE_MASK        0x00080000UL
+#define _DCH1INT_CHBCIF_MASK        0x00000008UL
+#define _DCH1INT_CHDHIF_MASK        0x00000010UL
+#define _DCH1INT_CHBCIE_MASK        0x00080000UL
+#define _DCH1INT_CHDHIE_MASK        0x00100000UL
+
+
+/**@brief UART1.
+ */
+typedef struct { unsigned URXDA : 1; unsigned OERR : 1; unsigned FERR : 1; unsigned PERR : 1; unsigned RIDLE : 1; unsigned ADDEN : 1; unsigned URXISEL : 2;
+                 unsigned TRMT : 1; unsigned UTXBF : 1; unsigned UTXEN : 1; unsigned UTXBRK : 1; unsigned URXEN : 1; unsigned UTXINV : 1; unsigned UTXISEL : 2;
+                 unsigned ADDR : 8; unsigned ADM_EN : 1; } U1STAbits_t;
+
+volatile U1STAbits_t*   pic32_u1sta     ( void );
+volatile uint32_t*      pic32_u1txreg   ( void );
+volatile uint32_t*      pic32_u1rxreg   ( void );
+
+#define U1STAbits           ( *pic32_u1sta () )
+#define U1TXREG             ( *pic32_u1txreg () )
+#define U1RXREG             ( *pic32_u1rxreg () )
+
+
+/**@brief Interrupt controller.
+ */
+PIC32_SFR uint32_t IFS1;
+PIC32_SFR uint32_t IFS1SET;
+PIC32_SFR uint32_t IFS1CLR;
+PIC32_SFR uint32_t IEC1;
+PIC32_SFR uint32_t IEC1SET;
+PIC32_SFR uint32_t IEC1CLR;
+PIC32_SFR uint32_t IFS2;
+PIC32_SFR uint32_t IFS2SET;
+PIC32_SFR uint32_t IFS2CLR;
+PIC32_SFR uint32_t IEC2;
+PIC32_SFR uint32_t IEC2SET;
+PIC32_SFR uint32_t IEC2CLR;
+
+
+/**@brief DMA controller.
+ */
+typedef struct { unsigned : 15; unsigned ON : 1; } DMACONbits_t;
+typedef struct { unsigned CHPRI : 2; unsigned CHEDET : 1; unsigned : 1; unsigned CHAEN : 1; unsigned CHCHN : 1; unsigned CHAED : 1; unsigned CHEN : 1;
+                 unsigned CHCHNS : 1; unsigned : 6; unsigned CHBUSY : 1; } DCHCONbits_t;
+typedef struct { unsigned : 3; unsigned AIRQEN : 1; unsigned SIRQEN : 1; unsigned PATEN : 1; unsigned CABORT : 1; unsigned CFORCE : 1;
+                 unsigned CHSIRQ : 8; unsigned CHAIRQ : 8; } DCHECONbits_t;
+
+typedef struct{
+  union { uint32_t w; DCHCONbits_t bits; }  con;
+  union { uint32_t w; DCHECONbits_t bits; } econ;
+  uint32_t  intr;           /*!<   DCHxINT                                         */
+  uint32_t  ssa;
+  uint32_t  dsa;
+  uint32_t  ssiz;
+  uint32_t  dsiz;
+  uint32_t  csiz;
+  uint32_t  dat;
+  uint32_t  conset;         /*!<   DCHxCONSET                                      */
+  uint32_t  econset;        /*!<   DCHxECONSET                                     */
+  uint32_t  intclr;         /*!<   DCHxINTCLR                                      */
+  uint32_t  sptr;           /*!<   Model: Source pointer                           */
+  uint32_t  dptr;           /*!<   Model: Destination pointer                      */
+  uint32_t  count;          /*!<   Model: Bytes of the block                       */
+} pic32_dch_t;
+
+PIC32_SFR union { uint32_t w; DMACONbits_t bits; } pic32_dmacon;
+PIC32_SFR pic32_dch_t pic32_dch[2];
+
+#define DMACONbits          pic32_dmacon.bits
+#define DCH0CON             pic32_dch[0].con.w
+#define DCH0CONbits         pic32_dch[0].con.bits
+#define DCH0CONSET          pic32_dch[0].conset
+#define DCH0ECON            pic32_dch[0].econ.w
+#define DCH0ECONbits        pic32_dch[0].econ.bits
+#define DCH0ECONSET         pic32_dch[0].econset
+#define DCH0INT             pic32_dch[0].intr
+#define DCH0INTCLR          pic32_dch[0].intclr
+#define DCH0SSA             pic32_dch[0].ssa
+#define DCH0DSA             pic32_dch[0].dsa
+#define DCH0SSIZ            pic32_dch[0].ssiz
+#define DCH0DSIZ            pic32_dch[0].dsiz
+#define DCH0CSIZ            pic32_dch[0].csiz
+#define DCH0DAT             pic32_dch[0].dat
+#define DCH1CON             pic32_dch[1].con.w
+#define DCH1CONbits         pic32_dch[1].con.bits
+#define DCH1CONSET          pic32_dch[1].conset
+#define DCH1ECON            pic32_dch[1].econ.w
+#define DCH1ECONbits        pic32_dch[1].econ.bits
+#define DCH1ECONSET         pic32_dch[1].econset
+#define DCH1INT             pic32_dch[1].intr
+#define DCH1INTCLR          pic32_dch[1].intclr
+#define DCH1SSA             pic32_dch[1].ssa
+#define DCH1DSA             pic32_dch[1].dsa
+#define DCH1SSIZ            pic32_dch[1].ssiz
+#define DCH1DSIZ            pic32_dch[1].dsiz
+#define DCH1CSIZ            pic32_dch[1].csiz
+#define DCH1DAT             pic32_dch[1].dat
+
+
+/**@brief Model.
+ */
+typedef struct{
+  uint32_t  sent;           /*!<   Bytes on the Tx line                            */
+  uint32_t  lost;           /*!<   Bytes written to U1TXREG, Tx FIFO full          */
+  uint32_t  overruns;       /*!<   Overruns ( OERR set )                           */
+  uint32_t  rx_lost;        /*!<   Bytes received, lost by an overrun              */
+} pic32_u1_stats_t;
+
+extern void             ( *pic32_u1tx_hook ) ( uint8_t data );
+extern pic32_u1_stats_t pic32_u1_stats;
+
+void    pic32_reset     ( void );
+void    pic32_sync      ( void );
+uint8_t pic32_u1_slot   ( void );
+void    pic32_u1_rx     ( uint8_t data );
+
+
+#endif /* PIC32_XC_H_ */
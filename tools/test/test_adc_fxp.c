@@ -0,0 +1,309 @@
+/**
+ * @brief       test_adc_fxp.c
+ * @details     Host test of the fixed-point conversion and formatting of the ADC results ( adc_an0.X,
+ *              adc_fxp.c, the same in adc_internal_temperature.X ).
+ *
+ *              The float formula printed with sprintf() is the reference:
+ *
+ *                  - Conversion: The 1024 ADC codes, millivolts ( "%0.3f" ) and centivolts ( "%0.2f" ), must
+ *                    give the same digits.
+ *                  - Oversampling: The 10 + n bit results ( n = 1 to 3, ADC_FXP_SCALE_OVS() ) must be within
+ *                    ADC_FXP_OVS_ERR_MAX units of the float formula.
+ *                  - Formatting: Every 16-bit value with 0 to 4 decimals must match "%u.%0*u".
+ *
+ *              It prints the host time of both paths per result.
+ *
+ *              Build and run: make -C tools/test
+ *
+ * @return      0: Pass, 1: Fail
+ *
+ * @author      Manuel Caballero (aqueronteblog@gmail.com)
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "adc_fxp.h"
+
+
+/**@brief Constants.
+ */
+#define ADC_FXP_CODES           1024U       /*!<   10-bit ADC codes                             */
+#define ADC_FXP_OVS_MAX         3U          /*!<   Oversampling, max. extra bits                */
+#define ADC_FXP_OVS_ERR_MAX     0.55        /*!<   Oversampled results: Max. error, units       */
+#define ADC_FXP_RUNS            200U        /*!<   Timing: Passes over the 1024 codes           */
+
+
+/**@brief Variables.
+ */
+static volatile uint8_t mySink;             /*!<   Keeps the timed code                         */
+
+
+/**@brief Function prototypes.
+ */
+static uint8_t  check_convert   ( void );
+static uint8_t  check_ovs       ( void );
+static uint8_t  check_format    ( void );
+static double   elapsed_ns      ( const struct timespec* t0, const struct timespec* t1 );
+static void     timing          ( void );
+
+
+
+/**
+ * @brief       uint8_t check_convert ( void )
+ * @details     The 1024 codes: Millivolts and centivolts against the float formula, digit by digit.
+ *
+ *
+ * @return      0: Pass, 1: Fail
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+static uint8_t check_convert ( void )
+{
+    char        ref[16];
+    uint8_t     buff[8];
+    uint8_t     n       =   0U;
+    uint16_t    code    =   0U;
+    uint16_t    diffs   =   0U;
+
+    for ( code = 0U; code < ADC_FXP_CODES; code++ )
+    {
+        /* Millivolts  */
+        (void)sprintf ( ref, "%0.3f", ( code * ADC_VDD_REF ) / ADC_RES );
+        n   =   adc_fxp_format ( adc_fxp_to_mv ( code ), 3U, buff );
+        if ( ( n != strlen ( ref ) ) || ( memcmp ( buff, ref, n ) != 0 ) )
+        {
+            if ( diffs++ < 5U )
+            {
+                printf ( "FAIL: Code %u, %.*s V, float: %s V\n", code, n, buff, ref );
+            }
+        }
+
+        /* Centivolts  */
+        (void)sprintf ( ref, "%0.2f", ( code * ADC_VDD_REF ) / ADC_RES );
+        n   =   adc_fxp_format ( adc_fxp_to_cv ( code ), 2U, buff );
+        if ( ( n != strlen ( ref ) ) || ( memcmp ( buff, ref, n ) != 0 ) )
+        {
+            if ( diffs++ < 5U )
+            {
+                printf ( "FAIL: Code %u, %.*s V, float: %s V\n", code, n, buff, ref );
+            }
+        }
+    }
+
+    printf ( "Conversion: %u codes, mV and cV, %u differences with the float formula\n", ADC_FXP_CODES, diffs );
+
+    return ( diffs == 0U ) ? 0U : 1U;
+}
+
+
+/**
+ * @brief       uint8_t check_ovs ( void )
+ * @details     Oversampled results ( 10 + n bits ), millivolts against the float formula.
+ *
+ *
+ * @return      0: Pass, 1: Fail
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+static uint8_t check_ovs ( void )
+{
+    const uint32_t  scale[ADC_FXP_OVS_MAX + 1U]   =   { ADC_FXP_SCALE_MV, ADC_FXP_SCALE_OVS( 1000.0, 1U ),
+                                                        ADC_FXP_SCALE_OVS( 1000.0, 2U ), ADC_FXP_SCALE_OVS( 1000.0, 3U ) };
+    uint32_t        code    =   0UL;
+    uint32_t        codes   =   0UL;
+    uint32_t        diffs   =   0UL;
+    double          ref     =   0.0;
+    double          err     =   0.0;
+    double          err_max =   0.0;
+    uint8_t         ovs     =   0U;
+    uint8_t         fail    =   0U;
+
+    for ( ovs = 1U; ovs <= ADC_FXP_OVS_MAX; ovs++ )
+    {
+        codes   =   ( ADC_FXP_CODES << ovs ) - ( 1UL << ovs ) + 1UL;
+        diffs   =   0UL;
+        err_max =   0.0;
+
+        for ( code = 0UL; code < codes; code++ )
+        {
+            ref     =   ( ( code * ADC_VDD_REF * 1000.0 ) / ( ADC_RES * (double)( 1UL << ovs ) ) );
+            err     =   (double)adc_fxp_convert ( (uint16_t)code, scale[ovs] ) - ref;
+            err     =   ( err < 0.0 ) ? -err : err;
+            err_max =   ( err > err_max ) ? err : err_max;
+
+            if ( (uint16_t)( ref + 0.5 ) != adc_fxp_convert ( (uint16_t)code, scale[ovs] ) )
+            {
+                diffs++;
+            }
+        }
+
+        printf ( "Oversampling n = %u: %lu codes, %lu rounded differently, max. error %.3f mV\n", ovs, (unsigned long)codes,
+                 (unsigned long)diffs, err_max );
+
+        if ( err_max > ADC_FXP_OVS_ERR_MAX )
+        {
+            printf ( "FAIL: Oversampling n = %u, error %.3f mV, max. %.2f\n", ovs, err_max, ADC_FXP_OVS_ERR_MAX );
+            fail    =   1U;
+        }
+    }
+
+    return fail;
+}
+
+
+/**
+ * @brief       uint8_t check_format ( void )
+ * @details     Every 16-bit value with 0 to 4 decimals against sprintf().
+ *
+ *
+ * @return      0: Pass, 1: Fail
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+static uint8_t check_format ( void )
+{
+    const uint16_t  pow10[5]    =   { 1U, 10U, 100U, 1000U, 10000U };
+    char            ref[16];
+    uint8_t         buff[8];
+    uint8_t         n       =   0U;
+    uint8_t         dec     =   0U;
+    uint32_t        value   =   0UL;
+    uint32_t        diffs   =   0UL;
+
+    for ( dec = 0U; dec <= 4U; dec++ )
+    {
+        for ( value = 0UL; value <= 0xFFFFUL; value++ )
+        {
+            if ( dec == 0U )
+            {
+                (void)sprintf ( ref, "%lu", (unsigned long)value );
+            }
+            else
+            {
+                (void)sprintf ( ref, "%lu.%0*lu", (unsigned long)( value / pow10[dec] ), dec, (unsigned long)( value % pow10[dec] ) );
+            }
+
+            n   =   adc_fxp_format ( (uint16_t)value, dec, buff );
+            if ( ( n != strlen ( ref ) ) || ( memcmp ( buff, ref, n ) != 0 ) )
+            {
+                if ( diffs++ < 5UL )
+                {
+                    printf ( "FAIL: %lu, %u decimals: %.*s, expected %s\n", (unsigned long)value, dec, n, buff, ref );
+                }
+            }
+        }
+    }
+
+    printf ( "Formatting: 65536 values x 5, %lu differences with sprintf()\n", (unsigned long)diffs );
+
+    return ( diffs == 0UL ) ? 0U : 1U;
+}
+
+
+/**
+ * @brief       double elapsed_ns ( const struct timespec* , const struct timespec* )
+ * @details     Time between two readings of CLOCK_MONOTONIC.
+ *
+ *
+ * @param[in]    t0:    Start.
+ * @param[in]    t1:    End.
+ *
+ *
+ * @return      Time, ns
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+static double elapsed_ns ( const struct timespec* t0, const struct timespec* t1 )
+{
+    return ( ( t1->tv_sec - t0->tv_sec ) * 1e9 ) + ( t1->tv_nsec - t0->tv_nsec );
+}
+
+
+/**
+ * @brief       void timing ( void )
+ * @details     Host time per result: Fixed-point path against float and sprintf().
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     The host only gives the ratio of both paths, the cycles on the PIC16 ( no FPU, 8-bit ) are
+ *              not measured here.
+ */
+static void timing ( void )
+{
+    struct timespec t0, t1;
+    char            ref[16];
+    uint8_t         buff[8];
+    uint16_t        code    =   0U;
+    uint16_t        run     =   0U;
+    double          fxp     =   0.0;
+    double          flt     =   0.0;
+
+    (void)clock_gettime ( CLOCK_MONOTONIC, &t0 );
+    for ( run = 0U; run < ADC_FXP_RUNS; run++ )
+    {
+        for ( code = 0U; code < ADC_FXP_CODES; code++ )
+        {
+            mySink ^=   adc_fxp_format ( adc_fxp_to_mv ( code ), 3U, buff );
+            mySink ^=   buff[0];
+        }
+    }
+    (void)clock_gettime ( CLOCK_MONOTONIC, &t1 );
+    fxp =   elapsed_ns ( &t0, &t1 ) / ( (double)ADC_FXP_RUNS * ADC_FXP_CODES );
+
+    (void)clock_gettime ( CLOCK_MONOTONIC, &t0 );
+    for ( run = 0U; run < ADC_FXP_RUNS; run++ )
+    {
+        for ( code = 0U; code < ADC_FXP_CODES; code++ )
+        {
+            mySink ^=   (uint8_t)sprintf ( ref, "%0.3f", ( code * ADC_VDD_REF ) / ADC_RES );
+            mySink ^=   (uint8_t)ref[0];
+        }
+    }
+    (void)clock_gettime ( CLOCK_MONOTONIC, &t1 );
+    flt =   elapsed_ns ( &t0, &t1 ) / ( (double)ADC_FXP_RUNS * ADC_FXP_CODES );
+
+    printf ( "Host time per result: fixed-point %.1f ns, float and sprintf() %.1f ns ( x%.1f )\n", fxp, flt, flt / fxp );
+}
+
+
+/**@brief Function for application main entry.
+ */
+int main ( void )
+{
+    uint8_t fail    =   0U;
+
+    fail   |=   check_convert ();
+    fail   |=   check_ovs ();
+    fail   |=   check_format ();
+    timing ();
+
+    printf ( "test_adc_fxp: %s\n", ( fail == 0U ) ? "PASS" : "FAIL" );
+
+    return ( fail == 0U ) ? 0 : 1;
+}
@@ -0,0 +1,284 @@
+/**
+ * @brief       test_adc_ovs.c
+ * @details     Host test of the ADC scan engine oversampling and decimation ( adc_an0.X, adc_scan.c ).
+ *
+ *              The ADC is modelled: every conversion returns a 10-bit code of a known input ( in 10-bit LSB,
+ *              with a fraction ) plus gaussian noise, rounded and clamped. For n = 1 to 3, boxcar and CIC2:
+ *
+ *                  - Resolution: The input is swept in steps of 1/2^n LSB. The mean of the decimated results
+ *                    must follow every step ( 10 + n bits ), within ADC_OVS_BIAS_MAX LSB of the exact value.
+ *                  - Noise: The standard deviation of the results around their mean ( scaled to 10-bit LSB )
+ *                    must be at least n - ADC_OVS_GAIN_LOSS bits lower than the one of the raw samples.
+ *
+ *              Build and run: make -C tools/test
+ *
+ * @return      0: Pass, 1: Fail
+ *
+ * @author      Manuel Caballero (aqueronteblog@gmail.com)
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+#include <math.h>
+#include <stdio.h>
+#include "adc_scan.h"
+
+
+/**@brief Constants.
+ */
+#define ADC_OVS_NOISE       0.7         /*!<   Input noise, LSB rms ( dither )                          */
+#define ADC_OVS_BASE        400.0       /*!<   Input of the sweep, first step, LSB                      */
+#define ADC_OVS_LSBS        4U          /*!<   10-bit LSBs swept                                        */
+#define ADC_OVS_RESULTS     256U        /*!<   Decimated results averaged per step                      */
+#define ADC_OVS_SETTLE      2U          /*!<   Results skipped after a step ( CIC2 latency )            */
+#define ADC_OVS_BIAS_MAX    0.75        /*!<   Max. error of the mean, 10 + n bit LSB ( truncation )    */
+#define ADC_OVS_GAIN_LOSS   0.3         /*!<   Resolution gain which may be lost, bits                  */
+
+
+/**@brief Variables.
+ */
+static double               myInput;        /*!<   ADC input, 10-bit LSB            */
+static uint32_t             mySeed  =   1UL;
+static uint16_t             myBuff[4];
+static adc_scan_channel_t   myChannel;
+static double               myRawSum;       /*!<   Raw samples: Sum of errors       */
+static double               myRawSq;        /*!<   Raw samples: Sum of squares      */
+static uint32_t             myRawN;         /*!<   Raw samples                      */
+
+
+/**@brief Function prototypes.
+ */
+static double   noise       ( void );
+static uint16_t adc_convert ( void );
+static uint16_t adc_result  ( void );
+static uint8_t  run         ( uint8_t ovs, adc_scan_avg_t avg );
+
+
+
+/**
+ * @brief       double noise ( void )
+ * @details     Gaussian noise, 1 rms ( Irwin-Hall, 12 uniform numbers, xorshift32 ).
+ *
+ *
+ * @return      Noise sample
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+static double noise ( void )
+{
+    double  sum =   0.0;
+    uint8_t i   =   0U;
+
+    for ( i = 0U; i < 12U; i++ )
+    {
+        mySeed ^=   mySeed << 13U;
+        mySeed ^=   mySeed >> 17U;
+        mySeed ^=   mySeed << 5U;
+        sum    +=   (double)mySeed / 4294967296.0;
+    }
+
+    return sum - 6.0;
+}
+
+
+/**
+ * @brief       uint16_t adc_convert ( void )
+ * @details     ADC model: input plus noise, rounded to a 10-bit code. The raw error is kept.
+ *
+ *
+ * @return      10-bit code
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+static uint16_t adc_convert ( void )
+{
+    double  x       =   floor ( myInput + ( ADC_OVS_NOISE * noise () ) + 0.5 );
+    double  e       =   0.0;
+
+    if ( x < 0.0 )
+    {
+        x   =   0.0;
+    }
+    else if ( x > 1023.0 )
+    {
+        x   =   1023.0;
+    }
+
+    e           =   x - myInput;
+    myRawSum   +=   e;
+    myRawSq    +=   e * e;
+    myRawN++;
+
+    return (uint16_t)x;
+}
+
+
+/**
+ * @brief       uint16_t adc_result ( void )
+ * @details     It runs one scan of the channel, the way the interrupts do ( Timer4, GO, ADIF ), and returns
+ *              its decimated result.
+ *
+ *
+ * @return      Result, 10 + n bits
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+static uint16_t adc_result ( void )
+{
+    uint16_t    code    =   0U;
+    uint16_t    result  =   0U;
+
+    (void)adc_scan_start ();
+
+    while ( adc_scan_busy () == 1U )
+    {
+        if ( T4CONbits.TMR4ON == 1U )
+        {
+            /* Acquisition delay over  */
+            adc_scan_tmr4_isr ();
+        }
+        else if ( ADCON0bits.GO_nDONE == 1U )
+        {
+            /* Conversion done, ADIF  */
+            code                =   adc_convert ();
+            ADRESH              =   (uint8_t)( code >> 8U );
+            ADRESL              =   (uint8_t)code;
+            ADCON0bits.GO_nDONE =   0U;
+            adc_scan_isr ();
+        }
+        else
+        {
+            printf ( "FAIL: The scan is stuck\n" );
+            return 0U;
+        }
+    }
+
+    (void)adc_scan_read ( &myChannel, &result );
+
+    return result;
+}
+
+
+/**
+ * @brief       uint8_t run ( uint8_t , adc_scan_avg_t )
+ * @details     Resolution and noise checks of one setting.
+ *
+ *
+ * @param[in]    ovs:       Oversampling n.
+ * @param[in]    avg:       Decimation filter.
+ *
+ *
+ * @return      0: Pass, 1: Fail
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+static uint8_t run ( uint8_t ovs, adc_scan_avg_t avg )
+{
+    const double    scale   =   (double)( 1U << ovs );
+    const uint32_t  steps   =   ADC_OVS_LSBS << ovs;
+    uint8_t         fail    =   0U;
+    uint32_t        k       =   0UL;
+    uint32_t        i       =   0UL;
+    double          r[ADC_OVS_RESULTS];
+    double          sum     =   0.0;
+    double          mean    =   0.0;
+    double          prev    =   -1.0;
+    double          bias    =   0.0;
+    double          out_sq  =   0.0;
+    uint32_t        out_n   =   0UL;
+    double          raw_sd  =   0.0;
+    double          out_sd  =   0.0;
+    double          gain    =   0.0;
+
+    myChannel   =   ( adc_scan_channel_t ){ .chs = ADC_SCAN_AN0, .acq = ADC_SCAN_ACQ_US( 5U ), .buff = &myBuff[0], .size = 4U, .ovs = ovs, .avg = avg };
+    adc_scan_init ( &myChannel, 1U );
+    myRawSum    =   0.0;
+    myRawSq     =   0.0;
+    myRawN      =   0UL;
+
+    for ( k = 0UL; k < steps; k++ )
+    {
+        myInput =   ADC_OVS_BASE + ( (double)k / scale );
+
+        for ( i = 0UL; i < ADC_OVS_SETTLE; i++ )
+        {
+            (void)adc_result ();
+        }
+
+        sum =   0.0;
+        for ( i = 0UL; i < ADC_OVS_RESULTS; i++ )
+        {
+            r[i]    =   (double)adc_result ();
+            sum    +=   r[i];
+        }
+        mean    =   sum / ADC_OVS_RESULTS;
+
+        for ( i = 0UL; i < ADC_OVS_RESULTS; i++ )
+        {
+            out_sq +=   ( ( r[i] - mean ) / scale ) * ( ( r[i] - mean ) / scale );
+            out_n++;
+        }
+
+        /* Every step of 1/2^n LSB is resolved  */
+        bias    =   mean - ( myInput * scale );
+        if ( ( bias > ADC_OVS_BIAS_MAX ) || ( bias < -ADC_OVS_BIAS_MAX ) || ( mean <= prev ) )
+        {
+            printf ( "FAIL: n = %u, %s, input %.4f LSB: mean %.3f, expected %.3f\n", ovs, ( avg == ADC_SCAN_AVG_CIC2 ) ? "CIC2" : "boxcar",
+                     myInput, mean, myInput * scale );
+            fail    =   1U;
+        }
+        prev    =   mean;
+    }
+
+    /* Noise, 10-bit LSB rms: Raw samples against the decimated results  */
+    raw_sd  =   sqrt ( ( myRawSq / myRawN ) - ( ( myRawSum / myRawN ) * ( myRawSum / myRawN ) ) );
+    out_sd  =   sqrt ( out_sq / out_n );
+    gain    =   log2 ( raw_sd / out_sd );
+
+    printf ( "n = %u %-6s: %2u-bit, noise %.3f -> %.3f LSB rms, gain %.2f bits\n", ovs, ( avg == ADC_SCAN_AVG_CIC2 ) ? "CIC2" : "boxcar",
+             10U + ovs, raw_sd, out_sd, gain );
+
+    if ( gain < ( (double)ovs - ADC_OVS_GAIN_LOSS ) )
+    {
+        printf ( "FAIL: n = %u, gain %.2f bits, expected %.2f or more\n", ovs, gain, (double)ovs - ADC_OVS_GAIN_LOSS );
+        fail    =   1U;
+    }
+
+    return fail;
+}
+
+
+/**@brief Function for application main entry.
+ */
+int main ( void )
+{
+    uint8_t fail    =   0U;
+    uint8_t n       =   0U;
+
+    for ( n = 1U; n <= ADC_SCAN_OVS_MAX; n++ )
+    {
+        fail   |=   run ( n, ADC_SCAN_AVG_BOXCAR );
+        fail   |=   run ( n, ADC_SCAN_AVG_CIC2 );
+    }
+
+    printf ( "test_adc_ovs: %s\n", ( fail == 0U ) ? "PASS" : "FAIL" );
+
+    return ( fail == 0U ) ? 0 : 1;
+}
@@ -0,0 +1,316 @@
+/**
+ * @brief       test_adc_sleep.c
+ * @details     Host test of the ADC scan engine sleep conversion mode ( adc_an0.X, adc_scan.c ).
+ *
+ *              SLEEP() is modelled ( pic16_sleep_hook ): the state of the core and of the peripherals is
+ *              checked when the uC goes to sleep, then the conversion is completed and ADIF wakes it up. The
+ *              sequence of a two-channel scan is checked step by step:
+ *
+ *                  1. adc_scan_start(): Timer4 runs the acquisition delay, nothing is converted yet.
+ *                  2. adc_scan_sleep() during the acquisition delay: It returns 0 and does not sleep.
+ *                  3. TMR4IF: The conversion is left pending, GO is not set.
+ *                  4. adc_scan_sleep(): GIE off, gated peripherals off, GO set, then SLEEP. On wake-up the
+ *                     peripherals are restored and GIE is restored, ADIF is served by the ISR.
+ *                  5. ADIF: The result is stored, the next channel is acquired. The scan ends after the last.
+ *
+ *              And: Every gate mask, a peripheral already off stays off, the F_OSC ADC clock starts the
+ *              conversion without SLEEP, adc_scan_sleep_disable() goes back to GO from TMR4IF, GIE stays
+ *              off if it was off.
+ *
+ *              Build and run: make -C tools/test
+ *
+ * @return      0: Pass, 1: Fail
+ *
+ * @author      Manuel Caballero (aqueronteblog@gmail.com)
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+#include <stdio.h>
+#include "adc_scan.h"
+
+
+/**@brief Constants.
+ */
+#define ADC_SLEEP_FRC       0b111       /*!<   ADCON1.ADCS: FRC             */
+#define ADC_SLEEP_FOSC8     0b001       /*!<   ADCON1.ADCS: F_OSC/8         */
+
+#define CHECK( cond )       check ( ( cond ) ? 1U : 0U, #cond, __LINE__ )
+
+
+/**@brief Variables.
+ */
+static uint16_t             myAN0buff[4];
+static uint16_t             myFVRbuff[4];
+static adc_scan_channel_t   myChannels[2];
+static uint8_t              myGateMask;         /*!<   Gate mask under test                         */
+static uint8_t              mySleeps;           /*!<   SLEEP instructions executed                  */
+static uint16_t             myCode;             /*!<   Next conversion result                       */
+static uint8_t              myFail;
+
+
+/**@brief Function prototypes.
+ */
+static void     check       ( uint8_t ok, const char* what, int line );
+static void     on_sleep    ( void );
+static void     on_adif     ( void );
+static void     scan        ( uint8_t gate, uint8_t tmr1on, uint8_t c1on, uint8_t c2on, uint8_t swdten );
+
+
+
+/**
+ * @brief       void check ( uint8_t , const char* , int )
+ * @details     It reports a failed check.
+ *
+ *
+ * @param[in]    ok:        1: Pass.
+ * @param[in]    what:      Condition.
+ * @param[in]    line:      Line.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+static void check ( uint8_t ok, const char* what, int line )
+{
+    if ( ok == 0U )
+    {
+        printf ( "FAIL: line %d, gate 0x%02X: %s\n", line, myGateMask, what );
+        myFail  =   1U;
+    }
+}
+
+
+/**
+ * @brief       void on_sleep ( void )
+ * @details     SLEEP: The uC must sleep with GIE off, the conversion started ( FRC ) and the gated
+ *              peripherals off. The conversion is completed, ADIF wakes the uC up.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+static void on_sleep ( void )
+{
+    mySleeps++;
+
+    CHECK( INTCONbits.GIE == 0U );
+    CHECK( ADCON0bits.GO_nDONE == 1U );
+    CHECK( ( ADCON1bits.ADCS & 0b011 ) == 0b011 );
+    CHECK( T4CONbits.TMR4ON == 0U );
+
+    if ( ( myGateMask & ADC_SCAN_GATE_TMR1 ) != 0U )
+    {
+        CHECK( T1CONbits.TMR1ON == 0U );
+    }
+    if ( ( myGateMask & ADC_SCAN_GATE_COMPARATORS ) != 0U )
+    {
+        CHECK( ( CM1CON0bits.C1ON == 0U ) && ( CM2CON0bits.C2ON == 0U ) );
+    }
+    if ( ( myGateMask & ADC_SCAN_GATE_WDT ) != 0U )
+    {
+        CHECK( WDTCONbits.SWDTEN == 0U );
+    }
+
+    /* Conversion completed with FRC, ADIF wakes the uC up ( GIE = 0: it goes on after SLEEP )  */
+    ADRESH              =   (uint8_t)( myCode >> 8U );
+    ADRESL              =   (uint8_t)myCode;
+    ADCON0bits.GO_nDONE =   0U;
+    PIR1bits.ADIF       =   1U;
+}
+
+
+/**
+ * @brief       void on_adif ( void )
+ * @details     ISR(): ADIF is served once GIE is set again.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+static void on_adif ( void )
+{
+    CHECK( INTCONbits.GIE == 1U );
+    CHECK( PIR1bits.ADIF == 1U );
+
+    PIR1bits.ADIF   =   0U;
+    adc_scan_isr ();
+}
+
+
+/**
+ * @brief       void scan ( uint8_t , uint8_t , uint8_t , uint8_t , uint8_t )
+ * @details     One scan of AN0 and FVR in the sleep conversion mode, every step checked.
+ *
+ *
+ * @param[in]    gate:      Gate mask.
+ * @param[in]    tmr1on:    Timer1 state before the scan.
+ * @param[in]    c1on:      Comparator C1 state before the scan.
+ * @param[in]    c2on:      Comparator C2 state before the scan.
+ * @param[in]    swdten:    WDT state before the scan.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+static void scan ( uint8_t gate, uint8_t tmr1on, uint8_t c1on, uint8_t c2on, uint8_t swdten )
+{
+    uint8_t     i       =   0U;
+    uint16_t    result  =   0U;
+
+    myGateMask          =   gate;
+    mySleeps            =   0U;
+    T1CONbits.TMR1ON    =   tmr1on;
+    CM1CON0bits.C1ON    =   c1on;
+    CM2CON0bits.C2ON    =   c2on;
+    WDTCONbits.SWDTEN   =   swdten;
+    ADCON1bits.ADCS     =   ADC_SLEEP_FRC;
+    INTCONbits.GIE      =   1U;
+
+    myChannels[0]   =   ( adc_scan_channel_t ){ .chs = ADC_SCAN_AN0, .acq = ADC_SCAN_ACQ_US( 5U ),  .buff = &myAN0buff[0], .size = 4U };
+    myChannels[1]   =   ( adc_scan_channel_t ){ .chs = ADC_SCAN_FVR, .acq = ADC_SCAN_ACQ_US( 20U ), .buff = &myFVRbuff[0], .size = 4U };
+    adc_scan_init           ( &myChannels[0], 2U );
+    adc_scan_sleep_enable   ( gate );
+
+    /* 1. Acquisition delay of AN0  */
+    CHECK( adc_scan_start () == 1U );
+    CHECK( adc_scan_busy () == 1U );
+    CHECK( ADCON0bits.ADON == 1U );
+
+    for ( i = 0U; i < 2U; i++ )
+    {
+        CHECK( ADCON0bits.CHS == myChannels[i].chs );
+        CHECK( T4CONbits.TMR4ON == 1U );
+        CHECK( PR4 == (uint8_t)( myChannels[i].acq - 1U ) );
+        CHECK( ADCON0bits.GO_nDONE == 0U );
+
+        /* 2. Nothing pending yet  */
+        CHECK( adc_scan_sleep () == 0U );
+        CHECK( mySleeps == i );
+        CHECK( INTCONbits.GIE == 1U );
+
+        /* 3. TMR4IF: Pending, not started  */
+        adc_scan_tmr4_isr ();
+        CHECK( T4CONbits.TMR4ON == 0U );
+        CHECK( ADCON0bits.GO_nDONE == 0U );
+
+        /* 4. Converted in SLEEP  */
+        myCode  =   (uint16_t)( 0x155U + i );
+        CHECK( adc_scan_sleep () == 1U );
+        CHECK( mySleeps == (uint8_t)( i + 1U ) );
+        CHECK( INTCONbits.GIE == 1U );
+        CHECK( T1CONbits.TMR1ON == tmr1on );
+        CHECK( CM1CON0bits.C1ON == c1on );
+        CHECK( CM2CON0bits.C2ON == c2on );
+        CHECK( WDTCONbits.SWDTEN == swdten );
+
+        /* Only once per conversion  */
+        CHECK( adc_scan_sleep () == 0U );
+        CHECK( mySleeps == (uint8_t)( i + 1U ) );
+
+        /* 5. ADIF  */
+        on_adif ();
+        CHECK( adc_scan_read ( &myChannels[i], &result ) == 1U );
+        CHECK( result == myCode );
+    }
+
+    CHECK( adc_scan_busy () == 0U );
+    CHECK( T4CONbits.TMR4ON == 0U );
+    CHECK( adc_scan_sleep () == 0U );
+    CHECK( mySleeps == 2U );
+}
+
+
+/**@brief Function for application main entry.
+ */
+int main ( void )
+{
+    uint8_t     gate    =   0U;
+    uint8_t     on      =   0U;
+    uint16_t    result  =   0U;
+
+    pic16_sleep_hook    =   on_sleep;
+
+    /* Every gate mask, the peripherals on and off  */
+    for ( gate = 0U; gate <= ADC_SCAN_GATE_ALL; gate++ )
+    {
+        for ( on = 0U; on < 16U; on++ )
+        {
+            scan ( gate, on & 1U, ( on >> 1U ) & 1U, ( on >> 2U ) & 1U, ( on >> 3U ) & 1U );
+        }
+    }
+
+    /* F_OSC ADC clock: The conversion would be aborted by SLEEP, it is started awake  */
+    myGateMask  =   ADC_SCAN_GATE_ALL;
+    mySleeps    =   0U;
+    myChannels[0]   =   ( adc_scan_channel_t ){ .chs = ADC_SCAN_AN0, .acq = 0U, .buff = &myAN0buff[0], .size = 4U };
+    adc_scan_init           ( &myChannels[0], 1U );
+    adc_scan_sleep_enable   ( ADC_SCAN_GATE_ALL );
+    ADCON1bits.ADCS     =   ADC_SLEEP_FOSC8;
+    T1CONbits.TMR1ON    =   1U;
+    CHECK( adc_scan_start () == 1U );
+    CHECK( ADCON0bits.GO_nDONE == 0U );
+    CHECK( adc_scan_sleep () == 0U );
+    CHECK( mySleeps == 0U );
+    CHECK( ADCON0bits.GO_nDONE == 1U );
+    CHECK( T1CONbits.TMR1ON == 1U );
+    CHECK( INTCONbits.GIE == 1U );
+    ADCON0bits.GO_nDONE =   0U;
+    adc_scan_isr ();
+    CHECK( adc_scan_busy () == 0U );
+
+    /* Sleep conversion mode disabled: TMR4IF starts the conversion  */
+    myChannels[0].acq   =   ADC_SCAN_ACQ_US( 5U );
+    adc_scan_sleep_disable ();
+    ADCON1bits.ADCS     =   ADC_SLEEP_FRC;
+    CHECK( adc_scan_start () == 1U );
+    adc_scan_tmr4_isr ();
+    CHECK( ADCON0bits.GO_nDONE == 1U );
+    CHECK( adc_scan_sleep () == 0U );
+    CHECK( mySleeps == 0U );
+    ADRESH              =   0x03U;
+    ADRESL              =   0xFFU;
+    ADCON0bits.GO_nDONE =   0U;
+    adc_scan_isr ();
+    CHECK( adc_scan_busy () == 0U );
+    while ( adc_scan_read ( &myChannels[0], &result ) == 1U );
+    CHECK( result == 0x3FFU );
+
+    /* GIE off on entry: It is still off after SLEEP, ADIF waits for the caller  */
+    adc_scan_sleep_enable   ( ADC_SCAN_GATE_ALL );
+    CHECK( adc_scan_start () == 1U );
+    adc_scan_tmr4_isr ();
+    INTCONbits.GIE  =   0U;
+    CHECK( adc_scan_sleep () == 1U );
+    CHECK( mySleeps == 1U );
+    CHECK( INTCONbits.GIE == 0U );
+    CHECK( PIR1bits.ADIF == 1U );
+    INTCONbits.GIE  =   1U;
+    on_adif ();
+    CHECK( adc_scan_busy () == 0U );
+
+    printf ( "test_adc_sleep: %s\n", ( myFail == 0U ) ? "PASS" : "FAIL" );
+
+    return ( myFail == 0U ) ? 0 : 1;
+}
@@ -0,0 +1,404 @@
+/**
+ * @brief       test_baud_calc.c
+ * @details     Host test of the baud rate generator solver ( baud_calc.h, baud_calc.c ). It is built twice
+ *              ( Makefile ): The EUSART of the XC8 examples ( BAUD_CALC_EUSART_DEFINE(), baud_calc_eusart() ) and
+ *              the UARTx of UART.X ( BAUD_CALC_UART_DEFINE(), baud_calc_uart() ).
+ *
+ *              The compile-time solver is instantiated for every clock of TEST_CLOCKS and every baud rate of
+ *              TEST_BAUDS, the run-time one for the same and for TEST_RANDOM random pairs. Each result is checked
+ *              against an exhaustive search over every candidate and every SPBRG ( UxBRG ), with the error of the
+ *              header ( 64-bit arithmetic ):
+ *
+ *                  - Both solvers must give the same settings and the same error, the one of their settings.
+ *                  - The error must be the lowest one of the search, ties to the first candidate.
+ *                  - Nothing within 25% ( BAUD_CALC_NONE ): baud_calc_*() must give the fastest setting.
+ *                  - baud_calc_*() returns 1 if the error is within BAUD_CALC_ERR_MAX.
+ *
+ *              The build assertion is disabled here ( BAUD_CALC_ERR_MAX raised after the header ), so the rates
+ *              above the limit are checked too. The real assertion is checked by the Makefile: TEST_ASSERT = 1
+ *              ( within the limit ) must build, TEST_ASSERT = 2 ( above it ) must not.
+ *
+ *              Build and run: make -C tools/test
+ *
+ * @return      0: Pass, 1: Fail
+ *
+ * @author      Manuel Caballero (aqueronteblog@gmail.com)
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+#include <stdio.h>
+#include "baud_calc.h"
+
+#if defined( TEST_ASSERT )
+#if defined( BAUD_CALC_EUSART_DEFINE )
+#if ( TEST_ASSERT == 1 )
+/* EUSART, 115200 baud at 16MHz: It builds   */
+BAUD_CALC_EUSART_DEFINE( myBaud, 16000000UL, 115200UL );
+#else
+/* EUSART, 1M baud at 500kHz: It must not build  */
+BAUD_CALC_EUSART_DEFINE( myBaud, 500000UL, 1000000UL );
+#endif
+#else
+#if ( TEST_ASSERT == 1 )
+/* UARTx, 115200 baud at 48MHz: It builds    */
+BAUD_CALC_UART_DEFINE( myBaud, 48000000UL, 115200UL );
+#else
+/* UARTx, 50 baud at 100MHz: It must not build ( UxBRG is 16-bit )  */
+BAUD_CALC_UART_DEFINE( myBaud, 100000000UL, 50UL );
+#endif
+#endif
+
+int main ( void )
+{
+    return myBaud_ERROR;
+}
+#else
+enum{ TEST_ERR_MAX = BAUD_CALC_ERR_MAX };
+#undef  BAUD_CALC_ERR_MAX
+#define BAUD_CALC_ERR_MAX   BAUD_CALC_NONE
+
+
+/**@brief Constants.
+ */
+#define TEST_RANDOM         300UL       /*!<   Run-time solver: Random clocks and baud rates    */
+
+#if defined( BAUD_CALC_EUSART_DEFINE )
+#define TEST_NAME           "EUSART"
+#define TEST_CANDIDATES     4U
+#define TEST_F_MAX          32000000UL  /*!<   F_OSC max.                                       */
+#define TEST_M( k )         BAUD_CALC_M( k )
+#define TEST_MAX( k )       BAUD_CALC_MAX( k )
+
+/**@brief F_OSC ( Hz ): Internal oscillator settings and crystals.
+ */
+#define TEST_CLOCKS( X )    \
+    TEST_BAUDS( X, 31250UL )        TEST_BAUDS( X, 500000UL )       TEST_BAUDS( X, 1000000UL )      \
+    TEST_BAUDS( X, 2000000UL )      TEST_BAUDS( X, 3686400UL )      TEST_BAUDS( X, 4000000UL )      \
+    TEST_BAUDS( X, 8000000UL )      TEST_BAUDS( X, 11059200UL )     TEST_BAUDS( X, 16000000UL )     \
+    TEST_BAUDS( X, 18432000UL )     TEST_BAUDS( X, 20000000UL )     TEST_BAUDS( X, 32000000UL )
+#else
+#define TEST_NAME           "UARTx"
+#define TEST_CANDIDATES     2U
+#define TEST_F_MAX          100000000UL /*!<   PBCLK max.                                       */
+#define TEST_M( k )         BAUD_CALC_M( k )
+#define TEST_MAX( k )       BAUD_CALC_MAX
+
+/**@brief PBCLK ( Hz ): SYSCLK settings and their PBDIV.
+ */
+#define TEST_CLOCKS( X )    \
+    TEST_BAUDS( X, 1000000UL )      TEST_BAUDS( X, 4000000UL )      TEST_BAUDS( X, 8000000UL )      \
+    TEST_BAUDS( X, 10000000UL )     TEST_BAUDS( X, 12000000UL )     TEST_BAUDS( X, 20000000UL )     \
+    TEST_BAUDS( X, 24000000UL )     TEST_BAUDS( X, 40000000UL )     TEST_BAUDS( X, 48000000UL )     \
+    TEST_BAUDS( X, 80000000UL )     TEST_BAUDS( X, 96000000UL )     TEST_BAUDS( X, 100000000UL )
+#endif
+
+/**@brief Baud rates.
+ */
+#define TEST_BAUDS( X, f )  \
+    X( f, 25UL )        X( f, 110UL )       X( f, 300UL )       X( f, 1200UL )      X( f, 2400UL )      \
+    X( f, 9600UL )      X( f, 19200UL )     X( f, 31250UL )     X( f, 38400UL )     X( f, 57600UL )     \
+    X( f, 115200UL )    X( f, 230400UL )    X( f, 250000UL )    X( f, 460800UL )    X( f, 921600UL )    \
+    X( f, 1000000UL )
+
+
+/**@brief Solver result: Candidate ( baud_calc.h order ), SPBRG + 1 ( UxBRG + 1 ) and error.
+ */
+typedef struct{
+  uint32_t  f;
+  uint32_t  baud;
+  uint32_t  k;
+  uint32_t  n;
+  uint32_t  error;
+} calc_t;
+
+
+/**@brief Variables.
+ */
+static uint32_t mySeed  =   1UL;
+static uint32_t myCases;
+static uint32_t myWithin;
+
+
+/**@brief Function prototypes.
+ */
+static uint32_t rnd         ( void );
+static uint32_t ref_error   ( uint32_t f, uint32_t baud, uint32_t m, uint32_t n );
+static uint8_t  check       ( const calc_t* c, const calc_t* r, uint8_t within );
+static uint8_t  run_time    ( uint32_t f, uint32_t baud, calc_t* r );
+
+
+
+/**
+ * @brief       uint32_t rnd ( void )
+ * @details     Pseudo-random number ( xorshift32 ).
+ *
+ *
+ * @return      Random number
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+static uint32_t rnd ( void )
+{
+    mySeed ^=   mySeed << 13U;
+    mySeed ^=   mySeed >> 17U;
+    mySeed ^=   mySeed << 5U;
+
+    return mySeed;
+}
+
+
+/**
+ * @brief       uint32_t ref_error ( uint32_t , uint32_t , uint32_t , uint32_t )
+ * @details     Error of a setting, 0.01% ( baud_calc.h formula, 64-bit ).
+ *
+ *
+ * @param[in]    f:         Clock, Hz.
+ * @param[in]    baud:      Baud rate.
+ * @param[in]    m:         Divider.
+ * @param[in]    n:         SPBRG + 1 ( UxBRG + 1 ).
+ *
+ *
+ * @return      Error, BAUD_CALC_NONE if it is 25% off or more
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+static uint32_t ref_error ( uint32_t f, uint32_t baud, uint32_t m, uint32_t n )
+{
+    const uint64_t  mnb     =   (uint64_t)m * n * baud;
+    const uint64_t  diff    =   ( f > mnb ) ? ( f - mnb ) : ( mnb - f );
+
+    if ( ( diff * 4U ) >= mnb )
+    {
+        return BAUD_CALC_NONE;
+    }
+
+    return (uint32_t)( ( diff * 100U ) / ( mnb / 100U ) );
+}
+
+
+/**
+ * @brief       uint8_t check ( const calc_t* , const calc_t* , uint8_t )
+ * @details     It compares both solvers with each other and with the exhaustive search.
+ *
+ *
+ * @param[in]    c:         Compile-time solver, NULL: Not instantiated.
+ * @param[in]    r:         Run-time solver.
+ * @param[in]    within:    Return value of the run-time solver.
+ *
+ *
+ * @return      0: Pass, 1: Fail
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+static uint8_t check ( const calc_t* c, const calc_t* r, uint8_t within )
+{
+    uint32_t    best    =   BAUD_CALC_NONE;
+    uint32_t    best_k  =   0UL;
+    uint32_t    k       =   0UL;
+    uint32_t    n       =   0UL;
+    uint32_t    e       =   0UL;
+    uint8_t     fail    =   0U;
+
+    myCases++;
+
+    for ( k = 0UL; k < TEST_CANDIDATES; k++ )
+    {
+        for ( n = 1UL; n <= TEST_MAX( k ); n++ )
+        {
+            e   =   ref_error ( r->f, r->baud, TEST_M( k ), n );
+            if ( e < best )
+            {
+                best    =   e;
+                best_k  =   k;
+            }
+        }
+    }
+
+    if ( best <= TEST_ERR_MAX )
+    {
+        myWithin++;
+    }
+
+    /* Both solvers: Same result  */
+    if ( ( c != NULL ) && ( ( c->error != r->error ) || ( ( r->error != BAUD_CALC_NONE ) && ( ( c->k != r->k ) || ( c->n != r->n ) ) ) ) )
+    {
+        printf ( "FAIL: %s, f = %lu Hz, %lu baud: DEFINE candidate %lu, n = %lu, error %lu, run time %lu, %lu, %lu\n", TEST_NAME,
+                 (unsigned long)r->f, (unsigned long)r->baud, (unsigned long)c->k, (unsigned long)c->n, (unsigned long)c->error,
+                 (unsigned long)r->k, (unsigned long)r->n, (unsigned long)r->error );
+        fail    =   1U;
+    }
+
+    /* Against the search: The settings give the error, the lowest one, ties to the first candidate    */
+    if ( ( r->n < 1UL ) || ( r->n > TEST_MAX( r->k ) ) || ( r->error != ref_error ( r->f, r->baud, TEST_M( r->k ), r->n ) ) ||
+         ( r->error != best ) || ( ( best != BAUD_CALC_NONE ) && ( r->k != best_k ) ) )
+    {
+        printf ( "FAIL: %s, f = %lu Hz, %lu baud: candidate %lu, n = %lu, error %lu, search: candidate %lu, error %lu\n", TEST_NAME,
+                 (unsigned long)r->f, (unsigned long)r->baud, (unsigned long)r->k, (unsigned long)r->n, (unsigned long)r->error,
+                 (unsigned long)best_k, (unsigned long)best );
+        fail    =   1U;
+    }
+
+    /* Nothing within 25%: The fastest setting   */
+    if ( ( r->error == BAUD_CALC_NONE ) && ( ( TEST_M( r->k ) != 4UL ) || ( r->n != 1UL ) ) )
+    {
+        printf ( "FAIL: %s, f = %lu Hz, %lu baud: Nothing within 25%%, candidate %lu, n = %lu\n", TEST_NAME, (unsigned long)r->f,
+                 (unsigned long)r->baud, (unsigned long)r->k, (unsigned long)r->n );
+        fail    =   1U;
+    }
+
+    if ( within != ( ( r->error <= TEST_ERR_MAX ) ? 1U : 0U ) )
+    {
+        printf ( "FAIL: %s, f = %lu Hz, %lu baud: error %lu, returned %u\n", TEST_NAME, (unsigned long)r->f, (unsigned long)r->baud,
+                 (unsigned long)r->error, within );
+        fail    =   1U;
+    }
+
+    return fail;
+}
+
+
+/**
+ * @brief       uint8_t run_time ( uint32_t , uint32_t , calc_t* )
+ * @details     Run-time solver, its result as a candidate and SPBRG + 1 ( UxBRG + 1 ).
+ *
+ *
+ * @param[in]    f:         Clock, Hz.
+ * @param[in]    baud:      Baud rate.
+ *
+ * @param[out]   r:         Result.
+ *
+ *
+ * @return      Return value of the solver
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+static uint8_t run_time ( uint32_t f, uint32_t baud, calc_t* r )
+{
+    uint8_t within  =   0U;
+
+    r->f    =   f;
+    r->baud =   baud;
+
+#if defined( BAUD_CALC_EUSART_DEFINE )
+    baud_calc_eusart_t  cfg;
+
+    within      =   baud_calc_eusart ( f, baud, &cfg );
+    r->k        =   ( ( cfg.brg16 == 1U ) ? 0UL : 2UL ) + ( ( cfg.brgh == 1U ) ? 0UL : 1UL );
+    r->n        =   (uint32_t)cfg.spbrg + 1UL;
+    r->error    =   cfg.error;
+#else
+    baud_calc_uart_t    cfg;
+
+    within      =   baud_calc_uart ( f, baud, &cfg );
+    r->k        =   cfg.brgh;
+    r->n        =   (uint32_t)cfg.brg + 1UL;
+    r->error    =   cfg.error;
+#endif
+
+    return within;
+}
+
+
+/**@brief One clock and baud rate: Both solvers, compared with the search.
+ */
+#if defined( BAUD_CALC_EUSART_DEFINE )
+#define TEST_CASE( f, baud )    \
+    { \
+        BAUD_CALC_EUSART_DEFINE( b, f, baud ); \
+        (void)sizeof ( b_baud_error ); \
+        calc_t  c   =   { f, baud, ( ( b_BRG16 == 1 ) ? 0UL : 2UL ) + ( ( b_BRGH == 1 ) ? 0UL : 1UL ), \
+                          ( ( (uint32_t)b_SPBRGH << 8U ) | (uint32_t)b_SPBRGL ) + 1UL, (uint32_t)b_ERROR }; \
+        calc_t  r; \
+        uint8_t w   =   run_time ( f, baud, &r ); \
+        fail   |=   check ( &c, &r, w ); \
+    }
+#else
+#define TEST_CASE( f, baud )    \
+    { \
+        BAUD_CALC_UART_DEFINE( b, f, baud ); \
+        (void)sizeof ( b_baud_error ); \
+        calc_t  c   =   { f, baud, (uint32_t)b_BRGH, (uint32_t)b_BRG + 1UL, (uint32_t)b_ERROR }; \
+        calc_t  r; \
+        uint8_t w   =   run_time ( f, baud, &r ); \
+        fail   |=   check ( &c, &r, w ); \
+    }
+#endif
+
+
+/**@brief Function for application main entry.
+ */
+int main ( void )
+{
+    calc_t      r;
+    uint32_t    i       =   0UL;
+    uint32_t    f       =   0UL;
+    uint32_t    baud    =   0UL;
+    uint8_t     w       =   0U;
+    uint8_t     fail    =   0U;
+
+    TEST_CLOCKS( TEST_CASE )
+
+    /* Run-time solver: Random clocks and baud rates ( 25 baud to f/4 )   */
+    for ( i = 0UL; i < TEST_RANDOM; i++ )
+    {
+        f       =   32768UL + ( rnd () % ( TEST_F_MAX - 32768UL + 1UL ) );
+        baud    =   25UL + ( rnd () % ( ( f / 4UL ) - 25UL + 1UL ) );
+        baud    =   ( ( rnd () & 1UL ) == 0UL ) ? ( 25UL + ( baud % 1000000UL ) ) : baud;
+
+        w       =   run_time ( f, baud, &r );
+        fail   |=   check ( NULL, &r, w );
+    }
+
+    /* Documented example   */
+#if defined( BAUD_CALC_EUSART_DEFINE )
+    {
+        /* 115200 baud at F_OSC = 16MHz -> BRG16 = 1, BRGH = 1, SPBRG = 34, error 79   */
+        BAUD_CALC_EUSART_DEFINE( myBaud, 16000000UL, 115200UL );
+        (void)sizeof ( myBaud_baud_error );
+
+        if ( ( myBaud_BRG16 != 1 ) || ( myBaud_BRGH != 1 ) || ( myBaud_SPBRGH != 0 ) || ( myBaud_SPBRGL != 34 ) || ( myBaud_ERROR != 79 ) )
+        {
+            printf ( "FAIL: EUSART example, BRG16 %d, BRGH %d, SPBRG %d, error %d\n", myBaud_BRG16, myBaud_BRGH,
+                     ( myBaud_SPBRGH << 8 ) | myBaud_SPBRGL, myBaud_ERROR );
+            fail    =   1U;
+        }
+    }
+#else
+    {
+        /* 115200 baud at PBCLK = 48MHz -> BRGH = 0, U1BRG = 25, error 16   */
+        BAUD_CALC_UART_DEFINE( myBaud, 48000000UL, 115200UL );
+        (void)sizeof ( myBaud_baud_error );
+
+        if ( ( myBaud_BRGH != 0 ) || ( myBaud_BRG != 25 ) || ( myBaud_ERROR != 16 ) )
+        {
+            printf ( "FAIL: UARTx example, BRGH %d, BRG %d, error %d\n", myBaud_BRGH, myBaud_BRG, myBaud_ERROR );
+            fail    =   1U;
+        }
+    }
+#endif
+
+    printf ( "test_baud_calc ( %s ): %lu cases ( %lu within %u.%02u%% ), %s\n", TEST_NAME, (unsigned long)myCases,
+             (unsigned long)myWithin, TEST_ERR_MAX / 100U, TEST_ERR_MAX % 100U, ( fail == 0U ) ? "PASS" : "FAIL" );
+
+    return ( fail == 0U ) ? 0 : 1;
+}
+
+#endif
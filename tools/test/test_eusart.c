@@ -0,0 +1,484 @@
+/**
+ * @brief       test_eusart.c
+ * @details     Host test of the interrupt-driven EUSART Tx driver ( eusart_asynchronous.X, eusart.c, the same
+ *              in every example ).
+ *
+ *              The transmitter is modelled one character time ( slot ) at a time: TXREG is moved into the
+ *              shift register ( TSR ) when it is empty, and eusart_tx_isr() is called while TXIF ( TXREG
+ *              empty ) and TXIE are set, as the interrupt would. A call which leaves TXIE set has loaded
+ *              TXREG, one which clears it had nothing to send. The test checks:
+ *
+ *                  - Ring buffer: It holds EUSART_TX_BUFF_SIZE - 1 bytes, eusart_write() takes what fits.
+ *                  - Order: Random writes and descriptors ( binary data ) go out in the order they were
+ *                    accepted, the indices wrap at EUSART_TX_BUFF_SIZE many times.
+ *                  - Descriptor: completed is 0 until its last byte is loaded into TXREG, then 1 and
+ *                    done() is called once. A second descriptor is refused meanwhile, an empty one is
+ *                    completed straight away.
+ *                  - Bytes per TXIF: Every interrupt loads one byte, the only extra ones are the last of
+ *                    every burst ( TXIE cleared ).
+ *                  - Throughput: The line never idles while there is data queued.
+ *
+ *              It prints the host time of eusart_tx_isr() next to the character time the blocking Tx path
+ *              spent in the ISR at 115200 baud ( 10 bits ).
+ *
+ *              Build and run: make -C tools/test
+ *
+ * @return      0: Pass, 1: Fail
+ *
+ * @author      Manuel Caballero (aqueronteblog@gmail.com)
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+#define _POSIX_C_SOURCE 199309L
+#include <stdio.h>
+#include <string.h>
+#include <time.h>
+#include "eusart.h"
+
+
+/**@brief Constants.
+ */
+#define EUSART_SIM_BYTES    200000UL    /*!<   Bytes accepted in the order run                  */
+#define EUSART_SIM_OUT_MAX  ( EUSART_SIM_BYTES + 4096UL )
+#define EUSART_SIM_WRITE    80U         /*!<   eusart_write() length, 0 to this               */
+#define EUSART_SIM_DESC     100U        /*!<   Descriptor length, 0 to this                   */
+#define EUSART_SIM_BAUD     115200UL    /*!<   Blocking Tx path: One character time per byte  */
+
+
+/**@brief Variables.
+ */
+static uint8_t          myTxReg;        /*!<   TXREG full                                       */
+static uint8_t          myTsr;          /*!<   TSR busy                                         */
+static uint8_t          myOut[EUSART_SIM_OUT_MAX];      /*!<   Bytes on the line                */
+static uint32_t         myOutN;
+static uint8_t          myExp[EUSART_SIM_OUT_MAX];      /*!<   Bytes accepted, in order         */
+static uint32_t         myExpN;
+static uint32_t         myIsrCalls;
+static uint32_t         myIsrIdle;      /*!<   Interrupts which cleared TXIE                    */
+static uint32_t         myIdleSlots;    /*!<   Slots with nothing on the line but data queued   */
+static uint32_t         myDone;         /*!<   done() calls                                     */
+static uint32_t         mySeed  =   1UL;
+
+static eusart_tx_desc_t myDesc;
+static uint8_t          myDescBuff[EUSART_SIM_DESC];
+static uint32_t         myDescEnd;      /*!<   Bytes loaded into TXREG when the descriptor ends */
+
+
+/**@brief Function prototypes.
+ */
+static uint32_t rnd         ( void );
+static void     done        ( void );
+static void     service     ( void );
+static void     slot        ( void );
+static uint8_t  check_ring  ( void );
+static uint8_t  check_desc  ( void );
+static uint8_t  check_order ( void );
+
+
+
+/**
+ * @brief       uint32_t rnd ( void )
+ * @details     Random number ( xorshift32 ).
+ *
+ *
+ * @return      Random number
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+static uint32_t rnd ( void )
+{
+    mySeed ^=   mySeed << 13U;
+    mySeed ^=   mySeed >> 17U;
+    mySeed ^=   mySeed << 5U;
+
+    return mySeed;
+}
+
+
+/**
+ * @brief       void done ( void )
+ * @details     Descriptor completion callback: Bytes loaded so far must be the end of the descriptor.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+static void done ( void )
+{
+    myDone++;
+    myDescEnd   =   myOutN + myTsr + 1U;
+}
+
+
+/**
+ * @brief       void service ( void )
+ * @details     Tx interrupt: eusart_tx_isr() runs while TXREG is empty and TXIE is set.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+static void service ( void )
+{
+    while ( ( myTxReg == 0U ) && ( PIE1bits.TXIE == 1U ) )
+    {
+        PIR1bits.TXIF   =   1U;
+        myIsrCalls++;
+        eusart_tx_isr ();
+
+        if ( PIE1bits.TXIE == 1U )
+        {
+            /* TXREG loaded, TXIF cleared  */
+            myTxReg         =   1U;
+            PIR1bits.TXIF   =   0U;
+            myOut[myOutN + myTsr]   =   TXREG;
+        }
+        else
+        {
+            myIsrIdle++;
+        }
+    }
+
+    TXSTAbits.TRMT  =   ( myTsr == 0U ) ? 1U : 0U;
+}
+
+
+/**
+ * @brief       void slot ( void )
+ * @details     One character time: The TSR sends its byte, TXREG goes into the TSR, the interrupt refills it.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+static void slot ( void )
+{
+    if ( myTsr == 1U )
+    {
+        myOutN++;
+        myTsr   =   0U;
+    }
+
+    if ( myTxReg == 1U )
+    {
+        myTsr   =   1U;
+        myTxReg =   0U;
+    }
+    else if ( myExpN > myOutN )
+    {
+        /* Nothing on the line, but data queued    */
+        myIdleSlots++;
+    }
+
+    service ();
+}
+
+
+/**
+ * @brief       uint8_t check_ring ( void )
+ * @details     Ring buffer: EUSART_TX_BUFF_SIZE - 1 bytes, then full. The bytes go out as written.
+ *
+ *
+ * @return      0: Pass, 1: Fail
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+static uint8_t check_ring ( void )
+{
+    uint8_t     data[2U * EUSART_TX_BUFF_SIZE];
+    uint8_t     n       =   0U;
+    uint8_t     i       =   0U;
+    uint8_t     fail    =   0U;
+
+    for ( i = 0U; i < sizeof ( data ); i++ )
+    {
+        data[i] =   (uint8_t)( 0xA0U + i );
+    }
+
+    eusart_tx_init ();
+    myOutN  =   0UL;
+    myExpN  =   0UL;
+
+    /* No interrupt yet: The ring buffer fills up   */
+    n       =   eusart_write ( &data[0], (uint8_t)sizeof ( data ) );
+    memcpy ( &myExp[myExpN], &data[0], n );
+    myExpN +=   n;
+
+    if ( ( n != ( EUSART_TX_BUFF_SIZE - 1U ) ) || ( eusart_tx_free () != 0U ) || ( eusart_write ( &data[0], 1U ) != 0U ) ||
+         ( PIE1bits.TXIE != 1U ) || ( TXSTAbits.TXEN != 1U ) )
+    {
+        printf ( "FAIL: Ring buffer, %u bytes taken, %u free, TXIE %u\n", n, eusart_tx_free (), PIE1bits.TXIE );
+        fail    =   1U;
+    }
+
+    while ( eusart_tx_busy () == 1U )
+    {
+        slot ();
+    }
+
+    if ( ( myOutN != myExpN ) || ( memcmp ( myOut, myExp, myExpN ) != 0 ) || ( eusart_tx_free () != ( EUSART_TX_BUFF_SIZE - 1U ) ) )
+    {
+        printf ( "FAIL: Ring buffer, %lu bytes sent, expected %lu\n", (unsigned long)myOutN, (unsigned long)myExpN );
+        fail    =   1U;
+    }
+
+    printf ( "Ring buffer: %u bytes, %u free once sent\n", n, eusart_tx_free () );
+
+    return fail;
+}
+
+
+/**
+ * @brief       uint8_t check_desc ( void )
+ * @details     Descriptor: completed, done(), ring bytes before and after it.
+ *
+ *
+ * @return      0: Pass, 1: Fail
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+static uint8_t check_desc ( void )
+{
+    eusart_tx_desc_t    other   =   { NULL, 0U, NULL, 0U };
+    eusart_tx_desc_t    empty   =   { NULL, 0U, NULL, 0U };
+    uint8_t             i       =   0U;
+    uint8_t             fail    =   0U;
+
+    eusart_tx_init ();
+    myOutN  =   0UL;
+    myExpN  =   0UL;
+    myDone  =   0UL;
+
+    for ( i = 0U; i < 20U; i++ )
+    {
+        myDescBuff[i]   =   i;
+    }
+    myDesc  =   ( eusart_tx_desc_t ){ &myDescBuff[0], 20U, done, 0U };
+
+    /* Ring "ab", descriptor, ring "cd"  */
+    (void)eusart_write ( (const uint8_t*)"ab", 2U );
+    if ( eusart_send ( &myDesc ) != 1U )
+    {
+        printf ( "FAIL: Descriptor refused\n" );
+        fail    =   1U;
+    }
+    (void)eusart_write ( (const uint8_t*)"cd", 2U );
+    memcpy ( &myExp[0], "ab", 2U );
+    memcpy ( &myExp[2], myDescBuff, 20U );
+    memcpy ( &myExp[22], "cd", 2U );
+    myExpN  =   24UL;
+
+    if ( ( eusart_send ( &other ) != 0U ) || ( myDesc.completed != 0U ) )
+    {
+        printf ( "FAIL: Descriptor in progress, a second one is taken or completed is set\n" );
+        fail    =   1U;
+    }
+
+    while ( eusart_tx_busy () == 1U )
+    {
+        /* completed goes to 1 when the last byte is loaded into TXREG, not earlier */
+        if ( ( myDesc.completed == 1U ) != ( myDone == 1UL ) )
+        {
+            printf ( "FAIL: completed %u, done() called %lu times\n", myDesc.completed, (unsigned long)myDone );
+            fail    =   1U;
+            break;
+        }
+        slot ();
+    }
+
+    if ( ( myDone != 1UL ) || ( myDescEnd != 22UL ) || ( myOutN != myExpN ) || ( memcmp ( myOut, myExp, myExpN ) != 0 ) )
+    {
+        printf ( "FAIL: Descriptor, done() %lu times, it ended at byte %lu ( 22 ), %lu bytes sent\n", (unsigned long)myDone,
+                 (unsigned long)myDescEnd, (unsigned long)myOutN );
+        fail    =   1U;
+    }
+
+    /* Empty descriptor: Completed straight away, nothing sent   */
+    if ( ( eusart_send ( &empty ) != 1U ) || ( empty.completed != 1U ) || ( eusart_tx_busy () != 0U ) )
+    {
+        printf ( "FAIL: Empty descriptor\n" );
+        fail    =   1U;
+    }
+
+    printf ( "Descriptor: 2 + 20 + 2 bytes in order, completed with its last byte\n" );
+
+    return fail;
+}
+
+
+/**
+ * @brief       uint8_t check_order ( void )
+ * @details     Random writes and descriptors, the line is checked against what was accepted.
+ *
+ *
+ * @return      0: Pass, 1: Fail
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+static uint8_t check_order ( void )
+{
+    uint8_t         data[EUSART_SIM_WRITE];
+    uint8_t         fill    =   0U;
+    uint8_t         len     =   0U;
+    uint8_t         n       =   0U;
+    uint8_t         i       =   0U;
+    uint32_t        bytes   =   0UL;
+    uint32_t        descs   =   0UL;
+    uint32_t        calls   =   0UL;
+    uint32_t        r       =   0UL;
+    uint8_t         fail    =   0U;
+    struct timespec t0, t1;
+    double          ns      =   0.0;
+
+    eusart_tx_init ();
+    myOutN      =   0UL;
+    myExpN      =   0UL;
+    myIsrCalls  =   0UL;
+    myIsrIdle   =   0UL;
+    myIdleSlots =   0UL;
+    myDesc.completed    =   1U;
+
+    while ( myExpN < EUSART_SIM_BYTES )
+    {
+        r   =   rnd ();
+
+        if ( ( ( r & 0x0FUL ) == 0UL ) && ( myDesc.completed == 1U ) )
+        {
+            /* Descriptor, binary data  */
+            len =   (uint8_t)( ( r >> 8U ) % ( EUSART_SIM_DESC + 1U ) );
+            for ( i = 0U; i < len; i++ )
+            {
+                myDescBuff[i]   =   (uint8_t)rnd ();
+            }
+            myDesc  =   ( eusart_tx_desc_t ){ &myDescBuff[0], len, NULL, 0U };
+
+            if ( eusart_send ( &myDesc ) == 1U )
+            {
+                memcpy ( &myExp[myExpN], myDescBuff, len );
+                myExpN +=   len;
+                descs++;
+            }
+        }
+        else if ( ( r & 0x03UL ) != 0UL )
+        {
+            len =   (uint8_t)( ( r >> 8U ) % ( EUSART_SIM_WRITE + 1U ) );
+            for ( i = 0U; i < len; i++ )
+            {
+                data[i] =   (uint8_t)( fill++ );
+            }
+            n       =   eusart_write ( &data[0], len );
+            memcpy ( &myExp[myExpN], data, n );
+            myExpN +=   n;
+            fill    =   (uint8_t)( fill - ( len - n ) );
+        }
+
+        /* TXIE set: The interrupt is taken straight away    */
+        service ();
+
+        /* The main loop runs 0 to 3 character times between two calls    */
+        for ( n = (uint8_t)( ( r >> 20U ) & 0x03UL ); n > 0U; n-- )
+        {
+            slot ();
+        }
+    }
+
+    while ( eusart_tx_busy () == 1U )
+    {
+        slot ();
+    }
+    bytes   =   myOutN;
+
+    if ( ( myOutN != myExpN ) || ( memcmp ( myOut, myExp, myExpN ) != 0 ) )
+    {
+        for ( r = 0UL; ( r < myExpN ) && ( myOut[r] == myExp[r] ); r++ );
+        printf ( "FAIL: %lu bytes sent, %lu accepted, first difference at byte %lu\n", (unsigned long)myOutN,
+                 (unsigned long)myExpN, (unsigned long)r );
+        fail    =   1U;
+    }
+
+    /* One byte per interrupt, plus the one which ends every burst   */
+    if ( ( myIsrCalls - myIsrIdle ) != bytes )
+    {
+        printf ( "FAIL: %lu interrupts loaded a byte, %lu bytes sent\n", (unsigned long)( myIsrCalls - myIsrIdle ), (unsigned long)bytes );
+        fail    =   1U;
+    }
+
+    if ( myIdleSlots != 0UL )
+    {
+        printf ( "FAIL: The line was idle %lu character times with data queued\n", (unsigned long)myIdleSlots );
+        fail    =   1U;
+    }
+
+    printf ( "Order: %lu bytes ( %lu descriptors, %lu ring wraps ), %lu interrupts: %.3f bytes per TXIF, %lu idle line slots\n",
+             (unsigned long)bytes, (unsigned long)descs, (unsigned long)( ( bytes - descs ) / EUSART_TX_BUFF_SIZE ),
+             (unsigned long)myIsrCalls, (double)bytes / (double)myIsrCalls, (unsigned long)myIdleSlots );
+
+    /* ISR cost: The ring buffer is kept full, one byte per call   */
+    eusart_tx_init ();
+    (void)clock_gettime ( CLOCK_MONOTONIC, &t0 );
+    for ( r = 0UL; r < 1000000UL; r++ )
+    {
+        if ( eusart_tx_free () != 0U )
+        {
+            (void)eusart_write ( &data[0], eusart_tx_free () );
+        }
+        eusart_tx_isr ();
+        calls++;
+    }
+    (void)clock_gettime ( CLOCK_MONOTONIC, &t1 );
+    ns  =   ( ( ( t1.tv_sec - t0.tv_sec ) * 1e9 ) + ( t1.tv_nsec - t0.tv_nsec ) ) / (double)calls;
+
+    printf ( "ISR cost: %.1f ns per byte on the host, the blocking path spent %.1f us per byte at %lu baud\n", ns,
+             10.0e6 / EUSART_SIM_BAUD, (unsigned long)EUSART_SIM_BAUD );
+
+    return fail;
+}
+
+
+/**@brief Function for application main entry.
+ */
+int main ( void )
+{
+    uint8_t fail    =   0U;
+
+    fail   |=   check_ring ();
+    fail   |=   check_desc ();
+    fail   |=   check_order ();
+
+    printf ( "test_eusart: %s\n", ( fail == 0U ) ? "PASS" : "FAIL" );
+
+    return ( fail == 0U ) ? 0 : 1;
+}
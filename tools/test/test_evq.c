@@ -0,0 +1,444 @@
+/**
+ * @brief       test_evq.c
+ * @details     Host stress test of the single-producer single-consumer event queue ( adc_an0.X, evq.c ).
+ *
+ *              The producer is an interrupt, it posts events at any point of the consumer ( main loop ),
+ *              in the middle of evq_get() and evq_drain() included. Every event carries a sequence number
+ *              ( data ) and a check byte ( id ). Two runs:
+ *
+ *                  - Stepped ( x86-64 Linux ): evq_get() runs one instruction at a time ( trap flag,
+ *                    SIGTRAP ) and the interrupt fills the queue up after instruction k. It is repeated
+ *                    for every k and every number of events in the queue, so every point is preempted.
+ *                  - Timer: A signal handler ( SIGALRM, interval timer ) posts a burst of 0 to
+ *                    EVQ_SIM_BURST events. The consumer takes the events with evq_get() and evq_drain(), in
+ *                    turns, until EVQ_SIM_HITS_MIN interrupts hit the middle of evq_get().
+ *
+ *              The test checks:
+ *
+ *                  - Order: The events are read in the order they were posted.
+ *                  - No event lost: Every event posted is read, the ones dropped are counted as such.
+ *                  - No event duplicated or torn: Every sequence number is read once, with its check byte.
+ *                  - The queue never holds more than EVQ_SIZE events.
+ *
+ *              It is built with __XC8 defined: 8-bit indices as on the PIC16, so they wrap all the time.
+ *
+ *              Build and run: make -C tools/test
+ *
+ * @return      0: Pass, 1: Fail
+ *
+ * @author      Manuel Caballero (aqueronteblog@gmail.com)
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         POSIX host ( sigaction(), setitimer() ).
+ * @warning     N/A
+ */
+#define _DEFAULT_SOURCE
+#include <signal.h>
+#include <stdio.h>
+#include <string.h>
+#include <sys/time.h>
+#include "evq.h"
+
+
+/**@brief Constants.
+ */
+#define EVQ_SIM_PERIOD_US   20L                 /*!<   Interrupt period, us                                 */
+#define EVQ_SIM_BURST       ( EVQ_SIZE + 2U )   /*!<   Events posted per interrupt, max. ( it fills up )    */
+#define EVQ_SIM_HITS_MIN    20000UL             /*!<   Preemptions in the middle of evq_get(), min.         */
+#define EVQ_SIM_IRQ_MAX     20000000UL          /*!<   Interrupts, max. ( the test fails if it is reached ) */
+#define EVQ_SIM_STEPS_MAX   1000UL              /*!<   Instructions of evq_get(), max.                      */
+
+#define EVQ_SIM_CHECK( seq )    ( (uint8_t)( ( (seq) * 0x9DU ) ^ ( (seq) >> 8U ) ) )   /*!<   id of an event  */
+
+#if defined( __x86_64__ ) && defined( __linux__ )
+#define EVQ_SIM_STEP        1U                  /*!<   Stepped run available                                */
+#else
+#define EVQ_SIM_STEP        0U
+#endif
+
+
+/**@brief Variables.
+ */
+static evq_t                    myQueue;
+static volatile sig_atomic_t    myInGet;        /*!<   The consumer is in evq_get()                     */
+static volatile uint16_t        myLog[65536];   /*!<   Sequence numbers posted, in order ( producer )   */
+static volatile uint16_t        myLogHead;      /*!<   Events posted ( producer )                       */
+static volatile uint32_t        myPosted;       /*!<   Events posted ( producer )                       */
+static volatile uint32_t        myDropped;      /*!<   Events dropped ( producer )                      */
+static volatile uint16_t        mySeq;          /*!<   Next sequence number ( producer )                */
+static volatile uint32_t        myIrqs;         /*!<   Interrupts                                       */
+static volatile uint32_t        myHits;         /*!<   Interrupts in the middle of evq_get()            */
+static volatile uint32_t        mySeed  =   1UL;
+static volatile uint32_t        myStep;         /*!<   Stepped run: Instructions executed               */
+static volatile uint32_t        myStepAt;       /*!<   Stepped run: Interrupt after this instruction    */
+
+static uint16_t                 myLogTail;      /*!<   Events read ( consumer )                         */
+static uint32_t                 myRead;         /*!<   Events read ( consumer )                         */
+static uint8_t                  myFail;
+
+
+/**@brief Function prototypes.
+ */
+static void     produce     ( uint8_t n );
+static void     isr         ( int sig );
+static void     consume     ( const evq_event_t* evt );
+static void     timer_set   ( long us );
+static void     run_timer   ( void );
+#if ( EVQ_SIM_STEP == 1U )
+static void     trap        ( int sig );
+static void     step        ( uint8_t on );
+static void     run_step    ( void );
+#endif
+
+
+
+/**
+ * @brief       void produce ( uint8_t )
+ * @details     Producer: It posts n events, the ones posted are logged in order.
+ *
+ *
+ * @param[in]    n:         Events.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+static void produce ( uint8_t n )
+{
+    uint16_t    seq     =   0U;
+
+    for ( ; n > 0U; n-- )
+    {
+        seq =   mySeq;
+
+        if ( evq_post ( &myQueue, EVQ_SIM_CHECK( seq ), seq ) == 1U )
+        {
+            myLog[myLogHead]    =   seq;
+            myLogHead           =   (uint16_t)( myLogHead + 1U );
+            myPosted++;
+        }
+        else
+        {
+            myDropped++;
+        }
+        mySeq   =   (uint16_t)( seq + 1U );
+    }
+}
+
+
+/**
+ * @brief       void isr ( int )
+ * @details     Timer run, interrupt: It posts 0 to EVQ_SIM_BURST events ( xorshift32 ).
+ *
+ *
+ * @param[in]    sig:       Signal.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+static void isr ( int sig )
+{
+    uint32_t    seed    =   mySeed;
+
+    myIrqs++;
+    if ( myInGet != 0 )
+    {
+        myHits++;
+    }
+
+    seed   ^=   seed << 13U;
+    seed   ^=   seed >> 17U;
+    seed   ^=   seed << 5U;
+    mySeed  =   seed;
+
+    produce ( (uint8_t)( seed % ( EVQ_SIM_BURST + 1U ) ) );
+}
+
+
+/**
+ * @brief       void consume ( const evq_event_t* )
+ * @details     Consumer: The event must be the next one posted, with its check byte.
+ *
+ *
+ * @param[in]    evt:       Event read.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+static void consume ( const evq_event_t* evt )
+{
+    if ( ( myFail == 0U ) && ( ( myLogTail == myLogHead ) || ( evt->data != myLog[myLogTail] ) || ( evt->id != EVQ_SIM_CHECK( evt->data ) ) ) )
+    {
+        printf ( "FAIL: Event %lu: seq %u ( id 0x%02X ), expected %u\n", (unsigned long)myRead, evt->data, evt->id,
+                 ( myLogTail == myLogHead ) ? 0xFFFFU : myLog[myLogTail] );
+        myFail  =   1U;
+    }
+
+    myLogTail   =   (uint16_t)( myLogTail + 1U );
+    myRead++;
+}
+
+
+/**
+ * @brief       void timer_set ( long )
+ * @details     It starts the interval timer ( SIGALRM ) or stops it ( 0 us ).
+ *
+ *
+ * @param[in]    us:        Period, us.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+static void timer_set ( long us )
+{
+    struct itimerval    it;
+
+    it.it_interval.tv_sec   =   0L;
+    it.it_interval.tv_usec  =   us;
+    it.it_value             =   it.it_interval;
+    (void)setitimer ( ITIMER_REAL, &it, NULL );
+}
+
+
+/**
+ * @brief       void run_timer ( void )
+ * @details     Timer run: The consumer takes the events while the timer interrupt posts them.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+static void run_timer ( void )
+{
+    evq_event_t evt;
+    evq_idx_t   count   =   0U;
+    uint32_t    turn    =   0UL;
+    uint8_t     got     =   0U;
+
+    timer_set ( EVQ_SIM_PERIOD_US );
+
+    while ( ( myFail == 0U ) && ( myHits < EVQ_SIM_HITS_MIN ) && ( myIrqs < EVQ_SIM_IRQ_MAX ) )
+    {
+        if ( ( turn++ & 1UL ) == 0UL )
+        {
+            do
+            {
+                myInGet =   1;
+                got     =   evq_get ( &myQueue, &evt );
+                myInGet =   0;
+
+                if ( got == 1U )
+                {
+                    consume ( &evt );
+                }
+            } while ( got == 1U );
+        }
+        else
+        {
+            (void)evq_drain ( &myQueue, consume );
+        }
+
+        count   =   evq_count ( &myQueue );
+        if ( count > EVQ_SIZE )
+        {
+            printf ( "FAIL: %u events in the queue\n", (unsigned)count );
+            myFail  =   1U;
+        }
+    }
+
+    /* The producer stops, the last events are read   */
+    timer_set ( 0L );
+    while ( evq_get ( &myQueue, &evt ) == 1U )
+    {
+        consume ( &evt );
+    }
+
+    printf ( "Timer run: %lu interrupts ( %lu in evq_get() )\n", (unsigned long)myIrqs, (unsigned long)myHits );
+
+    if ( ( myFail == 0U ) && ( myHits < EVQ_SIM_HITS_MIN ) )
+    {
+        printf ( "FAIL: %lu interrupts in evq_get(), expected %lu\n", (unsigned long)myHits, (unsigned long)EVQ_SIM_HITS_MIN );
+        myFail  =   1U;
+    }
+}
+
+
+#if ( EVQ_SIM_STEP == 1U )
+/**
+ * @brief       void trap ( int )
+ * @details     Stepped run: Called after every instruction ( SIGTRAP ), the interrupt fills the queue up after
+ *              instruction myStepAt.
+ *
+ *
+ * @param[in]    sig:       Signal.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+static void trap ( int sig )
+{
+    if ( myStep++ == myStepAt )
+    {
+        produce ( (uint8_t)EVQ_SIZE );
+    }
+}
+
+
+/**
+ * @brief       void step ( uint8_t )
+ * @details     Stepped run: It sets or clears the trap flag ( EFLAGS.TF ), one SIGTRAP per instruction.
+ *
+ *
+ * @param[in]    on:        1: Step, 0: Run.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     It is not inlined: pushfq must not overwrite the red zone of the caller.
+ */
+__attribute__(( noinline )) static void step ( uint8_t on )
+{
+    if ( on == 1U )
+    {
+        __asm__ volatile ( "pushfq\n\torq $0x100, (%%rsp)\n\tpopfq" ::: "memory", "cc" );
+    }
+    else
+    {
+        __asm__ volatile ( "pushfq\n\tandq $~0x100, (%%rsp)\n\tpopfq" ::: "memory", "cc" );
+    }
+}
+
+
+/**
+ * @brief       void run_step ( void )
+ * @details     Stepped run: evq_get() is preempted after every instruction, with 0 to EVQ_SIZE events in the
+ *              queue.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+static void run_step ( void )
+{
+    evq_event_t evt;
+    uint32_t    fill    =   0UL;
+    uint32_t    at      =   0UL;
+    uint32_t    hits    =   0UL;
+    uint32_t    len     =   0UL;
+    uint8_t     got     =   0U;
+
+    for ( fill = 0UL; fill <= EVQ_SIZE; fill++ )
+    {
+        for ( at = 0UL; ( at < EVQ_SIM_STEPS_MAX ) && ( myFail == 0U ); at++ )
+        {
+            produce ( (uint8_t)fill );
+
+            myStep      =   0UL;
+            myStepAt    =   at;
+            step ( 1U );
+            got         =   evq_get ( &myQueue, &evt );
+            step ( 0U );
+
+            if ( got == 1U )
+            {
+                consume ( &evt );
+            }
+
+            while ( evq_get ( &myQueue, &evt ) == 1U )
+            {
+                consume ( &evt );
+            }
+
+            /* Every instruction is done  */
+            if ( myStep <= at )
+            {
+                len =   ( at > len ) ? at : len;
+                break;
+            }
+            hits++;
+        }
+    }
+
+    printf ( "Stepped run: %lu preemptions, %lu instructions at most\n", (unsigned long)hits, (unsigned long)len );
+}
+#endif
+
+
+/**@brief Function for application main entry.
+ */
+int main ( void )
+{
+    struct sigaction    sa;
+
+    evq_init ( &myQueue );
+
+    memset ( &sa, 0, sizeof ( sa ) );
+    (void)sigemptyset ( &sa.sa_mask );
+
+#if ( EVQ_SIM_STEP == 1U )
+    sa.sa_handler   =   trap;
+    (void)sigaction ( SIGTRAP, &sa, NULL );
+    run_step ();
+#endif
+
+    sa.sa_handler   =   isr;
+    (void)sigaction ( SIGALRM, &sa, NULL );
+    run_timer ();
+
+    printf ( "test_evq: %lu events posted, %lu read, %lu dropped\n", (unsigned long)myPosted, (unsigned long)myRead,
+             (unsigned long)myDropped );
+
+    if ( ( myRead != myPosted ) || ( evq_dropped ( &myQueue ) != (evq_idx_t)myDropped ) || ( evq_count ( &myQueue ) != 0U ) )
+    {
+        printf ( "FAIL: Events lost or duplicated, dropped %u ( queue ), %lu ( producer )\n", (unsigned)evq_dropped ( &myQueue ),
+                 (unsigned long)myDropped );
+        myFail  =   1U;
+    }
+
+    printf ( "test_evq: %s\n", ( myFail == 0U ) ? "PASS" : "FAIL" );
+
+    return ( myFail == 0U ) ? 0 : 1;
+}
@@ -0,0 +1,239 @@
+/**
+ * @brief       test_ptick.c
+ * @details     Host test of the drift-free periodic tick ( ptick.c ): 24h simulation.
+ *
+ *              The timer is modelled in counts of its clock: The overflows happen at their exact time and
+ *              ptick_isr() is called after a random latency ( 0 to PTICK_SIM_LAT_MAX counts ), with the
+ *              timer registers read at that time. It is built twice ( Makefile ):
+ *
+ *                  - Timer0 ( timer0_interrupt.X ): Free-running, phase accumulator. Every tick must be
+ *                    within one overflow ( PTICK_T0_OVF ) and the jitter budget ( PTICK_JITTER_MS ) of its
+ *                    ideal time, the error must not grow.
+ *                  - Timer1 ( timer1_overflow.X ): TMR1H reload. The ISR waits if TMR1L is about to carry
+ *                    ( PTICK_T1_GUARD ). Every tick must be at its ideal time.
+ *
+ *              The ticks in 24h must be PTICK_TICKS_24H and the statistics must match the latencies. The
+ *              overwriting reload is simulated as well ( it loses the latency every tick ): Its drift must
+ *              match the projection of ptick_drift_24h_ms().
+ *
+ *              Build and run: make -C tools/test
+ *
+ * @return      0: Pass, 1: Fail
+ *
+ * @author      Manuel Caballero (aqueronteblog@gmail.com)
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+#include <stdio.h>
+#include "ptick.h"
+
+
+/**@brief Constants.
+ */
+#define PTICK_SIM_LAT_MAX   60UL        /*!<   ISR latency, max. counts ( ~2ms at 31.25kHz )            */
+#define PTICK_SIM_PROJ_TOL  1000UL      /*!<   Projection tolerance: 1/PTICK_SIM_PROJ_TOL of the drift  */
+
+
+/**@brief Variables.
+ */
+static uint32_t myLatSum;       /*!<   Latencies read by the tick service, sum   */
+static uint16_t myLatMax;       /*!<   Latencies read by the tick service, max   */
+static uint32_t mySeed  =   1UL;
+
+
+/**@brief Function prototypes.
+ */
+static uint32_t latency     ( void );
+static uint8_t  check_stats ( uint32_t ticks, uint64_t drift_old );
+
+
+
+/**
+ * @brief       uint32_t latency ( void )
+ * @details     ISR latency, 0 to PTICK_SIM_LAT_MAX counts ( xorshift32 ).
+ *
+ *
+ * @return      Latency, counts
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+static uint32_t latency ( void )
+{
+    mySeed ^=   mySeed << 13U;
+    mySeed ^=   mySeed >> 17U;
+    mySeed ^=   mySeed << 5U;
+
+    return mySeed % ( PTICK_SIM_LAT_MAX + 1UL );
+}
+
+
+/**
+ * @brief       uint8_t check_stats ( uint32_t , uint64_t )
+ * @details     It checks the statistics against the latencies and the 24h projection against the drift of
+ *              the overwriting reload.
+ *
+ *
+ * @param[in]    ticks:     Ticks simulated.
+ * @param[in]    drift_old: Drift of the overwriting reload, counts.
+ *
+ *
+ * @return      0: Pass, 1: Fail
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+static uint8_t check_stats ( uint32_t ticks, uint64_t drift_old )
+{
+    ptick_stats_t   stats;
+    uint32_t        proj    =   0UL;
+    uint32_t        old_ms  =   0UL;
+    uint32_t        diff    =   0UL;
+    uint8_t         fail    =   0U;
+
+    ptick_get_stats ( &stats );
+    proj    =   ptick_drift_24h_ms ( &stats );
+    old_ms  =   (uint32_t)( ( ( drift_old * 1000U ) + ( PTICK_F_CLK / 2UL ) ) / PTICK_F_CLK );
+    diff    =   ( proj > old_ms ) ? ( proj - old_ms ) : ( old_ms - proj );
+
+    printf ( "Overwriting reload: %lu ms/day of drift, projection ( ptick_drift_24h_ms() ): %lu ms/day\n",
+             (unsigned long)old_ms, (unsigned long)proj );
+
+    if ( ( stats.ticks != ticks ) || ( stats.latency_sum != myLatSum ) || ( stats.latency_max != myLatMax ) )
+    {
+        printf ( "FAIL: Statistics, %lu ticks, latency %lu ( max %u ), expected %lu, %lu ( max %u )\n", (unsigned long)stats.ticks,
+                 (unsigned long)stats.latency_sum, stats.latency_max, (unsigned long)ticks, (unsigned long)myLatSum, myLatMax );
+        fail    =   1U;
+    }
+
+    /* Rounding: 1/16 count of average latency and PTICK_MS_PER_COUNT_24H  */
+    if ( diff > ( ( PTICK_MS_PER_COUNT_24H / 16UL ) + ( old_ms / PTICK_SIM_PROJ_TOL ) + 1UL ) )
+    {
+        printf ( "FAIL: Projection %lu ms, simulated %lu ms\n", (unsigned long)proj, (unsigned long)old_ms );
+        fail    =   1U;
+    }
+
+    return fail;
+}
+
+
+/**@brief Function for application main entry.
+ */
+int main ( void )
+{
+    const uint64_t  day     =   (uint64_t)PTICK_TICKS_24H * PTICK_COUNTS;
+    uint64_t        t_ovf   =   0U;         /*!<   Time of the last overflow, counts       */
+    uint64_t        drift   =   0U;         /*!<   Overwriting reload: Counts lost         */
+    uint64_t        ideal   =   0U;
+    uint64_t        err_max =   0U;
+    uint32_t        ticks   =   0UL;
+    uint32_t        lat     =   0UL;
+    uint8_t         fail    =   0U;
+
+    ptick_init ();
+
+#if ( PTICK_TIMER == PTICK_TIMER0 )
+    uint64_t    err     =   0U;
+
+    printf ( "Timer0, %lu Hz, %lu/%lu s: 1:%lu, overflow %lu counts, jitter budget %lu counts\n", (unsigned long)PTICK_F_CLK,
+             (unsigned long)PTICK_NUM, (unsigned long)PTICK_DEN, (unsigned long)PTICK_T0_PRESC, (unsigned long)PTICK_T0_OVF,
+             (unsigned long)PTICK_JITTER_COUNTS );
+
+    while ( ticks < PTICK_TICKS_24H )
+    {
+        /* Overflow, the ISR runs later: TMR0 counts every prescaler period   */
+        t_ovf              +=   PTICK_T0_OVF;
+        lat                 =   latency ();
+        TMR0                =   (uint8_t)( lat >> PTICK_T0_K );
+        INTCONbits.TMR0IF   =   0U;
+
+        if ( ptick_isr () == 1U )
+        {
+            ticks++;
+            lat         =   ( lat >> PTICK_T0_K ) << PTICK_T0_K;
+            myLatSum   +=   lat;
+            myLatMax    =   ( lat > myLatMax ) ? (uint16_t)lat : myLatMax;
+            drift      +=   lat;
+
+            /* The tick is due at the overflow: Never early, one overflow late at most  */
+            ideal   =   (uint64_t)ticks * PTICK_COUNTS;
+            err     =   t_ovf - ideal;
+            err_max =   ( err > err_max ) ? err : err_max;
+
+            if ( ( t_ovf < ideal ) || ( err >= PTICK_T0_OVF ) || ( err > PTICK_JITTER_COUNTS ) )
+            {
+                printf ( "FAIL: Tick %lu at %llu counts, expected %llu\n", (unsigned long)ticks, (unsigned long long)t_ovf,
+                         (unsigned long long)ideal );
+                fail    =   1U;
+                break;
+            }
+        }
+    }
+#else
+    uint32_t    tmr1    =   ( (uint32_t)TMR1H << 8U ) | TMR1L;
+
+    printf ( "Timer1, %lu Hz, %lu/%lu s: TMR1H reload 0x%02X, guard 0x%02X\n", (unsigned long)PTICK_F_CLK,
+             (unsigned long)PTICK_NUM, (unsigned long)PTICK_DEN, PTICK_T1_TMR1H, PTICK_T1_GUARD );
+
+    while ( ticks < PTICK_TICKS_24H )
+    {
+        /* Overflow, the ISR runs later and waits if TMR1L is about to carry   */
+        t_ovf  +=   65536UL - tmr1;
+        lat     =   latency ();
+        if ( ( lat & 0xFFUL ) >= PTICK_T1_GUARD )
+        {
+            lat =   ( lat | 0xFFUL ) + 1UL;
+        }
+        TMR1H           =   (uint8_t)( lat >> 8U );
+        TMR1L           =   (uint8_t)lat;
+        PIR1bits.TMR1IF =   0U;
+
+        if ( ptick_isr () != 1U )
+        {
+            printf ( "FAIL: No tick at the overflow\n" );
+            fail    =   1U;
+            break;
+        }
+
+        /* Timer1 after the ISR, the next overflow is worked out from it    */
+        ticks++;
+        tmr1        =   ( ( (uint32_t)TMR1H << 8U ) | TMR1L ) - lat;
+        myLatSum   +=   lat;
+        myLatMax    =   ( lat > myLatMax ) ? (uint16_t)lat : myLatMax;
+        drift      +=   lat;
+
+        /* No jitter  */
+        ideal   =   (uint64_t)ticks * PTICK_COUNTS;
+        if ( t_ovf != ideal )
+        {
+            printf ( "FAIL: Tick %lu at %llu counts, expected %llu\n", (unsigned long)ticks, (unsigned long long)t_ovf,
+                     (unsigned long long)ideal );
+            fail    =   1U;
+            break;
+        }
+    }
+#endif
+
+    printf ( "Tick service: %lu ticks in 24h ( %llu counts ), max. jitter %llu counts, error after 24h %llu counts\n",
+             (unsigned long)ticks, (unsigned long long)day, (unsigned long long)err_max, (unsigned long long)( t_ovf - day ) );
+
+    if ( ( fail == 0U ) && ( ( ticks != PTICK_TICKS_24H ) || ( ( t_ovf - day ) > err_max ) ) )
+    {
+        printf ( "FAIL: The tick drifts\n" );
+        fail    =   1U;
+    }
+
+    fail   |=   check_stats ( ticks, drift );
+
+    printf ( "test_ptick ( %s ): %s\n", ( PTICK_TIMER == PTICK_TIMER0 ) ? "Timer0" : "Timer1", ( fail == 0U ) ? "PASS" : "FAIL" );
+
+    return ( fail == 0U ) ? 0 : 1;
+}
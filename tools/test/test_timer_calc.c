@@ -0,0 +1,440 @@
+/**
+ * @brief       test_timer_calc.c
+ * @details     Host test of the compile-time timer period calculator ( timer_calc.h ).
+ *
+ *              TIMER_CALC_T0/T1/T2_DEFINE() are instantiated for every timer clock of TEST_CLOCKS and every
+ *              period of TEST_PERIODS. Each result is checked against an exhaustive search over every
+ *              register setting, with the datasheet formulas:
+ *
+ *                  - Timer0:     Prescaler*( 256 - TMR0 ), Prescaler: 1 ( PSA = 1 ) or 2^( PS + 1 )
+ *                  - Timer1:     Prescaler*( 65536 - TMR1H:TMR1L ), Prescaler: 2^CKPS
+ *                  - Timer2/4/6: Prescaler*( OUTPS + 1 )*( PR + 1 ), Prescaler: 4^CKPS
+ *
+ *              The settings of the calculator must give its error, the lowest one of the search, ties to the
+ *              smallest prescaler ( and postscaler ). A period is reachable if one prescaler ( postscaler )
+ *              gets a rounded count within the register range. The build assertion is replaced here by a
+ *              flag, so the unreachable periods are checked too. The real assertion is checked by the
+ *              Makefile: TEST_ASSERT = 1 ( reachable ) must build, TEST_ASSERT = 2 ( unreachable ) must not.
+ *
+ *              Build and run: make -C tools/test
+ *
+ * @return      0: Pass, 1: Fail
+ *
+ * @author      Manuel Caballero (aqueronteblog@gmail.com)
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+#include <stdio.h>
+#include "timer_calc.h"
+
+#if defined( TEST_ASSERT )
+#if ( TEST_ASSERT == 1 )
+/* Timer0, 10ms at 31.25kHz: It builds  */
+TIMER_CALC_T0_DEFINE( myPeriod, 31250UL, 1UL, 100UL );
+#else
+/* Timer0, 1 hour at 2MHz: It must not build    */
+TIMER_CALC_T0_DEFINE( myPeriod, 2000000UL, 3600UL, 1UL );
+#endif
+
+int main ( void )
+{
+    return myPeriod_ERROR;
+}
+#else
+#undef  TIMER_CALC_ASSERT
+#define TIMER_CALC_ASSERT( name, cond )         enum{ name##_reachable = ( cond ) ? 1 : 0 }
+
+
+/**@brief Constants.
+ */
+/**@brief Timer clocks ( Hz ): F_OSC/4 of the internal oscillator settings, F_OSC for Timer1 and the 32.768kHz SOSC.
+ */
+#define TEST_CLOCKS( X )    \
+    TEST_PERIODS( X, 7750UL )       TEST_PERIODS( X, 7812UL )       TEST_PERIODS( X, 15625UL )      \
+    TEST_PERIODS( X, 31250UL )      TEST_PERIODS( X, 32768UL )      TEST_PERIODS( X, 62500UL )      \
+    TEST_PERIODS( X, 125000UL )     TEST_PERIODS( X, 250000UL )     TEST_PERIODS( X, 500000UL )     \
+    TEST_PERIODS( X, 1000000UL )    TEST_PERIODS( X, 2000000UL )    TEST_PERIODS( X, 4000000UL )    \
+    TEST_PERIODS( X, 8000000UL )    TEST_PERIODS( X, 16000000UL )   TEST_PERIODS( X, 32000000UL )
+
+/**@brief Periods, num/den seconds.
+ */
+#define TEST_PERIODS( X, f )    \
+    X( f, 1UL, 100000UL )   X( f, 1UL, 10000UL )    X( f, 1UL, 1000UL )     X( f, 7UL, 1000UL )     \
+    X( f, 1UL, 100UL )      X( f, 1UL, 60UL )       X( f, 1UL, 32UL )       X( f, 1UL, 10UL )       \
+    X( f, 1UL, 4UL )        X( f, 1UL, 3UL )        X( f, 1UL, 2UL )        X( f, 1UL, 1UL )        \
+    X( f, 2UL, 1UL )        X( f, 8UL, 1UL )        X( f, 60UL, 1UL )
+
+
+/**@brief Calculator result.
+ */
+typedef struct{
+  uint32_t  f_clk;
+  uint32_t  num;
+  uint32_t  den;
+  int       reachable;
+  int       presc;          /*!<   Prescaler                                    */
+  int       outps;          /*!<   Postscaler - 1 ( Timer2/4/6 )                */
+  uint32_t  reg;            /*!<   TMR0, TMR1H:TMR1L or PR                      */
+  int       error;          /*!<   Error, counts                                */
+} calc_t;
+
+
+/**@brief Variables.
+ */
+static uint32_t myCases;
+static uint32_t myReachable;
+
+
+/**@brief Function prototypes.
+ */
+static uint8_t  check_t0    ( const calc_t* c, int psa, int ps );
+static uint8_t  check_t1    ( const calc_t* c, int ckps, int tmr1h, int tmr1l );
+static uint8_t  check_t2    ( const calc_t* c, int ckps );
+static uint8_t  check       ( const char* timer, const calc_t* c, uint32_t counts, uint32_t best, int reachable );
+static uint32_t target      ( const calc_t* c );
+static uint32_t distance    ( uint32_t a, uint32_t b );
+static uint8_t  in_range    ( uint32_t n, uint32_t d, uint32_t max );
+
+
+
+/**
+ * @brief       uint32_t target ( const calc_t* )
+ * @details     Counts of the period, rounded.
+ *
+ *
+ * @param[in]    c:         Clock and period.
+ *
+ *
+ * @return      Counts
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+static uint32_t target ( const calc_t* c )
+{
+    return (uint32_t)( ( ( (uint64_t)c->f_clk * c->num ) + ( c->den / 2UL ) ) / c->den );
+}
+
+
+/**
+ * @brief       uint32_t distance ( uint32_t , uint32_t )
+ * @details     | a - b |.
+ *
+ *
+ * @param[in]    a, b:      Counts.
+ *
+ *
+ * @return      Distance
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+static uint32_t distance ( uint32_t a, uint32_t b )
+{
+    return ( a > b ) ? ( a - b ) : ( b - a );
+}
+
+
+/**
+ * @brief       uint8_t in_range ( uint32_t , uint32_t , uint32_t )
+ * @details     It checks if n/d rounded is 1 to max.
+ *
+ *
+ * @param[in]    n:         Counts.
+ * @param[in]    d:         Divider.
+ * @param[in]    max:       Register range.
+ *
+ *
+ * @return      1: In range, 0: Out of range
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+static uint8_t in_range ( uint32_t n, uint32_t d, uint32_t max )
+{
+    uint32_t    t   =   ( n + ( d / 2UL ) ) / d;
+
+    return ( ( t >= 1UL ) && ( t <= max ) ) ? 1U : 0U;
+}
+
+
+/**
+ * @brief       uint8_t check ( const char* , const calc_t* , uint32_t , uint32_t , int )
+ * @details     It compares the calculator with the exhaustive search.
+ *
+ *
+ * @param[in]    timer:     Timer name.
+ * @param[in]    c:         Calculator result.
+ * @param[in]    counts:    Counts of the calculator settings ( datasheet formula ).
+ * @param[in]    best:      Lowest error of the search.
+ * @param[in]    reachable: Reachable by the search.
+ *
+ *
+ * @return      0: Pass, 1: Fail
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+static uint8_t check ( const char* timer, const calc_t* c, uint32_t counts, uint32_t best, int reachable )
+{
+    const uint32_t  n   =   target ( c );
+
+    myCases++;
+
+    if ( c->reachable != reachable )
+    {
+        printf ( "FAIL: %s, f = %lu Hz, %lu/%lu s: reachable %d, expected %d\n", timer, (unsigned long)c->f_clk,
+                 (unsigned long)c->num, (unsigned long)c->den, c->reachable, reachable );
+        return 1U;
+    }
+
+    if ( reachable == 0 )
+    {
+        return 0U;
+    }
+    myReachable++;
+
+    if ( ( distance ( counts, n ) != (uint32_t)c->error ) || ( (uint32_t)c->error != best ) )
+    {
+        printf ( "FAIL: %s, f = %lu Hz, %lu/%lu s: %lu counts ( error %d ), expected %lu +/- %lu\n", timer, (unsigned long)c->f_clk,
+                 (unsigned long)c->num, (unsigned long)c->den, (unsigned long)counts, c->error, (unsigned long)n, (unsigned long)best );
+        return 1U;
+    }
+
+    return 0U;
+}
+
+
+/**
+ * @brief       uint8_t check_t0 ( const calc_t* , int , int )
+ * @details     Timer0: Every prescaler and TMR0.
+ *
+ *
+ * @param[in]    c:         Calculator result.
+ * @param[in]    psa, ps:   Calculator OPTION_REG fields.
+ *
+ *
+ * @return      0: Pass, 1: Fail
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+static uint8_t check_t0 ( const calc_t* c, int psa, int ps )
+{
+    const uint32_t  n       =   target ( c );
+    uint32_t        best    =   0xFFFFFFFFUL;
+    uint32_t        best_p  =   0UL;
+    uint32_t        p       =   0UL;
+    uint32_t        t       =   0UL;
+    int             reach   =   0;
+    uint8_t         fail    =   0U;
+
+    for ( p = 1UL; p <= 256UL; p <<= 1U )
+    {
+        reach  |=   in_range ( n, p, 256UL );
+
+        for ( t = 0UL; t < 256UL; t++ )
+        {
+            if ( distance ( p * ( 256UL - t ), n ) < best )
+            {
+                best    =   distance ( p * ( 256UL - t ), n );
+                best_p  =   p;
+            }
+        }
+    }
+
+    if ( c->reachable == 1 )
+    {
+        /* Register fields against the prescaler, ties to the smallest one  */
+        if ( ( ( psa == 1 ) && ( ( c->presc != 1 ) || ( ps != 0 ) ) ) || ( ( psa == 0 ) && ( c->presc != ( 2 << ps ) ) ) ||
+             ( c->reg > 255UL ) || ( ( (uint32_t)c->error == best ) && ( (uint32_t)c->presc != best_p ) ) )
+        {
+            printf ( "FAIL: T0, f = %lu Hz, %lu/%lu s: PSA %d, PS %d, prescaler %d, TMR0 %lu\n", (unsigned long)c->f_clk,
+                     (unsigned long)c->num, (unsigned long)c->den, psa, ps, c->presc, (unsigned long)c->reg );
+            fail    =   1U;
+        }
+    }
+
+    return fail | check ( "T0", c, (uint32_t)c->presc * ( 256UL - c->reg ), best, reach );
+}
+
+
+/**
+ * @brief       uint8_t check_t1 ( const calc_t* , int , int , int )
+ * @details     Timer1: Every prescaler and TMR1.
+ *
+ *
+ * @param[in]    c:         Calculator result.
+ * @param[in]    ckps:      Calculator T1CKPS.
+ * @param[in]    tmr1h:     Calculator TMR1H.
+ * @param[in]    tmr1l:     Calculator TMR1L.
+ *
+ *
+ * @return      0: Pass, 1: Fail
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+static uint8_t check_t1 ( const calc_t* c, int ckps, int tmr1h, int tmr1l )
+{
+    const uint32_t  n       =   target ( c );
+    const uint32_t  tmr1    =   ( (uint32_t)tmr1h << 8U ) | (uint32_t)tmr1l;
+    uint32_t        best    =   0xFFFFFFFFUL;
+    uint32_t        best_p  =   0UL;
+    uint32_t        p       =   0UL;
+    uint32_t        t       =   0UL;
+    int             reach   =   0;
+    uint8_t         fail    =   0U;
+
+    for ( p = 1UL; p <= 8UL; p <<= 1U )
+    {
+        reach  |=   in_range ( n, p, 65536UL );
+
+        for ( t = 0UL; t < 65536UL; t++ )
+        {
+            if ( distance ( p * ( 65536UL - t ), n ) < best )
+            {
+                best    =   distance ( p * ( 65536UL - t ), n );
+                best_p  =   p;
+            }
+        }
+    }
+
+    if ( c->reachable == 1 )
+    {
+        if ( ( c->presc != ( 1 << ckps ) ) || ( ckps > 3 ) || ( tmr1h > 255 ) || ( tmr1l > 255 ) ||
+             ( ( (uint32_t)c->error == best ) && ( (uint32_t)c->presc != best_p ) ) )
+        {
+            printf ( "FAIL: T1, f = %lu Hz, %lu/%lu s: CKPS %d, prescaler %d, TMR1 0x%02X%02X\n", (unsigned long)c->f_clk,
+                     (unsigned long)c->num, (unsigned long)c->den, ckps, c->presc, tmr1h, tmr1l );
+            fail    =   1U;
+        }
+    }
+
+    return fail | check ( "T1", c, (uint32_t)c->presc * ( 65536UL - tmr1 ), best, reach );
+}
+
+
+/**
+ * @brief       uint8_t check_t2 ( const calc_t* , int )
+ * @details     Timer2/4/6: Every prescaler, postscaler and PR.
+ *
+ *
+ * @param[in]    c:         Calculator result.
+ * @param[in]    ckps:      Calculator TxCKPS.
+ *
+ *
+ * @return      0: Pass, 1: Fail
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+static uint8_t check_t2 ( const calc_t* c, int ckps )
+{
+    const uint32_t  n       =   target ( c );
+    uint32_t        best    =   0xFFFFFFFFUL;
+    uint32_t        best_p  =   0UL;
+    uint32_t        best_o  =   0UL;
+    uint32_t        p       =   0UL;
+    uint32_t        o       =   0UL;
+    uint32_t        pr      =   0UL;
+    int             reach   =   0;
+    uint8_t         fail    =   0U;
+
+    for ( p = 1UL; p <= 64UL; p <<= 2U )
+    {
+        for ( o = 1UL; o <= 16UL; o++ )
+        {
+            reach  |=   in_range ( n, p * o, 256UL );
+
+            for ( pr = 0UL; pr < 256UL; pr++ )
+            {
+                if ( distance ( p * o * ( pr + 1UL ), n ) < best )
+                {
+                    best    =   distance ( p * o * ( pr + 1UL ), n );
+                    best_p  =   p;
+                    best_o  =   o;
+                }
+            }
+        }
+    }
+
+    if ( c->reachable == 1 )
+    {
+        if ( ( c->presc != ( 1 << ( 2 * ckps ) ) ) || ( ckps > 3 ) || ( c->outps > 15 ) || ( c->reg > 255UL ) ||
+             ( ( (uint32_t)c->error == best ) && ( ( (uint32_t)c->presc != best_p ) || ( (uint32_t)( c->outps + 1 ) != best_o ) ) ) )
+        {
+            printf ( "FAIL: T2, f = %lu Hz, %lu/%lu s: CKPS %d, OUTPS %d, PR %lu\n", (unsigned long)c->f_clk,
+                     (unsigned long)c->num, (unsigned long)c->den, ckps, c->outps, (unsigned long)c->reg );
+            fail    =   1U;
+        }
+    }
+
+    return fail | check ( "T2", c, (uint32_t)c->presc * (uint32_t)( c->outps + 1 ) * ( c->reg + 1UL ), best, reach );
+}
+
+
+/**@brief One clock and period: The three calculators, compared with the search.
+ */
+#define TEST_CASE( f, num, den )    \
+    { \
+        TIMER_CALC_T0_DEFINE( t0, f, num, den ); \
+        TIMER_CALC_T1_DEFINE( t1, f, num, den ); \
+        TIMER_CALC_T2_DEFINE( t2, f, num, den ); \
+        calc_t  c0  =   { f, num, den, t0_reachable, t0_PRESC, 0, (uint32_t)t0_TMR0, t0_ERROR }; \
+        calc_t  c1  =   { f, num, den, t1_reachable, t1_PRESC, 0, ( (uint32_t)t1_TMR1H << 8U ) | (uint32_t)t1_TMR1L, t1_ERROR }; \
+        calc_t  c2  =   { f, num, den, t2_reachable, t2_PRESC, t2_OUTPS, (uint32_t)t2_PR, t2_ERROR }; \
+        fail   |=   check_t0 ( &c0, t0_PSA, t0_PS ); \
+        fail   |=   check_t1 ( &c1, t1_CKPS, t1_TMR1H, t1_TMR1L ); \
+        fail   |=   check_t2 ( &c2, t2_CKPS ); \
+    }
+
+
+/**@brief Function for application main entry.
+ */
+int main ( void )
+{
+    uint8_t fail    =   0U;
+
+    TEST_CLOCKS( TEST_CASE )
+
+    /* Documented example: Timer2, 0.5s at F_OSC = 125kHz -> 1:4, 1:16, PR2 = 243  */
+    {
+        TIMER_CALC_T2_DEFINE( myT2, 125000UL/4UL, 1UL, 2UL );
+
+        if ( ( myT2_CKPS != 0b01 ) || ( myT2_OUTPS != 0b1111 ) || ( myT2_PR != 243 ) )
+        {
+            printf ( "FAIL: T2 example, CKPS %d, OUTPS %d, PR %d\n", myT2_CKPS, myT2_OUTPS, myT2_PR );
+            fail    =   1U;
+        }
+    }
+
+    printf ( "test_timer_calc: %lu cases ( %lu reachable ), %s\n", (unsigned long)myCases, (unsigned long)myReachable, ( fail == 0U ) ? "PASS" : "FAIL" );
+
+    return ( fail == 0U ) ? 0 : 1;
+}
+
+#endif
@@ -0,0 +1,505 @@
+/**
+ * @brief       test_uart1.c
+ * @details     Host test of the UART1 FIFO driver, interrupt back end ( UART.X, uart1.c ). The UART1 is modelled
+ *              one character time at a time ( pic32/ ), the interrupts are dispatched as soon as their flag is set.
+ *              It is built for every threshold ( Makefile: UART1_TXISEL, UART1_RXISEL ):
+ *
+ *                  - Tx: Random writes, saturated and sparse. Every byte must go out in order, none may be written
+ *                        into a full Tx FIFO and the line must not be idle while there is data. Bursts: Every Tx
+ *                        interrupt must fill the Tx FIFO ( UTXBF = 1 ) or empty the ring buffer.
+ *                  - Rx: Random bursts, uart1_read() polled. Every byte must come in order, none may be dropped.
+ *                        Bursts: Every Rx interrupt must drain the Rx FIFO and come with at least the threshold
+ *                        ( 1, 4 or 6 bytes ), the bytes below it are taken by uart1_read().
+ *                  - Overrun: The Rx FIFO is overrun with the interrupt late. Its 8 bytes must come in, the
+ *                        overrun must be counted once and the reception must go on.
+ *
+ *              Build and run: make -C tools/test
+ *
+ * @return      0: Pass, 1: Fail
+ *
+ * @author      Manuel Caballero (aqueronteblog@gmail.com)
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     The interrupt latency is not modelled: The gap on the line with UART1_TXISEL = 0b01 ( the Tx
+ *              interrupt comes when the shift register is empty already ) does not show up here.
+ */
+#include <stdio.h>
+#include "uart1.h"
+
+
+/**@brief Constants.
+ */
+#define UART1_SIM_BYTES     200000UL    /*!<   Bytes per check                                  */
+#define UART1_SIM_CHUNK     32U         /*!<   uart1_write(): Max. bytes per call               */
+#define UART1_SIM_SPARSE    32U         /*!<   Sparse Tx: One write every 32 characters ( avg. )  */
+#define UART1_SIM_RX_BURST  40U         /*!<   Rx: Max. bytes per burst                         */
+#define UART1_SIM_RX_GAP    16U         /*!<   Rx: One burst every 16 characters ( avg. )       */
+#define UART1_SIM_POLL      16UL        /*!<   uart1_read(): Every 16 characters                */
+#define UART1_SIM_ISR_MAX   16U         /*!<   Interrupts in a row, more: Stuck                 */
+
+
+/**@brief Variables.
+ */
+static uint32_t mySeed  =   1UL;
+
+static uint32_t myTxOut;                    /*!<   Bytes on the Tx line                         */
+static uint32_t myTxErr;                    /*!<   Bytes out of order                           */
+static uint32_t myTxIsr;                    /*!<   Tx interrupts                                */
+static uint32_t myTxShort;                  /*!<   Tx interrupts: Tx FIFO not full, data left   */
+static uint32_t myRxIsr;                    /*!<   Rx interrupts                                */
+static uint32_t myRxShort;                  /*!<   Rx interrupts: FIFO not drained, below level */
+static uint32_t myNotify;                   /*!<   Rx notify, bytes of the current interrupt    */
+static uint32_t myStuck;                    /*!<   Interrupts which did not clear their flag    */
+
+
+/**@brief Function prototypes.
+ */
+static uint32_t rnd         ( void );
+static uint8_t  expected    ( uint32_t k );
+static void     tx_line     ( uint8_t data );
+static void     rx_notify   ( uint32_t count );
+static void     start       ( void );
+static void     dispatch    ( void );
+static uint8_t  check_tx    ( uint8_t saturated );
+static uint8_t  check_rx    ( void );
+static uint8_t  check_ovr   ( void );
+
+
+
+/**
+ * @brief       uint32_t rnd ( void )
+ * @details     Pseudo-random number ( xorshift32 ).
+ *
+ *
+ * @return      Random number
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+static uint32_t rnd ( void )
+{
+    mySeed ^=   mySeed << 13U;
+    mySeed ^=   mySeed >> 17U;
+    mySeed ^=   mySeed << 5U;
+
+    return mySeed;
+}
+
+
+/**
+ * @brief       uint8_t expected ( uint32_t )
+ * @details     Byte k of the test stream.
+ *
+ *
+ * @param[in]    k:     Position in the stream.
+ *
+ *
+ * @return      The byte
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+static uint8_t expected ( uint32_t k )
+{
+    return (uint8_t)( ( k * 131UL ) ^ ( k >> 8U ) );
+}
+
+
+/**
+ * @brief       void tx_line ( uint8_t )
+ * @details     A byte on the Tx line ( pic32_u1tx_hook ): It must be the next one of the stream.
+ *
+ *
+ * @param[in]    data:  The byte.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+static void tx_line ( uint8_t data )
+{
+    if ( data != expected ( myTxOut ) )
+    {
+        if ( myTxErr++ < 5UL )
+        {
+            printf ( "FAIL: Tx byte %lu is 0x%02X, expected 0x%02X\n", (unsigned long)myTxOut, data, expected ( myTxOut ) );
+        }
+    }
+
+    myTxOut++;
+}
+
+
+/**
+ * @brief       void rx_notify ( uint32_t )
+ * @details     Rx notify function: Bytes received by the Rx interrupt.
+ *
+ *
+ * @param[in]    count: How many bytes.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+static void rx_notify ( uint32_t count )
+{
+    myNotify   +=   count;
+}
+
+
+/**
+ * @brief       void start ( void )
+ * @details     Model reset, thresholds and the Rx interrupt enabled ( conf_UART1() ).
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         uart1_init() is called after it.
+ * @warning     N/A
+ */
+static void start ( void )
+{
+    pic32_reset ();
+    pic32_u1tx_hook     =   tx_line;
+    U1STAbits.UTXISEL   =   UART1_TXISEL;
+    U1STAbits.URXISEL   =   UART1_RXISEL;
+    IEC1SET             =   UART1_RXIF;
+    pic32_sync ();
+
+    myTxOut     =   0UL;
+    myTxErr     =   0UL;
+    myTxIsr     =   0UL;
+    myTxShort   =   0UL;
+    myRxIsr     =   0UL;
+    myRxShort   =   0UL;
+}
+
+
+/**
+ * @brief       void dispatch ( void )
+ * @details     U1Handler(): The interrupts are served while their flag is set and enabled. The burst of every
+ *              interrupt is checked.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+static void dispatch ( void )
+{
+    const uint32_t  rx_level[3] =   { 1UL, 4UL, 6UL };
+    uint8_t         n           =   0U;
+
+    pic32_sync ();
+
+    while ( ( IFS1 & IEC1 & ( UART1_RXIF | UART1_TXIF ) ) != 0UL )
+    {
+        if ( n++ == UART1_SIM_ISR_MAX )
+        {
+            myStuck++;
+            break;
+        }
+
+        if ( ( IFS1 & IEC1 & UART1_RXIF ) != 0UL )
+        {
+            myNotify    =   0UL;
+            uart1_rx_isr ();
+            pic32_sync ();
+            myRxIsr++;
+
+            if ( ( U1STAbits.URXDA == 1UL ) || ( myNotify < rx_level[UART1_RXISEL] ) )
+            {
+                myRxShort++;
+            }
+        }
+
+        if ( ( IFS1 & IEC1 & UART1_TXIF ) != 0UL )
+        {
+            uart1_tx_isr ();
+            pic32_sync ();
+            myTxIsr++;
+
+            if ( ( U1STAbits.UTXBF == 0UL ) && ( uart1_tx_free () != UART1_TX_BUFF_MASK ) )
+            {
+                myTxShort++;
+            }
+        }
+    }
+}
+
+
+/**
+ * @brief       uint8_t check_tx ( uint8_t )
+ * @details     Tx: UART1_SIM_BYTES written at random, every character time served.
+ *
+ *
+ * @param[in]    saturated: 1: A write every character time ( the ring buffer is full ), 0: Sparse writes.
+ *
+ *
+ * @return      0: Pass, 1: Fail
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+static uint8_t check_tx ( uint8_t saturated )
+{
+    uint8_t     buff[UART1_SIM_CHUNK];
+    uint32_t    in      =   0UL;
+    uint32_t    idle    =   0UL;
+    uint32_t    slots   =   0UL;
+    uint8_t     length  =   0U;
+    uint8_t     i       =   0U;
+    uint8_t     fail    =   0U;
+
+    start ();
+    uart1_init ( NULL );
+    myStuck =   0UL;
+
+    while ( ( myTxOut < UART1_SIM_BYTES ) && ( slots < ( 8UL * UART1_SIM_BYTES ) ) )
+    {
+        if ( ( in < UART1_SIM_BYTES ) && ( ( saturated == 1U ) || ( ( rnd () % UART1_SIM_SPARSE ) == 0UL ) ) )
+        {
+            length  =   (uint8_t)( 1UL + ( rnd () % UART1_SIM_CHUNK ) );
+            length  =   ( ( UART1_SIM_BYTES - in ) < length ) ? (uint8_t)( UART1_SIM_BYTES - in ) : length;
+
+            for ( i = 0U; i < length; i++ )
+            {
+                buff[i] =   expected ( in + i );
+            }
+
+            in +=   uart1_write ( buff, length );
+            dispatch ();
+        }
+
+        /* The line must not be idle while there is data to send   */
+        if ( ( pic32_u1_slot () == 0U ) && ( in != pic32_u1_stats.sent ) )
+        {
+            idle++;
+        }
+        slots++;
+        dispatch ();
+    }
+
+    printf ( "Tx ( %s ): %lu bytes, %lu Tx interrupts ( %.2f bytes each ), %lu idle characters with data, %lu lost\n",
+             ( saturated == 1U ) ? "saturated" : "sparse", (unsigned long)myTxOut, (unsigned long)myTxIsr,
+             (double)myTxOut / (double)myTxIsr, (unsigned long)idle, (unsigned long)pic32_u1_stats.lost );
+
+    if ( ( myTxOut != UART1_SIM_BYTES ) || ( myTxErr != 0UL ) || ( pic32_u1_stats.lost != 0UL ) || ( uart1_tx_busy () != 0U ) )
+    {
+        printf ( "FAIL: Tx, %lu bytes sent, %lu out of order, %lu written into a full FIFO\n", (unsigned long)myTxOut,
+                 (unsigned long)myTxErr, (unsigned long)pic32_u1_stats.lost );
+        fail    =   1U;
+    }
+
+    if ( ( idle != 0UL ) || ( myTxShort != 0UL ) || ( myStuck != 0UL ) )
+    {
+        printf ( "FAIL: Tx bursts, %lu idle characters, %lu interrupts left the FIFO with room, %lu stuck\n",
+                 (unsigned long)idle, (unsigned long)myTxShort, (unsigned long)myStuck );
+        fail    =   1U;
+    }
+
+    return fail;
+}
+
+
+/**
+ * @brief       uint8_t check_rx ( void )
+ * @details     Rx: UART1_SIM_BYTES in random bursts, uart1_read() every UART1_SIM_POLL character times.
+ *
+ *
+ * @return      0: Pass, 1: Fail
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+static uint8_t check_rx ( void )
+{
+    uint8_t     buff[255];
+    uint32_t    in      =   0UL;
+    uint32_t    out     =   0UL;
+    uint32_t    err     =   0UL;
+    uint32_t    slots   =   0UL;
+    uint32_t    burst   =   0UL;
+    uint32_t    left    =   0UL;
+    uint8_t     n       =   0U;
+    uint8_t     i       =   0U;
+    uint8_t     fail    =   0U;
+
+    start ();
+    uart1_init ( rx_notify );
+    myStuck =   0UL;
+
+    while ( ( out < UART1_SIM_BYTES ) && ( slots < ( 8UL * UART1_SIM_BYTES ) ) )
+    {
+        if ( ( burst == 0UL ) && ( ( rnd () % UART1_SIM_RX_GAP ) == 0UL ) )
+        {
+            burst   =   1UL + ( rnd () % UART1_SIM_RX_BURST );
+        }
+
+        if ( ( burst != 0UL ) && ( in < UART1_SIM_BYTES ) )
+        {
+            pic32_u1_rx ( expected ( in++ ) );
+            burst--;
+        }
+        slots++;
+        dispatch ();
+
+        if ( ( slots % UART1_SIM_POLL ) == 0UL )
+        {
+            do
+            {
+                n   =   uart1_read ( buff, sizeof ( buff ) );
+                dispatch ();
+
+                for ( i = 0U; i < n; i++ )
+                {
+                    if ( ( buff[i] != expected ( out ) ) && ( err++ < 5UL ) )
+                    {
+                        printf ( "FAIL: Rx byte %lu is 0x%02X, expected 0x%02X\n", (unsigned long)out, buff[i], expected ( out ) );
+                    }
+                    out++;
+                }
+            }while ( n != 0U );
+
+            /* uart1_read() takes the bytes below the threshold too   */
+            if ( U1STAbits.URXDA == 1UL )
+            {
+                left++;
+            }
+        }
+    }
+
+    printf ( "Rx: %lu bytes, %lu Rx interrupts ( %.2f bytes each ), %lu dropped\n", (unsigned long)out, (unsigned long)myRxIsr,
+             (double)out / (double)myRxIsr, (unsigned long)uart1_rx_dropped () );
+
+    if ( ( out != UART1_SIM_BYTES ) || ( err != 0UL ) || ( uart1_rx_dropped () != 0UL ) || ( pic32_u1_stats.overruns != 0UL ) )
+    {
+        printf ( "FAIL: Rx, %lu bytes read, %lu out of order, %lu dropped, %lu overruns\n", (unsigned long)out, (unsigned long)err,
+                 (unsigned long)uart1_rx_dropped (), (unsigned long)pic32_u1_stats.overruns );
+        fail    =   1U;
+    }
+
+    if ( ( myRxShort != 0UL ) || ( left != 0UL ) || ( myStuck != 0UL ) )
+    {
+        printf ( "FAIL: Rx bursts, %lu interrupts left data or came below the threshold, %lu reads left data, %lu stuck\n",
+                 (unsigned long)myRxShort, (unsigned long)left, (unsigned long)myStuck );
+        fail    =   1U;
+    }
+
+    return fail;
+}
+
+
+/**
+ * @brief       uint8_t check_ovr ( void )
+ * @details     Overrun: PIC32_U1_FIFO + 4 bytes come in before the Rx interrupt, then PIC32_U1_FIFO more.
+ *
+ *
+ * @return      0: Pass, 1: Fail
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+static uint8_t check_ovr ( void )
+{
+    uint8_t     buff[32];
+    uint32_t    k       =   0UL;
+    uint8_t     n       =   0U;
+    uint8_t     i       =   0U;
+    uint8_t     fail    =   0U;
+
+    start ();
+    uart1_init ( NULL );
+
+    /* Interrupt late: The Rx FIFO is overrun  */
+    for ( k = 0UL; k < ( PIC32_U1_FIFO + 4UL ); k++ )
+    {
+        pic32_u1_rx ( expected ( k ) );
+    }
+    dispatch ();
+
+    /* The reception goes on after the overrun   */
+    for ( k = ( PIC32_U1_FIFO + 4UL ); k < ( ( 2UL * PIC32_U1_FIFO ) + 4UL ); k++ )
+    {
+        pic32_u1_rx ( expected ( k ) );
+        dispatch ();
+    }
+
+    n   =   uart1_read ( buff, sizeof ( buff ) );
+    dispatch ();
+
+    for ( i = 0U; i < n; i++ )
+    {
+        k   =   ( i < PIC32_U1_FIFO ) ? i : ( i + 4UL );
+        if ( buff[i] != expected ( k ) )
+        {
+            fail    =   1U;
+        }
+    }
+
+    printf ( "Overrun: %u bytes read, %lu lost, %lu counted\n", n, (unsigned long)pic32_u1_stats.rx_lost,
+             (unsigned long)uart1_rx_dropped () );
+
+    if ( ( fail == 1U ) || ( n != ( 2U * PIC32_U1_FIFO ) ) || ( pic32_u1_stats.overruns != 1UL ) || ( uart1_rx_dropped () != 1UL ) )
+    {
+        printf ( "FAIL: Overrun, %u bytes read, %lu dropped, expected %u and 1\n", n, (unsigned long)uart1_rx_dropped (),
+                 2U * PIC32_U1_FIFO );
+        fail    =   1U;
+    }
+
+    return fail;
+}
+
+
+/**@brief Function for application main entry.
+ */
+int main ( void )
+{
+    uint8_t fail    =   0U;
+
+    printf ( "UART1_TXISEL 0b%u%u, UART1_RXISEL 0b%u%u\n", ( UART1_TXISEL >> 1U ) & 1U, UART1_TXISEL & 1U,
+             ( UART1_RXISEL >> 1U ) & 1U, UART1_RXISEL & 1U );
+
+    fail   |=   check_tx ( 1U );
+    fail   |=   check_tx ( 0U );
+    fail   |=   check_rx ();
+    fail   |=   check_ovr ();
+
+    printf ( "test_uart1 ( UTXISEL 0b%u%u, URXISEL 0b%u%u ): %s\n", ( UART1_TXISEL >> 1U ) & 1U, UART1_TXISEL & 1U,
+             ( UART1_RXISEL >> 1U ) & 1U, UART1_RXISEL & 1U, ( fail == 0U ) ? "PASS" : "FAIL" );
+
+    return ( fail == 0U ) ? 0 : 1;
+}
@@ -0,0 +1,442 @@
+/**
+ * @brief       test_uart1dma.c
+ * @details     Host test of the UART1 FIFO driver, DMA back end ( UART.X, uart1dma.c ). The UART1 and the DMA
+ *              channels are modelled one character time at a time ( pic32/ ). It is built twice ( Makefile ):
+ *              Rx with the pattern ( '\r' ) and without it ( UART1_DMA_NO_PATTERN ).
+ *
+ *                  - Tx: Random writes to the Tx ring buffer mixed with many small descriptors, chained by the
+ *                        DMA0 interrupt. Every byte must go out in the order it was queued and none may be
+ *                        written into a full Tx FIFO ( a forced cell with UTXBF = 1 ). It runs with the DMA0
+ *                        interrupt served at once ( the line must never be idle with data ) and late, by
+ *                        up to UART1_SIM_LAT_MAX character times ( Tx events lost ).
+ *                  - Rx: Random lines ( pattern ) or a stream ( no pattern ). Every byte must come in order
+ *                        once its block is complete, none may be dropped.
+ *
+ *              Build and run: make -C tools/test
+ *
+ * @return      0: Pass, 1: Fail
+ *
+ * @author      Manuel Caballero (aqueronteblog@gmail.com)
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+#include <stdio.h>
+#include "uart1.h"
+
+
+/**@brief Constants.
+ */
+#define UART1_SIM_BYTES     200000UL    /*!<   Bytes per check                                  */
+#define UART1_SIM_CHUNK     24U         /*!<   uart1_write(): Max. bytes per call               */
+#define UART1_SIM_DESC      16U         /*!<   Descriptors                                      */
+#define UART1_SIM_DESC_MAX  6U          /*!<   Descriptor: Max. bytes ( 0 included )            */
+#define UART1_SIM_LAT_MAX   3UL         /*!<   DMA0 interrupt: Max. latency, characters         */
+#define UART1_SIM_LINE_MAX  80UL        /*!<   Rx: Max. line length ( pattern included )        */
+#define UART1_SIM_POLL      16UL        /*!<   uart1_read(): Every 16 characters                */
+#define UART1_SIM_ISR_MAX   16U         /*!<   Interrupts in a row, more: Stuck                 */
+
+
+/**@brief Variables.
+ */
+static uint32_t     mySeed  =   1UL;
+
+static uint8_t      myStream[UART1_SIM_BYTES];                      /*!<   Bytes to send or to receive      */
+static uint8_t      myDescData[UART1_SIM_DESC][UART1_SIM_DESC_MAX]; /*!<   Descriptor buffers               */
+static uart1_desc_t myDesc[UART1_SIM_DESC];
+
+static uint32_t     myTxOut;                    /*!<   Bytes on the Tx line                         */
+static uint32_t     myTxErr;                    /*!<   Bytes out of order                           */
+static uint32_t     myTxIsr;                    /*!<   DMA0 interrupts                              */
+static uint32_t     myRxIsr;                    /*!<   DMA1 interrupts                              */
+static uint32_t     myLatency;                  /*!<   DMA0 interrupt: Latency of this one          */
+static uint32_t     myWait;                     /*!<   DMA0 interrupt: Character times to wait      */
+static uint8_t      myPending;                  /*!<   DMA0 interrupt: 1, its wait was drawn        */
+static uint32_t     myStuck;                    /*!<   Interrupts which did not clear their flag    */
+
+
+/**@brief Function prototypes.
+ */
+static uint32_t rnd         ( void );
+static void     tx_line     ( uint8_t data );
+static void     start       ( uint32_t latency );
+static void     dispatch    ( void );
+static uint8_t  check_tx    ( uint32_t latency );
+static uint8_t  check_rx    ( void );
+
+
+
+/**
+ * @brief       uint32_t rnd ( void )
+ * @details     Pseudo-random number ( xorshift32 ).
+ *
+ *
+ * @return      Random number
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+static uint32_t rnd ( void )
+{
+    mySeed ^=   mySeed << 13U;
+    mySeed ^=   mySeed >> 17U;
+    mySeed ^=   mySeed << 5U;
+
+    return mySeed;
+}
+
+
+/**
+ * @brief       void tx_line ( uint8_t )
+ * @details     A byte on the Tx line ( pic32_u1tx_hook ): It must be the next one of the stream.
+ *
+ *
+ * @param[in]    data:  The byte.
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+static void tx_line ( uint8_t data )
+{
+    if ( ( myTxOut >= UART1_SIM_BYTES ) || ( data != myStream[myTxOut] ) )
+    {
+        if ( myTxErr++ < 5UL )
+        {
+            printf ( "FAIL: Tx byte %lu is 0x%02X\n", (unsigned long)myTxOut, data );
+        }
+    }
+
+    myTxOut++;
+}
+
+
+/**
+ * @brief       void start ( uint32_t )
+ * @details     Model reset, uart1_init() and the stream.
+ *
+ *
+ * @param[in]    latency:   DMA0 interrupt, max. latency ( characters ).
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+static void start ( uint32_t latency )
+{
+    uint32_t    k   =   0UL;
+
+    for ( k = 0UL; k < UART1_SIM_BYTES; k++ )
+    {
+        myStream[k] =   (uint8_t)rnd ();
+    }
+
+    pic32_reset ();
+    pic32_u1tx_hook =   tx_line;
+    uart1_init ( NULL );
+    pic32_sync ();
+
+    myTxOut     =   0UL;
+    myTxErr     =   0UL;
+    myTxIsr     =   0UL;
+    myRxIsr     =   0UL;
+    myLatency   =   latency;
+    myWait      =   0UL;
+    myPending   =   0U;
+    myStuck     =   0UL;
+}
+
+
+/**
+ * @brief       void dispatch ( void )
+ * @details     DMA1Handler() and DMA0Handler(): The interrupts are served while their flag is set and enabled,
+ *              DMA0 once its wait is over ( myWait, one character time less per pic32_u1_slot() ).
+ *
+ *
+ * @return      N/A
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+static void dispatch ( void )
+{
+    uint32_t    flags   =   0UL;
+    uint8_t     n       =   0U;
+
+    pic32_sync ();
+
+    do
+    {
+        flags   =   IFS2 & IEC2 & ( _IFS2_DMA0IF_MASK | _IFS2_DMA1IF_MASK );
+
+        if ( ( ( flags & _IFS2_DMA0IF_MASK ) != 0UL ) && ( myPending == 0U ) )
+        {
+            myPending   =   1U;
+            myWait      =   ( myLatency == 0UL ) ? 0UL : ( rnd () % ( myLatency + 1UL ) );
+        }
+
+        if ( myWait != 0UL )
+        {
+            flags  &=  ~_IFS2_DMA0IF_MASK;
+        }
+
+        if ( n++ == UART1_SIM_ISR_MAX )
+        {
+            myStuck++;
+            break;
+        }
+
+        if ( ( flags & _IFS2_DMA1IF_MASK ) != 0UL )
+        {
+            uart1_dma_rx_isr ();
+            pic32_sync ();
+            myRxIsr++;
+        }
+
+        if ( ( flags & _IFS2_DMA0IF_MASK ) != 0UL )
+        {
+            myPending   =   0U;
+            uart1_dma_tx_isr ();
+            pic32_sync ();
+            myTxIsr++;
+        }
+    }while ( flags != 0UL );
+}
+
+
+/**
+ * @brief       uint8_t check_tx ( uint32_t )
+ * @details     Tx: UART1_SIM_BYTES queued at random, through the Tx ring buffer or a descriptor.
+ *
+ *
+ * @param[in]    latency:   DMA0 interrupt, max. latency ( characters ).
+ *
+ *
+ * @return      0: Pass, 1: Fail
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+static uint8_t check_tx ( uint32_t latency )
+{
+    uint32_t    in      =   0UL;
+    uint32_t    idle    =   0UL;
+    uint32_t    slots   =   0UL;
+    uint32_t    descs   =   0UL;
+    uint32_t    length  =   0UL;
+    uint32_t    d       =   0UL;
+    uint8_t     i       =   0U;
+    uint8_t     fail    =   0U;
+
+    start ( latency );
+
+    for ( d = 0UL; d < UART1_SIM_DESC; d++ )
+    {
+        myDesc[d].done  =   1U;
+    }
+
+    while ( ( myTxOut < UART1_SIM_BYTES ) && ( slots < ( 8UL * UART1_SIM_BYTES ) ) )
+    {
+        if ( ( in < UART1_SIM_BYTES ) && ( ( rnd () % 4UL ) != 0UL ) )
+        {
+            d   =   rnd () % UART1_SIM_DESC;
+
+            if ( ( rnd () % 4UL ) == 0UL )
+            {
+                /* Tx ring buffer  */
+                length  =   1UL + ( rnd () % UART1_SIM_CHUNK );
+                length  =   ( ( UART1_SIM_BYTES - in ) < length ) ? ( UART1_SIM_BYTES - in ) : length;
+                in     +=   uart1_write ( &myStream[in], (uint8_t)length );
+                dispatch ();
+            }
+            else if ( myDesc[d].done == 1U )
+            {
+                /* Descriptor: Queued behind the bytes written so far   */
+                length  =   rnd () % UART1_SIM_DESC_MAX;
+                length  =   ( ( UART1_SIM_BYTES - in ) < length ) ? ( UART1_SIM_BYTES - in ) : length;
+
+                for ( i = 0U; i < length; i++ )
+                {
+                    myDescData[d][i]    =   myStream[in + i];
+                }
+
+                myDesc[d].data      =   myDescData[d];
+                myDesc[d].length    =   (uint16_t)length;
+                uart1_tx_submit ( &myDesc[d] );
+                dispatch ();
+
+                in +=   length;
+                descs++;
+            }
+        }
+
+        /* Served at once, the line must not be idle while there is data to send  */
+        if ( ( pic32_u1_slot () == 0U ) && ( in != pic32_u1_stats.sent ) )
+        {
+            idle++;
+        }
+        slots++;
+        myWait  =   ( myWait != 0UL ) ? ( myWait - 1UL ) : 0UL;
+        dispatch ();
+    }
+
+    printf ( "Tx ( DMA0 interrupt latency 0 to %lu ): %lu bytes, %lu descriptors, %lu DMA0 interrupts, %lu idle characters with data, %lu lost\n",
+             (unsigned long)latency, (unsigned long)myTxOut, (unsigned long)descs, (unsigned long)myTxIsr, (unsigned long)idle,
+             (unsigned long)pic32_u1_stats.lost );
+
+    if ( ( myTxOut != UART1_SIM_BYTES ) || ( myTxErr != 0UL ) || ( pic32_u1_stats.lost != 0UL ) || ( uart1_tx_busy () != 0U ) )
+    {
+        printf ( "FAIL: Tx, %lu bytes sent, %lu out of order, %lu written into a full FIFO\n", (unsigned long)myTxOut,
+                 (unsigned long)myTxErr, (unsigned long)pic32_u1_stats.lost );
+        fail    =   1U;
+    }
+
+    if ( ( ( latency == 0UL ) && ( idle != 0UL ) ) || ( myStuck != 0UL ) )
+    {
+        printf ( "FAIL: Tx, %lu idle characters, %lu stuck\n", (unsigned long)idle, (unsigned long)myStuck );
+        fail    =   1U;
+    }
+
+    for ( d = 0UL; d < UART1_SIM_DESC; d++ )
+    {
+        if ( myDesc[d].done != 1U )
+        {
+            printf ( "FAIL: Descriptor %lu not done\n", (unsigned long)d );
+            fail    =   1U;
+        }
+    }
+
+    return fail;
+}
+
+
+/**
+ * @brief       uint8_t check_rx ( void )
+ * @details     Rx: UART1_SIM_BYTES, one per character time, uart1_read() every UART1_SIM_POLL character times.
+ *              Pattern: Lines of random length, ended with it. No pattern: A whole number of half buffers.
+ *
+ *
+ * @return      0: Pass, 1: Fail
+ *
+ * @author      Manuel Caballero
+ * @date        18/October/2026
+ * @version     18/October/2026    The ORIGIN
+ * @pre         N/A
+ * @warning     N/A
+ */
+static uint8_t check_rx ( void )
+{
+    uint8_t     buff[255];
+    uint32_t    total   =   UART1_SIM_BYTES;
+    uint32_t    in      =   0UL;
+    uint32_t    out     =   0UL;
+    uint32_t    err     =   0UL;
+    uint32_t    slots   =   0UL;
+    uint8_t     n       =   0U;
+    uint8_t     i       =   0U;
+    uint8_t     fail    =   0U;
+
+    start ( 0UL );
+
+#if ( UART1_DMA_RX_PATTERN == UART1_DMA_NO_PATTERN )
+    total   =   UART1_SIM_BYTES - ( UART1_SIM_BYTES % ( UART1_DMA_RX_SIZE / 2UL ) );
+#else
+    uint32_t    k       =   0UL;
+    uint32_t    line    =   0UL;
+
+    /* Lines: The pattern only at their end, the last one is complete  */
+    for ( k = 0UL; k < UART1_SIM_BYTES; k++ )
+    {
+        if ( line == 0UL )
+        {
+            line    =   1UL + ( rnd () % UART1_SIM_LINE_MAX );
+        }
+
+        if ( ( --line == 0UL ) || ( k == ( UART1_SIM_BYTES - 1UL ) ) )
+        {
+            myStream[k] =   (uint8_t)UART1_DMA_RX_PATTERN;
+        }
+        else if ( myStream[k] == (uint8_t)UART1_DMA_RX_PATTERN )
+        {
+            myStream[k]++;
+        }
+    }
+#endif
+
+    while ( ( out < total ) && ( slots < ( 4UL * UART1_SIM_BYTES ) ) )
+    {
+        if ( in < total )
+        {
+            pic32_u1_rx ( myStream[in++] );
+        }
+        slots++;
+        dispatch ();
+
+        if ( ( slots % UART1_SIM_POLL ) == 0UL )
+        {
+            do
+            {
+                n   =   uart1_read ( buff, sizeof ( buff ) );
+
+                for ( i = 0U; i < n; i++ )
+                {
+                    if ( ( ( out >= total ) || ( buff[i] != myStream[out] ) ) && ( err++ < 5UL ) )
+                    {
+                        printf ( "FAIL: Rx byte %lu is 0x%02X\n", (unsigned long)out, buff[i] );
+                    }
+                    out++;
+                }
+            }while ( n != 0U );
+        }
+    }
+
+    printf ( "Rx ( %s ): %lu bytes, %lu DMA1 interrupts, %lu dropped\n",
+             ( UART1_DMA_RX_PATTERN == UART1_DMA_NO_PATTERN ) ? "no pattern" : "pattern", (unsigned long)out,
+             (unsigned long)myRxIsr, (unsigned long)uart1_rx_dropped () );
+
+    if ( ( out != total ) || ( err != 0UL ) || ( uart1_rx_dropped () != 0UL ) || ( pic32_u1_stats.overruns != 0UL ) || ( myStuck != 0UL ) )
+    {
+        printf ( "FAIL: Rx, %lu bytes read, %lu out of order, %lu dropped, %lu overruns\n", (unsigned long)out, (unsigned long)err,
+                 (unsigned long)uart1_rx_dropped (), (unsigned long)pic32_u1_stats.overruns );
+        fail    =   1U;
+    }
+
+    return fail;
+}
+
+
+/**@brief Function for application main entry.
+ */
+int main ( void )
+{
+    uint8_t fail    =   0U;
+
+    fail   |=   check_tx ( 0UL );
+    fail   |=   check_tx ( UART1_SIM_LAT_MAX );
+    fail   |=   check_rx ();
+
+    printf ( "test_uart1dma ( %s ): %s\n", ( UART1_DMA_RX_PATTERN == UART1_DMA_NO_PATTERN ) ? "no pattern" : "pattern",
+             ( fail == 0U ) ? "PASS" : "FAIL" );
+
+    return ( fail == 0U ) ? 0 : 1;
+}